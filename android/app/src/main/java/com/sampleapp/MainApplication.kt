@@ -43,4 +43,17 @@ class MainApplication : Application(), ReactApplication {
       load()
     }
   }
+
+  override fun onTrimMemory(level: Int) {
+    super.onTrimMemory(level)
+    // 시스템 메모리 부족 신호를 C++ 엔진에 전달 (캐시를 우선순위대로 회수)
+    try {
+      nativeTrimMemory(level)
+    } catch (e: UnsatisfiedLinkError) {
+      // native 라이브러리가 아직 로드되지 않은 경우 무시
+    }
+  }
+
+  // JNI를 통해 C++ 함수 호출
+  private external fun nativeTrimMemory(level: Int)
 }
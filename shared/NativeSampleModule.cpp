@@ -4,9 +4,34 @@
 #include "./engine/Engine.h"
 
 namespace facebook::react {
+
+namespace {
+
+// 엔진 풀의 픽셀 버퍼를 복사 없이 JS ArrayBuffer 로 노출 (ArrayBuffer 가 GC 되면 소멸하면서 버퍼를 풀로 반환)
+class PooledArrayBuffer : public jsi::MutableBuffer
+{
+public:
+  explicit PooledArrayBuffer(std::shared_ptr<FrameBuffer> buffer) : m_buffer(std::move(buffer)) {};
+
+  size_t size() const override { return m_buffer ? m_buffer->size() : 0; };
+  uint8_t* data() override { return m_buffer ? m_buffer->data() : nullptr; };
+
+private:
+  std::shared_ptr<FrameBuffer> m_buffer;
+};
+
+} // namespace
+
 NativeSampleModule::NativeSampleModule(std::shared_ptr<CallInvoker> jsInvoker)
     : NativeSampleModuleCxxSpec(std::move(jsInvoker)) {};
 
+NativeSampleModule::~NativeSampleModule() {
+  // 모듈이 사라진 뒤 엔진 스레드가 JS 스레드에 이벤트 전달을 예약하지 않도록 sink 해제
+  if (m_pEventListener) {
+    Engine::instance().setEventSink(nullptr);
+  }
+};
+
 void NativeSampleModule::initSurface(ANativeWindow *window) {
   Engine::instance().initSurface(window);
 }
@@ -23,6 +48,50 @@ void NativeSampleModule::setImageSequence(jsi::Runtime &rt, const std::vector<st
   Engine::instance().setImageSequence(paths, clipDurSec, xfadeSec);
 }
 
+void NativeSampleModule::setTransitions(jsi::Runtime &rt, const std::vector<std::string>& names) {
+  Engine::instance().setTransitions(names);
+}
+
+void NativeSampleModule::setKenBurnsEnabled(jsi::Runtime &rt, bool enabled) {
+  Engine::instance().setKenBurnsEnabled(enabled);
+}
+
+void NativeSampleModule::setBackgroundMusic(jsi::Runtime &rt, const std::string& path, double gain) {
+  Engine::instance().setBackgroundMusic(path, gain);
+}
+
+bool NativeSampleModule::saveProject(jsi::Runtime &rt, const std::string& path) {
+  return Engine::instance().saveProject(path);
+}
+
+bool NativeSampleModule::loadProject(jsi::Runtime &rt, const std::string& path) {
+  return Engine::instance().loadProject(path);
+}
+
+bool NativeSampleModule::insertClip(jsi::Runtime &rt, int index, const std::string& path) {
+  return Engine::instance().insertClip(index, path);
+}
+
+bool NativeSampleModule::removeClip(jsi::Runtime &rt, int index) {
+  return Engine::instance().removeClip(index);
+}
+
+bool NativeSampleModule::moveClip(jsi::Runtime &rt, int from, int to) {
+  return Engine::instance().moveClip(from, to);
+}
+
+bool NativeSampleModule::retimeClip(jsi::Runtime &rt, int index, double durationSec, double xfadeSec) {
+  return Engine::instance().retimeClip(index, durationSec, xfadeSec);
+}
+
+bool NativeSampleModule::replaceClip(jsi::Runtime &rt, int index, const std::string& path) {
+  return Engine::instance().replaceClip(index, path);
+}
+
+int NativeSampleModule::getClipCount(jsi::Runtime &rt) {
+  return Engine::instance().clipCount();
+}
+
 void NativeSampleModule::previewPlay(jsi::Runtime &rt) {
   Engine::instance().previewPlay();
 };
@@ -35,6 +104,10 @@ void NativeSampleModule::previewStop(jsi::Runtime &rt) {
   Engine::instance().previewStop();
 };
 
+void NativeSampleModule::previewSeek(jsi::Runtime &rt, double timeSec) {
+  Engine::instance().previewSeek(timeSec);
+};
+
 double NativeSampleModule::getTimelineDuration(jsi::Runtime &rt) {
   return Engine::instance().getTimelineDuration();
 };
@@ -51,6 +124,38 @@ void NativeSampleModule::startEncoding(jsi::Runtime &rt, int width, int height,
   Engine::instance().startEncoding(config);
 }
 
+// JS 에서 받은 rendition 별 배열을 EncoderConfig 목록으로 변환
+// (배열 길이가 서로 다르거나 비어있으면 rendition 을 조용히 빠뜨리지 않도록 JS 예외로 알림)
+static std::vector<EncoderConfig> makeRenditionConfigs(jsi::Runtime &rt, const std::vector<int>& widths, const std::vector<int>& heights, const std::vector<int>& bitrates,
+                                                       const std::vector<std::string>& outputPaths, int fps, const std::string& mime) {
+  const size_t count = widths.size();
+  if (heights.size() != count || bitrates.size() != count || outputPaths.size() != count) {
+    throw jsi::JSError(rt, "widths, heights, bitrates and outputPaths must have the same length");
+  }
+  if (count == 0) {
+    throw jsi::JSError(rt, "At least one rendition is required");
+  }
+
+  std::vector<EncoderConfig> configs;
+  configs.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    EncoderConfig config;
+    config.width = widths[i];
+    config.height = heights[i];
+    config.fps = fps;
+    config.bitrate = bitrates[i];
+    config.mime = mime;
+    config.outputPath = outputPaths[i];
+    configs.push_back(std::move(config));
+  }
+  return configs;
+}
+
+void NativeSampleModule::startEncodingRenditions(jsi::Runtime &rt, const std::vector<int>& widths, const std::vector<int>& heights, const std::vector<int>& bitrates,
+                                                 const std::vector<std::string>& outputPaths, int fps, const std::string& mime) {
+  Engine::instance().startEncodingRenditions(makeRenditionConfigs(rt, widths, heights, bitrates, outputPaths, fps, mime));
+}
+
 void NativeSampleModule::cancelEncoding(jsi::Runtime &rt) {
   Engine::instance().cancelEncoding();
 }
@@ -67,6 +172,127 @@ double NativeSampleModule::getEncodingProgress(jsi::Runtime &rt) {
   return Engine::instance().getEncodingProgress();
 }
 
+int NativeSampleModule::submitExportJob(jsi::Runtime &rt, const std::vector<int>& widths, const std::vector<int>& heights, const std::vector<int>& bitrates,
+                                        const std::vector<std::string>& outputPaths, int fps, const std::string& mime, int priority) {
+  return Engine::instance().submitExportJob(makeRenditionConfigs(rt, widths, heights, bitrates, outputPaths, fps, mime), priority);
+}
+
+bool NativeSampleModule::cancelExportJob(jsi::Runtime &rt, int jobId) {
+  return Engine::instance().cancelExportJob(jobId);
+}
+
+std::string NativeSampleModule::getExportJobStatus(jsi::Runtime &rt, int jobId) {
+  return ExportJobManager::statusName(Engine::instance().getExportJobStatus(jobId));
+}
+
+double NativeSampleModule::getExportJobProgress(jsi::Runtime &rt, int jobId) {
+  return Engine::instance().getExportJobProgress(jobId);
+}
+
+std::vector<std::string> NativeSampleModule::getExportJobOutputPaths(jsi::Runtime &rt, int jobId) {
+  return Engine::instance().getExportJobOutputPaths(jobId);
+}
+
+void NativeSampleModule::setMaxConcurrentExports(jsi::Runtime &rt, int maxConcurrent) {
+  Engine::instance().setMaxConcurrentExports(maxConcurrent);
+}
+
+jsi::Object NativeSampleModule::renderFrameToBuffer(jsi::Runtime &rt, double timeSec, int width, int height) {
+  std::shared_ptr<FrameBuffer> buffer = Engine::instance().renderFrameToBuffer(timeSec, width, height);
+  return jsi::ArrayBuffer(rt, std::make_shared<PooledArrayBuffer>(std::move(buffer)));
+}
+
+jsi::Object NativeSampleModule::getMemoryStats(jsi::Runtime &rt) {
+  const MemoryStats stats = Engine::instance().getMemoryStats();
+  jsi::Object result(rt);
+  result.setProperty(rt, "encodedBytes", (double)stats.of(MemoryCategory::Encoded));
+  result.setProperty(rt, "decodedBytes", (double)stats.of(MemoryCategory::Decoded));
+  result.setProperty(rt, "renderTargetBytes", (double)stats.of(MemoryCategory::RenderTargets));
+  result.setProperty(rt, "cacheBytes", (double)stats.of(MemoryCategory::Caches));
+  result.setProperty(rt, "totalBytes", (double)stats.totalBytes);
+  result.setProperty(rt, "budgetBytes", (double)stats.budgetBytes);
+  return result;
+}
+
+void NativeSampleModule::trimMemory(jsi::Runtime &rt, int level) {
+  Engine::instance().trimMemory(level);
+}
+
+jsi::Object NativeSampleModule::getTaskStats(jsi::Runtime &rt) {
+  const TaskSchedulerStats stats = Engine::instance().getTaskStats();
+  jsi::Object result(rt);
+  result.setProperty(rt, "workerCount", stats.workerCount);
+  for (size_t q = 0; q < (size_t)TaskQos::Count; q++) {
+    const TaskQosStats& s = stats.qos[q];
+    jsi::Object qos(rt);
+    qos.setProperty(rt, "queued", (double)s.queued);
+    qos.setProperty(rt, "running", (double)s.running);
+    qos.setProperty(rt, "completed", (double)s.completed);
+    qos.setProperty(rt, "cancelled", (double)s.cancelled);
+    qos.setProperty(rt, "avgLatencyMs", s.avgLatencyMs);
+    qos.setProperty(rt, "maxLatencyMs", s.maxLatencyMs);
+    qos.setProperty(rt, "avgRunMs", s.avgRunMs);
+    result.setProperty(rt, TaskScheduler::qosName((TaskQos)q), qos);
+  }
+  return result;
+}
+
+void NativeSampleModule::setEventListener(jsi::Runtime &rt, jsi::Function listener) {
+  m_pEventListener = std::make_shared<jsi::Function>(std::move(listener));
+
+  // sink 는 엔진의 이벤트 전달 스레드에서 호출되므로, JS 값 생성/listener 호출은 CallInvoker 로 JS 스레드에 예약
+  std::weak_ptr<jsi::Function> weakListener = m_pEventListener;
+  std::weak_ptr<CallInvoker> weakInvoker = jsInvoker_;
+  Engine::instance().setEventSink([weakListener, weakInvoker](std::vector<EngineEvent> events) {
+    auto invoker = weakInvoker.lock();
+    if (!invoker) return;
+    invoker->invokeAsync([weakListener, events = std::move(events)](jsi::Runtime& rt) {
+      auto listener = weakListener.lock();
+      if (!listener) return; // 그 사이 listener 가 교체/해제됨
+
+      jsi::Array array(rt, events.size());
+      for (size_t i = 0; i < events.size(); i++) {
+        const EngineEvent& e = events[i];
+        jsi::Object obj(rt);
+        obj.setProperty(rt, "type", jsi::String::createFromAscii(rt, EngineEvent::typeName(e.type)));
+        switch (e.type) {
+          case EngineEventType::PreviewTime:
+            obj.setProperty(rt, "timeSec", e.value);
+            break;
+          case EngineEventType::ImportProgress:
+            obj.setProperty(rt, "done", e.done);
+            obj.setProperty(rt, "total", e.total);
+            break;
+          default: {
+            obj.setProperty(rt, "jobId", e.jobId);
+            obj.setProperty(rt, "progress", e.value);
+            jsi::Array paths(rt, e.outputPaths.size());
+            for (size_t j = 0; j < e.outputPaths.size(); j++) {
+              paths.setValueAtIndex(rt, j, jsi::String::createFromUtf8(rt, e.outputPaths[j]));
+            }
+            obj.setProperty(rt, "outputPaths", std::move(paths));
+            break;
+          }
+        }
+        array.setValueAtIndex(rt, i, std::move(obj));
+      }
+      listener->call(rt, std::move(array));
+    });
+  });
+}
+
+void NativeSampleModule::setEventRate(jsi::Runtime &rt, double maxRateHz) {
+  Engine::instance().setEventMaxRate(maxRateHz);
+}
+
+void NativeSampleModule::startTracing(jsi::Runtime &rt) {
+  Engine::instance().startTracing();
+}
+
+bool NativeSampleModule::stopTracing(jsi::Runtime &rt, const std::string& outputPath) {
+  return Engine::instance().stopTracing(outputPath);
+}
+
 } // namespace facebook::react
 
 // JNI 함수 정의
@@ -85,3 +311,7 @@ extern "C" JNIEXPORT void JNICALL Java_com_sampleapp_SkiaView_nativeChangeSurfac
 extern "C" JNIEXPORT void JNICALL Java_com_sampleapp_SkiaView_nativeDestroySurface(JNIEnv *, jobject) {
   Engine::instance().destroySurface();
 }
+
+extern "C" JNIEXPORT void JNICALL Java_com_sampleapp_MainApplication_nativeTrimMemory(JNIEnv *, jobject, jint level) {
+  Engine::instance().trimMemory(level);
+}
@@ -2,12 +2,14 @@
 
 #include <AppSpecsJSI.h>
 #include <android/native_window.h> // ANativeWindow
+#include <memory>
 namespace facebook::react {
 
 class NativeSampleModule
     : public NativeSampleModuleCxxSpec<NativeSampleModule> {
 public:
   NativeSampleModule(std::shared_ptr<CallInvoker> jsInvoker);
+  ~NativeSampleModule();
 
 public:
   // android surface 초기화
@@ -20,11 +22,26 @@ public:
 public:
   // 입력받은 파일 경로 -> 이미지 시퀀스 생성 → Timeline 생성(경로 배열, 초 단위 길이/페이드, 그릴 영역 크기)
   void setImageSequence(jsi::Runtime &rt, const std::vector<std::string>& paths, double clipDurSec, double xfadeSec);
+  // 다음 setImageSequence 부터 적용할 클립 사이 전환 방식
+  void setTransitions(jsi::Runtime &rt, const std::vector<std::string>& names);
+  void setKenBurnsEnabled(jsi::Runtime &rt, bool enabled);
+  void setBackgroundMusic(jsi::Runtime &rt, const std::string& path, double gain);
+  // 현재 Timeline 을 프로젝트 파일로 저장 / 프로젝트 파일에서 복원 (성공 여부 반환)
+  bool saveProject(jsi::Runtime &rt, const std::string& path);
+  bool loadProject(jsi::Runtime &rt, const std::string& path);
+  // 현재 Timeline 기본 트랙의 클립 편집 (성공 여부 반환)
+  bool insertClip(jsi::Runtime &rt, int index, const std::string& path);
+  bool removeClip(jsi::Runtime &rt, int index);
+  bool moveClip(jsi::Runtime &rt, int from, int to);
+  bool retimeClip(jsi::Runtime &rt, int index, double durationSec, double xfadeSec);
+  bool replaceClip(jsi::Runtime &rt, int index, const std::string& path);
+  int getClipCount(jsi::Runtime &rt);
 
   // Preview 제어
   void previewPlay(jsi::Runtime &rt);
   void previewPause(jsi::Runtime &rt);
   void previewStop(jsi::Runtime &rt);
+  void previewSeek(jsi::Runtime &rt, double timeSec);
 
   // Timeline 총 재생 길이(초) 조회(최근에 생성된 Timeline 기준)
   double getTimelineDuration(jsi::Runtime &rt);
@@ -32,6 +49,9 @@ public:
 public:
   // Encoder 제어
   void startEncoding(jsi::Runtime &rt, int width, int height, int fps, int bitrate, const std::string& mime,const std::string& outputPath);
+  // 한 번의 렌더링 패스로 여러 해상도(rendition) 동시 인코딩 (배열의 같은 인덱스끼리 하나의 rendition)
+  void startEncodingRenditions(jsi::Runtime &rt, const std::vector<int>& widths, const std::vector<int>& heights, const std::vector<int>& bitrates,
+                               const std::vector<std::string>& outputPaths, int fps, const std::string& mime);
   void cancelEncoding(jsi::Runtime &rt);
   bool isEncoding(jsi::Runtime &rt);
 
@@ -40,6 +60,57 @@ public:
 
   // 인코딩 진행률([0.0, 1.0]) 조회
   double getEncodingProgress(jsi::Runtime &rt);
+
+public:
+  // Export 작업 제어 (작업 ID 반환, 우선순위가 클수록 먼저 실행. 실패 시 -1)
+  int submitExportJob(jsi::Runtime &rt, const std::vector<int>& widths, const std::vector<int>& heights, const std::vector<int>& bitrates,
+                      const std::vector<std::string>& outputPaths, int fps, const std::string& mime, int priority);
+  bool cancelExportJob(jsi::Runtime &rt, int jobId);
+  // 작업 상태 조회 ("queued" | "running" | "completed" | "failed" | "cancelled" | "unknown")
+  std::string getExportJobStatus(jsi::Runtime &rt, int jobId);
+  double getExportJobProgress(jsi::Runtime &rt, int jobId);
+  std::vector<std::string> getExportJobOutputPaths(jsi::Runtime &rt, int jobId);
+  // 동시에 실행할 export 작업 수 제한
+  void setMaxConcurrentExports(jsi::Runtime &rt, int maxConcurrent);
+
+public:
+  /**
+   * 현재 Timeline 의 timeSec 장면을 (width x height) 로 렌더링해 ArrayBuffer 로 반환
+   * - 픽셀은 행 사이 여백 없이(width * 4 byte) 채워진 불투명 RGBA (sRGB), 네이티브 버퍼를 복사 없이 그대로 노출한다.
+   * - ArrayBuffer 가 GC 되면 버퍼는 엔진의 재사용 풀로 돌아간다.
+   * - 렌더링할 수 없으면(Timeline 없음, 크기 오류) byteLength 가 0 인 ArrayBuffer
+   */
+  jsi::Object renderFrameToBuffer(jsi::Runtime &rt, double timeSec, int width, int height);
+
+public:
+  // 분류별 메모리 사용량 조회 { encodedBytes, decodedBytes, renderTargetBytes, cacheBytes, totalBytes, budgetBytes }
+  jsi::Object getMemoryStats(jsi::Runtime &rt);
+  // 메모리 회수 (Android ComponentCallbacks2.TRIM_MEMORY_* 값)
+  void trimMemory(jsi::Runtime &rt, int level);
+  /**
+   * 공용 작업 스레드 풀 통계 조회
+   * { workerCount, previewCritical, export, background }
+   * QoS 별: { queued, running, completed, cancelled, avgLatencyMs, maxLatencyMs, avgRunMs }
+   */
+  jsi::Object getTaskStats(jsi::Runtime &rt);
+
+public:
+  /**
+   * 엔진 이벤트 listener 등록 (polling 대신 사용). listener 는 JS 스레드에서 이벤트 배열로 호출된다.
+   * - 이벤트: { type, jobId, progress, timeSec, done, total, outputPaths }
+   *   type = "exportProgress" | "exportCompleted" | "exportFailed" | "exportCancelled" | "previewTime" | "importProgress"
+   * - 진행률/재생 위치/import 진행 이벤트는 setEventRate 빈도(기본 10Hz) 이하로 최신 값만 전달되고, 완료/실패/취소는 즉시 전달된다.
+   */
+  void setEventListener(jsi::Runtime &rt, jsi::Function listener);
+  void setEventRate(jsi::Runtime &rt, double maxRateHz);
+
+public:
+  // trace event 기록 시작/중지 (중지 시 outputPath 에 Chrome/Perfetto JSON 저장)
+  void startTracing(jsi::Runtime &rt);
+  bool stopTracing(jsi::Runtime &rt, const std::string& outputPath);
+
+private:
+  std::shared_ptr<jsi::Function> m_pEventListener; // JS 이벤트 listener (JS 스레드에서만 접근, 엔진 스레드는 weak_ptr 만 들고 있음)
 };
 
 } // namespace facebook::react
@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+// 믹싱 결과(인코더 입력) PCM 형식
+struct AudioFormat
+{
+  int sampleRate = 48000;           // 샘플레이트(Hz)
+  int channels = 2;                 // 채널 수 (interleaved)
+};
+
+/**
+ * 타임라인에 배치되는 오디오 클립 (배경 음악 / 클립별 오디오)
+ * - 경로만 들고 있으며 실제 디코딩은 export 시 AudioMixer 가 스트리밍으로 수행한다. (오디오 길이와 무관하게 메모리 사용량 일정)
+ */
+struct AudioClip
+{
+  std::string path;                 // 오디오 파일 경로 (WAV)
+  double startSec = 0.0;            // 타임라인에서 재생을 시작할 시간(초)
+  double durationSec = 0.0;         // 재생 길이(초). 0 이면 원본 끝까지 (loop 이면 타임라인 끝까지)
+  float gain = 1.0f;                // 음량 배율
+  double fadeInSec = 0.0;           // 시작 부분 fade-in 길이(초)
+  double fadeOutSec = 0.0;          // 끝 부분 fade-out 길이(초)
+  bool loop = false;                // 원본이 끝나면 처음부터 반복 (배경 음악용)
+};
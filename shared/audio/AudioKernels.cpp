@@ -0,0 +1,78 @@
+#include "AudioKernels.h"
+#include <algorithm> // std::clamp
+#include <cmath>     // std::lrintf
+#include <cstring>   // std::memset
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #include <arm_neon.h>
+  #define AUDIO_KERNELS_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define AUDIO_KERNELS_SSE2 1
+#endif
+
+namespace AudioKernels {
+
+void clear(float* dst, int samples) {
+  if (samples > 0) std::memset(dst, 0, sizeof(float) * (size_t)samples);
+};
+
+void mixAdd(float* dst, const float* src, int samples, float gain) {
+  int i = 0;
+#if defined(AUDIO_KERNELS_NEON)
+  const float32x4_t g = vdupq_n_f32(gain);
+  for (; i + 4 <= samples; i += 4) {
+    vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+  }
+#elif defined(AUDIO_KERNELS_SSE2)
+  const __m128 g = _mm_set1_ps(gain);
+  for (; i + 4 <= samples; i += 4) {
+    _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+  }
+#endif
+  for (; i < samples; i++) {
+    dst[i] += src[i] * gain;
+  }
+};
+
+void mixAddRamp(float* dst, const float* src, int frames, int channels, float gainStart, float gainEnd) {
+  if (frames <= 0) return;
+  if (gainStart == gainEnd) {
+    mixAdd(dst, src, frames * channels, gainStart);
+    return;
+  }
+  // fade 구간은 짧으므로 프레임 단위 scalar 로 처리 (컴파일러 자동 벡터화에 맡김)
+  const float step = (gainEnd - gainStart) / (float)frames;
+  for (int f = 0; f < frames; f++) {
+    const float g = gainStart + step * (float)f;
+    for (int c = 0; c < channels; c++) {
+      dst[f * channels + c] += src[f * channels + c] * g;
+    }
+  }
+};
+
+void floatToInt16(int16_t* dst, const float* src, int samples) {
+  int i = 0;
+#if defined(AUDIO_KERNELS_NEON)
+  const float32x4_t scale = vdupq_n_f32(32767.0f);
+  for (; i + 8 <= samples; i += 8) {
+    // float -> int32 -> int16 (포화)
+    const int32x4_t a = vcvtq_s32_f32(vmulq_f32(vld1q_f32(src + i), scale));
+    const int32x4_t b = vcvtq_s32_f32(vmulq_f32(vld1q_f32(src + i + 4), scale));
+    vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+  }
+#elif defined(AUDIO_KERNELS_SSE2)
+  const __m128 scale = _mm_set1_ps(32767.0f);
+  for (; i + 8 <= samples; i += 8) {
+    const __m128i a = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+    const __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(a, b));
+  }
+#endif
+  for (; i < samples; i++) {
+    const float v = std::clamp(src[i] * 32767.0f, -32768.0f, 32767.0f);
+    dst[i] = (int16_t)std::lrintf(v);
+  }
+};
+
+} // namespace AudioKernels
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * 오디오 믹싱용 SIMD 커널 (NEON / SSE2, 그 외는 scalar)
+ * - 모든 버퍼는 채널 interleaved 이며 samples = frames * channels 이다.
+ * - 믹싱 블록 단위로 호출되므로 할당 없이 호출부 버퍼만 사용한다.
+ */
+namespace AudioKernels {
+
+// dst[i] = 0
+void clear(float* dst, int samples);
+
+// dst[i] += src[i] * gain
+void mixAdd(float* dst, const float* src, int samples, float gain);
+
+// dst += src * gain, gain 은 프레임 단위로 gainStart -> gainEnd 까지 선형 변화 (fade-in/out 용)
+void mixAddRamp(float* dst, const float* src, int frames, int channels, float gainStart, float gainEnd);
+
+// float([-1, 1]) -> int16 (범위를 넘으면 포화)
+void floatToInt16(int16_t* dst, const float* src, int samples);
+
+} // namespace AudioKernels
@@ -0,0 +1,106 @@
+#include "AudioMixer.h"
+#include "AudioKernels.h"
+#include "WavSource.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <algorithm> // std::sort, std::min, std::max, std::clamp
+#include <cmath>     // std::llround
+
+AudioMixer::AudioMixer(const std::vector<AudioClip>& clips, double durationSec, const AudioFormat& format)
+  : m_format(format) {
+  m_format.sampleRate = std::max(1, m_format.sampleRate);
+  m_format.channels = std::clamp(m_format.channels, 1, 8);
+  m_totalFrames = (int64_t)std::llround(std::max(0.0, durationSec) * m_format.sampleRate);
+
+  for (const auto& clip : clips) {
+    Voice v;
+    v.clip = clip;
+    v.startFrame = (int64_t)std::llround(std::max(0.0, clip.startSec) * m_format.sampleRate);
+    v.endFrame = clip.durationSec > 0.0 ? v.startFrame + (int64_t)std::llround(clip.durationSec * m_format.sampleRate) : m_totalFrames;
+    v.endFrame = std::min(v.endFrame, m_totalFrames);
+    if (clip.path.empty() || v.endFrame <= v.startFrame) continue;
+    m_voices.push_back(std::move(v));
+  }
+  std::sort(m_voices.begin(), m_voices.end(), [](const Voice& a, const Voice& b) { return a.startFrame < b.startFrame; });
+
+  const size_t blockSamples = (size_t)k_blockFrames * m_format.channels;
+  m_mix.resize(blockSamples);
+  m_scratch.resize(blockSamples);
+};
+
+float AudioMixer::gainAt(const Voice& v, int64_t frame) const {
+  float g = v.clip.gain;
+  const double sinceStart = (double)(frame - v.startFrame) / m_format.sampleRate;
+  const double untilEnd = (double)(v.endFrame - frame) / m_format.sampleRate;
+  if (v.clip.fadeInSec > 0.0) g *= (float)std::clamp(sinceStart / v.clip.fadeInSec, 0.0, 1.0);
+  if (v.clip.fadeOutSec > 0.0) g *= (float)std::clamp(untilEnd / v.clip.fadeOutSec, 0.0, 1.0);
+  return g;
+};
+
+int AudioMixer::readVoice(Voice& v, int frames) {
+  int done = 0;
+  bool rewound = false; // 직전에 되감았는지 (되감은 직후에도 읽을 것이 없으면 빈 원본)
+  while (done < frames) {
+    const int got = v.stream->read(m_scratch.data() + (size_t)done * m_format.channels, frames - done);
+    done += got;
+    if (got > 0) {
+      rewound = false;
+      continue;
+    }
+    // 원본 끝: loop 면 처음부터 이어서, 아니면 여기서 재생 종료
+    // (data 가 비어있거나 헤더보다 짧게 잘린 파일은 되감아도 계속 0 프레임이므로 무한 반복하지 않고 종료)
+    if (!v.clip.loop || rewound || !v.stream->rewind()) break;
+    rewound = true;
+  }
+  return done;
+};
+
+int AudioMixer::mixNext(int16_t* out) {
+  const int frames = (int)std::min<int64_t>(k_blockFrames, m_totalFrames - m_position);
+  if (frames <= 0) return 0;
+  TRACE_SCOPE("export", "mixAudio");
+
+  const int ch = m_format.channels;
+  const int64_t blockStart = m_position;
+  const int64_t blockEnd = m_position + frames;
+  AudioKernels::clear(m_mix.data(), frames * ch);
+
+  for (auto& v : m_voices) {
+    if (v.startFrame >= blockEnd) break; // 시작 시간 순이므로 이후 클립도 아직 시작 전
+    if (v.done) continue;
+    if (v.endFrame <= blockStart) {
+      v.stream.reset();
+      v.done = true;
+      continue;
+    }
+
+    // 재생 구간에 처음 들어온 클립은 이때 연다
+    if (!v.stream) {
+      std::unique_ptr<WavSource> src = WavSource::open(v.clip.path);
+      if (!src) {
+        Logger::warn(k_logTag, "Skipping audio clip %s", v.clip.path.c_str());
+        v.done = true;
+        continue;
+      }
+      v.stream = std::make_unique<AudioResampler>(std::move(src), m_format);
+    }
+
+    // 이번 블록 안에서 클립이 차지하는 구간 [from, to)
+    const int64_t from = std::max(blockStart, v.startFrame);
+    const int64_t to = std::min(blockEnd, v.endFrame);
+    const int got = readVoice(v, (int)(to - from));
+    if (got > 0) {
+      const int offset = (int)(from - blockStart);
+      AudioKernels::mixAddRamp(m_mix.data() + (size_t)offset * ch, m_scratch.data(), got, ch,
+                               gainAt(v, from), gainAt(v, from + got));
+    }
+    if (got < to - from || to == v.endFrame) {
+      v.stream.reset();
+      v.done = true;
+    }
+  }
+
+  AudioKernels::floatToInt16(out, m_mix.data(), frames * ch);
+  m_position = blockEnd;
+  return frames;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "AudioClip.h"
+#include "AudioResampler.h"
+
+/**
+ * 타임라인 오디오 믹서 (export 용)
+ *
+ * - 타임라인 0초부터 durationSec 까지를 고정 크기(k_blockFrames) PCM 블록으로 순서대로 만들어낸다.
+ *   블록의 PTS 는 지금까지 만든 샘플 수로 계산하므로 비디오 프레임 PTS 와 같은 시간축(0초 기준)에 정렬된다.
+ * - 오디오 클립은 재생 구간에 들어설 때 열고(WAV 스트리밍 디코딩 + 리샘플링) 구간이 끝나면 닫는다.
+ *   -> 블록/스크래치 버퍼는 생성 시 한 번만 할당하며, 동시에 열린 클립 수만큼의 고정 크기 읽기 버퍼만 사용하므로
+ *      오디오 길이와 무관하게 메모리 사용량이 일정하다.
+ * - 한 인스턴스는 한 스레드(export 작업 스레드)에서만 사용한다.
+ */
+class AudioMixer
+{
+public:
+  AudioMixer(const std::vector<AudioClip>& clips, double durationSec, const AudioFormat& format = AudioFormat());
+
+  static constexpr int k_blockFrames = 1024; // 한 블록의 프레임 수 (AAC 프레임 크기)
+
+public:
+  // 믹싱할 클립이 있는지 여부 (없으면 무음 트랙을 만들지 않음)
+  bool hasAudio() const { return !m_voices.empty(); };
+  const AudioFormat& format() const { return m_format; };
+
+  // 모든 블록을 만들었는지 여부
+  bool finished() const { return m_position >= m_totalFrames; };
+  // 다음 블록의 PTS(us)
+  int64_t nextPtsUs() const { return m_position * 1'000'000 / m_format.sampleRate; };
+
+  /**
+   * 다음 블록을 interleaved int16 PCM 으로 out 에 기록 (out 은 k_blockFrames * channels 크기 이상)
+   * @return 기록한 프레임 수 (마지막 블록은 k_blockFrames 보다 작을 수 있고, 끝났으면 0)
+   */
+  int mixNext(int16_t* out);
+
+private:
+  // 재생 구간에 들어온 오디오 클립
+  struct Voice
+  {
+    AudioClip clip;
+    int64_t startFrame = 0;             // 타임라인 기준 재생 시작 프레임
+    int64_t endFrame = 0;               // 타임라인 기준 재생 종료 프레임 (원본이 먼저 끝날 수 있음)
+    std::unique_ptr<AudioResampler> stream; // 재생 중일 때만 열려 있음
+    bool done = false;                  // 재생이 끝났거나 열 수 없음
+  };
+
+  // fade-in/out 과 gain 을 적용한 타임라인 프레임 frame 시점의 음량
+  float gainAt(const Voice& v, int64_t frame) const;
+
+  // voice 의 다음 frames 프레임을 m_scratch 에 읽기 (loop 면 되감아 이어 읽음)
+  int readVoice(Voice& v, int frames);
+
+private:
+  AudioFormat m_format;
+  int64_t m_totalFrames = 0;            // 타임라인 전체 프레임 수
+  int64_t m_position = 0;               // 다음 블록의 시작 프레임
+  std::vector<Voice> m_voices;          // 시작 시간 순
+  std::vector<float> m_mix;             // 믹싱 누적 버퍼 (k_blockFrames * channels)
+  std::vector<float> m_scratch;         // 클립 한 개 읽기 버퍼 (k_blockFrames * channels)
+
+private:
+  static constexpr const char* k_logTag = "AudioMixer";
+};
@@ -0,0 +1,79 @@
+#include "AudioResampler.h"
+#include <algorithm> // std::copy
+#include <cmath>     // std::floor
+
+AudioResampler::AudioResampler(std::unique_ptr<IAudioSource> source, const AudioFormat& out)
+  : m_source(std::move(source)), m_out(out) {
+  m_out.channels = std::clamp(m_out.channels, 1, 8);
+  m_inChannels = m_source ? m_source->channels() : 0;
+  if (m_source && m_out.sampleRate > 0) {
+    m_step = (double)m_source->sampleRate() / (double)m_out.sampleRate;
+  }
+  m_in.resize((size_t)(k_inFrames + 1) * std::max(1, m_inChannels));
+};
+
+bool AudioResampler::refill() {
+  if (m_sourceEnded || !m_source) return false;
+
+  // 현재 위치의 프레임(보간의 왼쪽 프레임)부터 버퍼 앞으로 당김
+  const int keep = std::max(0, m_inCount - (int)std::floor(m_pos));
+  const int dropped = m_inCount - keep;
+  std::copy(m_in.begin() + (size_t)dropped * m_inChannels, m_in.begin() + (size_t)m_inCount * m_inChannels, m_in.begin());
+  m_pos -= dropped;
+  m_inCount = keep;
+
+  const int want = (k_inFrames + 1) - m_inCount;
+  const int got = m_source->read(m_in.data() + (size_t)m_inCount * m_inChannels, want);
+  m_inCount += got;
+  if (got < want) m_sourceEnded = true;
+  return got > 0;
+};
+
+void AudioResampler::mapChannels(const float* in, float* out) const {
+  if (m_out.channels == 1) {
+    float sum = 0.0f;
+    for (int c = 0; c < m_inChannels; c++) sum += in[c];
+    out[0] = sum / (float)m_inChannels;
+    return;
+  }
+  for (int c = 0; c < m_out.channels; c++) {
+    out[c] = in[std::min(c, m_inChannels - 1)];
+  }
+};
+
+int AudioResampler::read(float* out, int frames) {
+  if (!m_source || m_inChannels <= 0) return 0;
+
+  const int outCh = m_out.channels;
+  float mixed[2 * 8]; // 보간 전 채널 변환 결과 (왼쪽/오른쪽 프레임, 출력 최대 8채널)
+  int done = 0;
+  while (done < frames) {
+    int i = (int)std::floor(m_pos);
+    // 보간에 필요한 두 프레임(i, i + 1)이 버퍼에 없으면 채움 (원본 끝이면 마지막 프레임을 한 번 더 사용)
+    while (i + 1 >= m_inCount && !m_sourceEnded) {
+      refill();
+      i = (int)std::floor(m_pos);
+    }
+    if (i >= m_inCount) break;
+
+    const float w = (float)(m_pos - i);
+    const int j = std::min(i + 1, m_inCount - 1);
+    mapChannels(m_in.data() + (size_t)i * m_inChannels, mixed);
+    mapChannels(m_in.data() + (size_t)j * m_inChannels, mixed + 8);
+    float* dst = out + (size_t)done * outCh;
+    for (int c = 0; c < outCh; c++) {
+      dst[c] = mixed[c] + (mixed[8 + c] - mixed[c]) * w;
+    }
+    done++;
+    m_pos += m_step;
+  }
+  return done;
+};
+
+bool AudioResampler::rewind() {
+  if (!m_source || !m_source->rewind()) return false;
+  m_pos = 0.0;
+  m_inCount = 0;
+  m_sourceEnded = false;
+  return true;
+};
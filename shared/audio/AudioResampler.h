@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "AudioClip.h"
+#include "IAudioSource.h"
+
+/**
+ * 스트리밍 샘플레이트/채널 변환기
+ * - 원본(IAudioSource)을 고정 크기 블록으로 읽어가며 출력 형식(AudioFormat)으로 선형 보간 리샘플링한다.
+ * - 채널은 mono -> stereo 복제, stereo 이상 -> 앞의 두 채널 사용, 출력이 mono 면 평균으로 맞춘다.
+ * - 내부 버퍼는 생성 시 한 번만 할당한다.
+ */
+class AudioResampler
+{
+public:
+  AudioResampler(std::unique_ptr<IAudioSource> source, const AudioFormat& out);
+
+  /**
+   * 최대 frames 개의 출력 프레임을 out 에 기록 (채널 interleaved)
+   * @return 기록한 프레임 수 (frames 보다 작으면 원본 끝)
+   */
+  int read(float* out, int frames);
+
+  // 원본을 처음으로 되감고 보간 상태 초기화 (loop 재생용)
+  bool rewind();
+
+private:
+  // 원본에서 다음 블록을 읽어 입력 버퍼 뒤에 채움 (보간에 필요한 마지막 프레임은 앞으로 옮겨 유지)
+  bool refill();
+
+  // 원본 프레임 하나를 출력 채널 수에 맞게 변환해 out 에 기록
+  void mapChannels(const float* in, float* out) const;
+
+private:
+  std::unique_ptr<IAudioSource> m_source;
+  AudioFormat m_out;
+  int m_inChannels = 0;
+  double m_step = 1.0;                // 출력 한 프레임당 원본 프레임 진행량 (원본 Hz / 출력 Hz)
+  double m_pos = 0.0;                 // 입력 버퍼 기준 현재 원본 위치 (소수부는 보간 가중치)
+  std::vector<float> m_in;            // 원본 프레임 버퍼 (k_inFrames + 1 프레임)
+  int m_inCount = 0;                  // 입력 버퍼에 들어있는 프레임 수
+  bool m_sourceEnded = false;         // 원본 끝 도달 여부
+
+private:
+  static constexpr int k_inFrames = 1024;
+};
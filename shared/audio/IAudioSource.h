@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * 스트리밍 오디오 입력 인터페이스
+ * - 호출부가 준 버퍼에 필요한 만큼만 디코딩해 채우므로, 구현체는 파일 전체를 메모리에 올리지 않아야 한다.
+ * - 한 인스턴스는 한 스레드(export 작업 스레드)에서만 사용한다.
+ */
+class IAudioSource
+{
+public:
+  virtual ~IAudioSource() = default;
+
+  virtual int sampleRate() const = 0;
+  virtual int channels() const = 0;
+
+  /**
+   * 최대 frames 개의 프레임을 채널 interleaved float([-1, 1]) 로 out 에 기록
+   * @return 읽은 프레임 수 (frames 보다 작으면 원본 끝에 도달, 0 이면 더 읽을 데이터 없음)
+   */
+  virtual int read(float* out, int frames) = 0;
+
+  // 처음 위치로 되감기 (loop 재생용)
+  virtual bool rewind() = 0;
+};
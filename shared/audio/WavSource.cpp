@@ -0,0 +1,135 @@
+#include "WavSource.h"
+#include "../logger/Logger.h"
+#include <algorithm> // std::min
+#include <cstring>   // std::memcmp
+
+namespace {
+
+constexpr uint16_t k_formatPcm = 1;
+constexpr uint16_t k_formatFloat = 3;
+constexpr uint16_t k_formatExtensible = 0xFFFE;
+
+uint16_t readLe16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+uint32_t readLe32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+} // namespace
+
+WavSource::~WavSource() {
+  if (m_file) {
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+};
+
+std::unique_ptr<WavSource> WavSource::open(const std::string& path) {
+  std::unique_ptr<WavSource> src(new WavSource());
+  src->m_file = std::fopen(path.c_str(), "rb");
+  if (!src->m_file) {
+    Logger::error(k_logTag, "Cannot open %s", path.c_str());
+    return nullptr;
+  }
+  if (!src->parseHeader()) {
+    Logger::error(k_logTag, "Unsupported WAV file: %s", path.c_str());
+    return nullptr;
+  }
+  if (src->m_totalFrames <= 0) {
+    Logger::error(k_logTag, "WAV file has no audio data: %s", path.c_str());
+    return nullptr;
+  }
+  src->m_raw.resize((size_t)k_readFrames * src->m_blockAlign);
+  return src;
+};
+
+bool WavSource::parseHeader() {
+  uint8_t riff[12];
+  if (std::fread(riff, 1, sizeof(riff), m_file) != sizeof(riff)) return false;
+  if (std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) return false;
+
+  bool haveFormat = false;
+  uint8_t chunk[8];
+  while (std::fread(chunk, 1, sizeof(chunk), m_file) == sizeof(chunk)) {
+    const uint32_t size = readLe32(chunk + 4);
+    const long next = std::ftell(m_file) + (long)size + (long)(size & 1); // chunk 는 2byte 정렬
+
+    if (std::memcmp(chunk, "fmt ", 4) == 0) {
+      uint8_t fmt[40] = {};
+      const size_t n = std::min<size_t>(size, sizeof(fmt));
+      if (n < 16 || std::fread(fmt, 1, n, m_file) != n) return false;
+
+      uint16_t format = readLe16(fmt);
+      m_channels = readLe16(fmt + 2);
+      m_sampleRate = (int)readLe32(fmt + 4);
+      m_blockAlign = readLe16(fmt + 12);
+      m_bitsPerSample = readLe16(fmt + 14);
+      if (format == k_formatExtensible && n >= 26) {
+        format = readLe16(fmt + 24); // SubFormat GUID 의 앞 2byte 가 실제 형식
+      }
+      m_isFloat = (format == k_formatFloat);
+      if (format != k_formatPcm && format != k_formatFloat) return false;
+      if (m_isFloat && m_bitsPerSample != 32) return false;
+      if (!m_isFloat && m_bitsPerSample != 8 && m_bitsPerSample != 16 && m_bitsPerSample != 24 && m_bitsPerSample != 32) return false;
+      if (m_channels <= 0 || m_sampleRate <= 0 || m_blockAlign != m_channels * (m_bitsPerSample / 8)) return false;
+      haveFormat = true;
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (!haveFormat) return false;
+      m_dataOffset = std::ftell(m_file);
+      m_totalFrames = (int64_t)size / m_blockAlign;
+      return true;
+    }
+
+    if (std::fseek(m_file, next, SEEK_SET) != 0) return false;
+  }
+  return false;
+};
+
+int WavSource::read(float* out, int frames) {
+  if (!m_file || frames <= 0) return 0;
+
+  int done = 0;
+  while (done < frames && m_framesRead < m_totalFrames) {
+    const int want = (int)std::min<int64_t>({ (int64_t)(frames - done), (int64_t)k_readFrames, m_totalFrames - m_framesRead });
+    const int got = (int)(std::fread(m_raw.data(), (size_t)m_blockAlign, (size_t)want, m_file));
+    if (got <= 0) {
+      m_framesRead = m_totalFrames; // 파일이 헤더보다 짧으면 여기서 끝
+      break;
+    }
+
+    const uint8_t* p = m_raw.data();
+    float* dst = out + (size_t)done * m_channels;
+    const int samples = got * m_channels;
+    switch (m_bitsPerSample) {
+      case 8:
+        for (int i = 0; i < samples; i++) dst[i] = ((float)p[i] - 128.0f) * (1.0f / 128.0f);
+        break;
+      case 16:
+        for (int i = 0; i < samples; i++) dst[i] = (float)(int16_t)readLe16(p + 2 * i) * (1.0f / 32768.0f);
+        break;
+      case 24:
+        for (int i = 0; i < samples; i++) {
+          const uint8_t* s = p + 3 * i;
+          const int32_t v = (int32_t)(((uint32_t)s[0] << 8) | ((uint32_t)s[1] << 16) | ((uint32_t)s[2] << 24)) >> 8;
+          dst[i] = (float)v * (1.0f / 8388608.0f);
+        }
+        break;
+      default:
+        if (m_isFloat) {
+          for (int i = 0; i < samples; i++) {
+            const uint32_t bits = readLe32(p + 4 * i);
+            std::memcpy(&dst[i], &bits, sizeof(float));
+          }
+        } else {
+          for (int i = 0; i < samples; i++) dst[i] = (float)(int32_t)readLe32(p + 4 * i) * (1.0f / 2147483648.0f);
+        }
+        break;
+    }
+    done += got;
+    m_framesRead += got;
+  }
+  return done;
+};
+
+bool WavSource::rewind() {
+  if (!m_file || std::fseek(m_file, m_dataOffset, SEEK_SET) != 0) return false;
+  m_framesRead = 0;
+  return true;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "IAudioSource.h"
+
+/**
+ * WAV(RIFF) 파일 스트리밍 디코더
+ * - PCM 8/16/24/32bit 정수, 32bit float (WAVE_FORMAT_EXTENSIBLE 포함) 을 지원한다.
+ * - data chunk 를 고정 크기(k_readFrames) 단위로 읽어 float 로 변환하므로 파일 길이와 무관하게 메모리 사용량이 일정하다.
+ */
+class WavSource : public IAudioSource
+{
+public:
+  ~WavSource() override;
+
+  // 파일을 열고 헤더를 검사 (지원하지 않는 형식이거나 data chunk 가 비어있으면 nullptr)
+  static std::unique_ptr<WavSource> open(const std::string& path);
+
+  int sampleRate() const override { return m_sampleRate; };
+  int channels() const override { return m_channels; };
+  int read(float* out, int frames) override;
+  bool rewind() override;
+
+  // 전체 프레임 수
+  int64_t totalFrames() const { return m_totalFrames; };
+
+private:
+  WavSource() = default;
+
+  // RIFF chunk 를 훑어 fmt/data chunk 정보 읽기
+  bool parseHeader();
+
+private:
+  std::FILE* m_file = nullptr;
+  int m_sampleRate = 0;
+  int m_channels = 0;
+  int m_bitsPerSample = 0;
+  bool m_isFloat = false;             // 32bit float 형식 여부
+  int m_blockAlign = 0;               // 한 프레임의 byte 크기
+  long m_dataOffset = 0;              // data chunk 시작 위치
+  int64_t m_totalFrames = 0;          // data chunk 의 전체 프레임 수
+  int64_t m_framesRead = 0;           // 지금까지 읽은 프레임 수
+  std::vector<uint8_t> m_raw;         // 파일에서 읽은 원본 byte 버퍼 (k_readFrames 프레임 분량)
+
+private:
+  static constexpr int k_readFrames = 1024;
+  static constexpr const char* k_logTag = "WavSource";
+};
@@ -0,0 +1,72 @@
+#include "WavWriter.h"
+#include "../logger/Logger.h"
+#include <algorithm> // std::min
+
+namespace {
+
+void putLe16(uint8_t* p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+void putLe32(uint8_t* p, uint32_t v) { putLe16(p, v & 0xFFFF); putLe16(p + 2, v >> 16); }
+
+constexpr long k_riffSizeOffset = 4;
+constexpr long k_dataSizeOffset = 40;
+constexpr size_t k_headerBytes = 44;
+
+} // namespace
+
+WavWriter::~WavWriter() {
+  close();
+};
+
+bool WavWriter::open(const std::string& path, const AudioFormat& format) {
+  close();
+  m_file = std::fopen(path.c_str(), "wb");
+  if (!m_file) {
+    Logger::error(k_logTag, "Cannot open output: %s", path.c_str());
+    return false;
+  }
+  m_channels = format.channels;
+  m_dataBytes = 0;
+
+  const uint32_t blockAlign = (uint32_t)format.channels * 2;
+  uint8_t header[k_headerBytes] = { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' };
+  putLe32(header + 16, 16);                               // fmt chunk 크기
+  putLe16(header + 20, 1);                                // PCM
+  putLe16(header + 22, (uint32_t)format.channels);
+  putLe32(header + 24, (uint32_t)format.sampleRate);
+  putLe32(header + 28, (uint32_t)format.sampleRate * blockAlign); // byte rate
+  putLe16(header + 32, blockAlign);
+  putLe16(header + 34, 16);                               // bits per sample
+  header[36] = 'd'; header[37] = 'a'; header[38] = 't'; header[39] = 'a';
+  return std::fwrite(header, 1, k_headerBytes, m_file) == k_headerBytes;
+};
+
+bool WavWriter::write(const int16_t* pcm, int frames) {
+  if (!m_file || frames <= 0) return m_file != nullptr;
+  // WAV 는 little endian (대상 플랫폼(ARM/x86)은 모두 little endian)
+  const size_t count = (size_t)frames * m_channels;
+  if (std::fwrite(pcm, sizeof(int16_t), count, m_file) != count) {
+    Logger::error(k_logTag, "Write failed");
+    return false;
+  }
+  m_dataBytes += count * sizeof(int16_t);
+  return true;
+};
+
+bool WavWriter::close() {
+  if (!m_file) return true;
+
+  // 4GB 를 넘으면 RIFF 크기 필드가 넘치므로 최댓값으로 기록
+  const uint32_t dataBytes = (uint32_t)std::min<uint64_t>(m_dataBytes, 0xFFFFFFFFu - (k_headerBytes - 8));
+  uint8_t size[4];
+  bool ok = true;
+  putLe32(size, dataBytes + (uint32_t)(k_headerBytes - 8));
+  ok = ok && std::fseek(m_file, k_riffSizeOffset, SEEK_SET) == 0 && std::fwrite(size, 1, 4, m_file) == 4;
+  putLe32(size, dataBytes);
+  ok = ok && std::fseek(m_file, k_dataSizeOffset, SEEK_SET) == 0 && std::fwrite(size, 1, 4, m_file) == 4;
+  ok = (std::fclose(m_file) == 0) && ok;
+  m_file = nullptr;
+  if (!ok) {
+    Logger::error(k_logTag, "Failed to finalize WAV header");
+  }
+  return ok;
+};
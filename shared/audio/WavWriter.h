@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "AudioClip.h"
+
+/**
+ * 16bit PCM WAV 파일 기록기 (CPU 백엔드의 오디오 출력용)
+ * - 블록 단위로 이어서 기록하고, close() 에서 RIFF/data chunk 크기를 채운다.
+ */
+class WavWriter
+{
+public:
+  WavWriter() = default;
+  ~WavWriter();
+
+  WavWriter(const WavWriter&) = delete;
+  WavWriter& operator=(const WavWriter&) = delete;
+
+public:
+  // 파일을 만들고 헤더(크기는 0)를 기록
+  bool open(const std::string& path, const AudioFormat& format);
+  // interleaved int16 PCM frames 프레임 기록
+  bool write(const int16_t* pcm, int frames);
+  // 헤더의 크기 필드를 채우고 파일 닫기
+  bool close();
+
+  bool isOpen() const { return m_file != nullptr; };
+
+private:
+  std::FILE* m_file = nullptr;
+  int m_channels = 0;
+  uint64_t m_dataBytes = 0;           // 지금까지 기록한 PCM byte 수
+
+private:
+  static constexpr const char* k_logTag = "WavWriter";
+};
@@ -11,7 +11,10 @@
  *   width/height       : 출력 해상도(px)
  *   fps                : 초당 프레임 수
  *   bitrate            : 비트레이트(bps). 타겟 화질/파일 크기를 좌우합니다.
- *   iFrameIntervalSec  : 키프레임 간격(초). 탐색성/복원력에 영향
+ *   iFrameIntervalSec  : 키프레임 간격(초). 탐색성/복원력에 영향 (contentAwareKeyframes 가 꺼져 있을 때만 사용)
+ *   contentAwareKeyframes : 고정 간격 대신 Timeline 의 클립 경계/전환 종료 시점에 키프레임 요청 (KeyframePlan 참고)
+ *   maxKeyframeIntervalSec : contentAwareKeyframes 사용 시 키프레임 사이 최대 간격(초)
+ *   audioBitrate       : 오디오(AAC) 비트레이트(bps). Timeline 에 오디오 클립이 있을 때만 사용
  *   mime               : 비디오 MIME. 예) "video/avc"(H.264), "video/hevc"(H.265)
  *   outputPath         : 최종 mp4 등 컨테이너 파일의 절대 경로
  *
@@ -27,6 +30,9 @@ struct EncoderConfig
   int fps = 30;                     // 초당 프레임 수
   int bitrate = 4'000'000;          // 비트레이트(bps)
   int iFrameIntervalSec = 2;        // 키프레임 간격(초)
+  bool contentAwareKeyframes = true; // 클립 경계 기반 키프레임 배치 여부
+  int maxKeyframeIntervalSec = 10;  // 클립 경계 기반 배치 시 키프레임 최대 간격(초)
+  int audioBitrate = 128'000;       // 오디오(AAC) 비트레이트(bps)
   std::string mime = "video/avc";   // 코덱 MIME (기본: H.264)
   std::string outputPath;           // 결과 파일 절대 경로(앱 전용 Movies 디렉터리 권장)
 };
@@ -0,0 +1,268 @@
+#include "ExportJobManager.h"
+#include "../logger/Logger.h"
+#include "../task/TaskScheduler.h"
+#include <algorithm> // std::clamp, std::max, std::find
+
+ExportJobManager::ExportJobManager(EncoderFactory factory, int maxConcurrent)
+  : m_factory(std::move(factory)) {
+  // 실행 중인 작업이 this 를 참조하므로, 소멸자가 작업 종료를 기다리는 동안 scheduler 가 먼저 정리되지 않도록 미리 생성
+  TaskScheduler::instance();
+  m_maxConcurrent = clampConcurrency(maxConcurrent);
+};
+
+ExportJobManager::~ExportJobManager() {
+  // 대기 중인 작업은 시작하지 않고, 실행 중인 작업에는 취소 플래그를 세운 뒤 끝날 때까지 기다림
+  std::unique_lock<std::mutex> lock(m_mtx);
+  m_quit = true;
+  for (auto& [id, job] : m_jobs) {
+    job->cancelFlag.store(true);
+  }
+  m_idleCv.wait(lock, [this]() { return m_running == 0; });
+};
+
+int ExportJobManager::submit(std::shared_ptr<Timeline> timeline, std::vector<EncoderConfig> configs, int priority) {
+  if (!timeline || configs.empty()) {
+    Logger::error(k_logTag, "submit: invalid job (timeline=%p, renditions=%zu)", timeline.get(), configs.size());
+    return -1;
+  }
+
+  auto job = std::make_shared<Job>();
+  job->priority = priority;
+  job->timeline = std::move(timeline);
+  job->configs = std::move(configs);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_quit) return -1;
+
+    job->id = m_nextId++;
+    m_jobs[job->id] = job;
+    m_queue.push_back(job);
+    Logger::info(k_logTag, "Job %d queued (priority=%d, renditions=%zu)", job->id, priority, job->configs.size());
+    dispatchLocked();
+  }
+  return job->id;
+};
+
+void ExportJobManager::setListener(JobListener listener) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_listener = std::move(listener);
+};
+
+bool ExportJobManager::cancel(int jobId) {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  auto it = m_jobs.find(jobId);
+  if (it == m_jobs.end()) return false;
+
+  const std::shared_ptr<Job> job = it->second; // finishLocked 가 m_jobs 에서 지워도 알림까지 유지
+  if (job->status == ExportJobStatus::Queued && !job->dispatched) {
+    // 아직 시작 전이면 대기열에서 제거하는 것으로 끝
+    m_queue.erase(std::find(m_queue.begin(), m_queue.end(), job));
+    finishLocked(job, ExportJobStatus::Cancelled);
+    Logger::info(k_logTag, "Job %d cancelled before start", jobId);
+    m_idleCv.notify_all();
+    lock.unlock();
+    notify(*job, ExportJobStatus::Cancelled);
+    return true;
+  }
+  if (job->status == ExportJobStatus::Running || job->status == ExportJobStatus::Queued) {
+    // 실행 중(또는 TaskScheduler 에 등록되어 시작을 기다리는 중)이면 플래그만 세우고 즉시 반환 -> 인코딩 루프 중단/정리는 작업 스레드가 마무리
+    job->cancelFlag.store(true);
+    Logger::info(k_logTag, "Job %d cancellation requested", jobId);
+    return true;
+  }
+  return false;
+};
+
+void ExportJobManager::cancelAll() {
+  std::vector<int> ids;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (const auto& [id, job] : m_jobs) {
+      ids.push_back(id);
+    }
+  }
+  for (int id : ids) {
+    cancel(id);
+  }
+};
+
+void ExportJobManager::setMaxConcurrent(int maxConcurrent) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_maxConcurrent = clampConcurrency(maxConcurrent);
+  // 제한이 늘어났다면 대기 중인 작업을 바로 시작
+  dispatchLocked();
+};
+
+int ExportJobManager::maxConcurrent() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_maxConcurrent;
+};
+
+ExportJobStatus ExportJobManager::status(int jobId) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_jobs.find(jobId);
+  return (it != m_jobs.end()) ? it->second->status : ExportJobStatus::Unknown;
+};
+
+double ExportJobManager::progress(int jobId) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_jobs.find(jobId);
+  return (it != m_jobs.end()) ? it->second->progress.load() : 0.0;
+};
+
+std::vector<std::string> ExportJobManager::outputPaths(int jobId) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_jobs.find(jobId);
+  return (it != m_jobs.end()) ? it->second->outputPaths : std::vector<std::string>();
+};
+
+double ExportJobManager::elapsedSec(int jobId) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_jobs.find(jobId);
+  if (it == m_jobs.end()) return 0.0;
+
+  const Job& job = *it->second;
+  if (job.startTime == std::chrono::steady_clock::time_point()) return 0.0; // 아직 시작 전(또는 시작 전에 취소됨)
+  const auto end = (job.status == ExportJobStatus::Running) ? std::chrono::steady_clock::now() : job.endTime;
+  return std::chrono::duration<double>(end - job.startTime).count();
+};
+
+bool ExportJobManager::hasActiveJobs() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return !m_queue.empty() || m_running > 0;
+};
+
+void ExportJobManager::waitUntilIdle() {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  m_idleCv.wait(lock, [this]() { return m_queue.empty() && m_running == 0; });
+};
+
+const char* ExportJobManager::statusName(ExportJobStatus status) {
+  switch (status) {
+    case ExportJobStatus::Queued:    return "queued";
+    case ExportJobStatus::Running:   return "running";
+    case ExportJobStatus::Completed: return "completed";
+    case ExportJobStatus::Failed:    return "failed";
+    case ExportJobStatus::Cancelled: return "cancelled";
+    default:                         return "unknown";
+  }
+};
+
+void ExportJobManager::dispatchLocked() {
+  while (!m_quit && !m_queue.empty() && m_running < m_maxConcurrent) {
+    // 상태(Running)와 시작 시각은 작업 스레드에서 실제로 시작할 때 기록 (runJob)
+    std::shared_ptr<Job> job = popNextLocked();
+    job->dispatched = true;
+    m_running++;
+
+    TaskScheduler::instance().submit(TaskQos::Export, "ExportJob", [this, job]() {
+      runJob(job);
+
+      // 실행 슬롯 반환 -> 다음 작업 시작 (소멸자가 기다리고 있을 수 있으므로 잠금을 놓기 전에 알림)
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_running--;
+      dispatchLocked();
+      m_idleCv.notify_all();
+    });
+  }
+};
+
+int ExportJobManager::clampConcurrency(int maxConcurrent) {
+  const int capacity = std::max(1, TaskScheduler::instance().exportCapacity());
+  if (maxConcurrent > capacity) {
+    Logger::warn(k_logTag, "maxConcurrent %d exceeds scheduler export capacity, using %d", maxConcurrent, capacity);
+  }
+  return std::clamp(maxConcurrent, 1, capacity);
+};
+
+void ExportJobManager::runJob(const std::shared_ptr<Job>& job) {
+  {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    // 작업 스레드 차례를 기다리는 동안 취소되었으면 인코더를 만들지 않고 종료
+    if (job->cancelFlag.load()) {
+      finishLocked(job, ExportJobStatus::Cancelled);
+      lock.unlock();
+      Logger::info(k_logTag, "Job %d cancelled before start", job->id);
+      notify(*job, ExportJobStatus::Cancelled);
+      return;
+    }
+    job->status = ExportJobStatus::Running;
+    job->startTime = std::chrono::steady_clock::now();
+  }
+
+  Logger::info(k_logTag, "Job %d started", job->id);
+  notify(*job, ExportJobStatus::Running);
+
+  // 인코더 생성과 prepare 도 작업 스레드에서 수행 (Codec/Muxer 생성 비용이 JS 스레드를 막지 않도록)
+  std::shared_ptr<IEncoder> encoder = m_factory ? m_factory(job->configs, job->timeline) : nullptr;
+  if (!encoder) {
+    Logger::error(k_logTag, "Job %d: encoder preparation failed", job->id);
+    const ExportJobStatus status = job->cancelFlag.load() ? ExportJobStatus::Cancelled : ExportJobStatus::Failed;
+    {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      finishLocked(job, status);
+    }
+    notify(*job, status);
+    return;
+  }
+
+  // 모든 프레임을 돌려 인코딩 수행
+  auto progressCb = [this, job](double ratio) {
+    job->progress.store(std::clamp(ratio, 0.0, 1.0));
+    notify(*job, ExportJobStatus::Running);
+  };
+  const bool ok = encoder->encodeBlocking(job->cancelFlag, progressCb);
+  std::vector<std::string> outputs = ok ? encoder->outputPaths() : std::vector<std::string>();
+  encoder->release();
+
+  const bool cancelled = job->cancelFlag.load();
+  if (ok && !cancelled) {
+    /** 인코딩 성공 시 진행률을 100% 로 최종 갱신 */
+    job->progress.store(1.0);
+  } else if (!ok && !cancelled) {
+    /** 인코딩 실패 시 진행률을 0% 로 최종 갱신 */
+    job->progress.store(0.0);
+    Logger::error(k_logTag, "Job %d: encoding failed", job->id);
+  }
+
+  const ExportJobStatus status = cancelled ? ExportJobStatus::Cancelled : (ok ? ExportJobStatus::Completed : ExportJobStatus::Failed);
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    job->outputPaths = outputs;
+    finishLocked(job, status);
+  }
+  Logger::info(k_logTag, "Job %d finished (%s)", job->id, statusName(status));
+  notify(*job, status, outputs);
+};
+
+std::shared_ptr<ExportJobManager::Job> ExportJobManager::popNextLocked() {
+  // 우선순위가 가장 높은 작업, 같으면 먼저 등록된(ID 가 작은) 작업 선택
+  auto best = m_queue.begin();
+  for (auto it = m_queue.begin(); it != m_queue.end(); ++it) {
+    if ((*it)->priority > (*best)->priority ||
+        ((*it)->priority == (*best)->priority && (*it)->id < (*best)->id)) {
+      best = it;
+    }
+  }
+  std::shared_ptr<Job> job = *best;
+  m_queue.erase(best);
+  return job;
+};
+
+void ExportJobManager::finishLocked(const std::shared_ptr<Job>& job, ExportJobStatus status) {
+  job->status = status;
+  job->endTime = std::chrono::steady_clock::now();
+  job->timeline.reset(); // 끝난 작업이 Timeline(이미지들)을 계속 붙들고 있지 않도록 해제
+
+  m_finishedOrder.push_back(job->id);
+  while (m_finishedOrder.size() > k_maxFinishedJobs) {
+    m_jobs.erase(m_finishedOrder.front());
+    m_finishedOrder.pop_front();
+  }
+};
+
+void ExportJobManager::notify(const Job& job, ExportJobStatus status, const std::vector<std::string>& outputPaths) const {
+  if (!m_listener) return;
+  m_listener(job.id, status, job.progress.load(), outputPaths);
+};
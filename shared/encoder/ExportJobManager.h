@@ -0,0 +1,129 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <map>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <condition_variable>
+#include "./IEncoder.h"
+#include "./EncoderConfig.h"
+#include "../video/Timeline.h"
+
+// export 작업 상태
+enum class ExportJobStatus
+{
+  Unknown,    // 존재하지 않는(또는 이미 정리된) 작업
+  Queued,     // 대기열에서 실행 차례를 기다리는 중
+  Running,    // 작업 스레드에서 인코딩 중 (취소 요청 후 정리 중인 상태 포함)
+  Completed,  // 인코딩 성공
+  Failed,     // 준비/인코딩 실패
+  Cancelled,  // 취소됨
+};
+
+/**
+ * export(인코딩) 작업 관리자
+ *
+ * - submit() 으로 들어온 작업은 ID 를 부여받아 대기열에 쌓이고, 우선순위가 높은 작업부터(같으면 먼저 들어온 순서대로) 실행된다.
+ * - 동시에 실행되는 작업 수는 setMaxConcurrent() 로 제한한다. (하드웨어 Codec 인스턴스 수가 제한적이므로 기본값은 1)
+ *   제한은 TaskScheduler 가 동시에 실행할 수 있는 Export 작업 수(exportCapacity)를 넘지 않도록 줄인다.
+ *   -> 등록한 작업이 작업 스레드를 기다리며 Running 으로 보이는 일이 없고, prefetch 등 Background 작업용 스레드가 남는다.
+ * - 실행 차례가 된 작업은 TaskScheduler 에 Export 작업으로 등록된다. 인코더 생성/prepare/encodeBlocking/release 는 모두
+ *   공용 작업 스레드에서 수행되므로 submit() 을 호출한 JS 스레드는 막히지 않는다.
+ * - cancel() 은 대기 중인 작업이면 대기열에서 바로 제거하고, 실행 중인 작업이면 취소 플래그만 세운 뒤 즉시 반환한다.
+ *   -> 인코딩 루프 중단, Codec drain, 자원 해제 등 정리 작업은 해당 작업 스레드가 백그라운드에서 마무리한다.
+ */
+class ExportJobManager
+{
+public:
+  // 인코더 생성 + setTimeline + prepare 까지 수행하는 팩토리 (작업 스레드에서 호출됨). 실패 시 nullptr 반환
+  using EncoderFactory = std::function<std::shared_ptr<IEncoder>(const std::vector<EncoderConfig>&, std::shared_ptr<Timeline>)>;
+  // 작업 상태/진행률 변경 알림 (실행 시작, 진행률 갱신, 종료 시 호출). 작업 스레드(또는 cancel 호출 스레드)에서 잠금 없이 호출됨
+  using JobListener = std::function<void(int jobId, ExportJobStatus status, double progress, const std::vector<std::string>& outputPaths)>;
+
+  explicit ExportJobManager(EncoderFactory factory, int maxConcurrent = 1);
+  ~ExportJobManager();
+
+  ExportJobManager(const ExportJobManager&) = delete;
+  ExportJobManager& operator=(const ExportJobManager&) = delete;
+
+public:
+  // 작업 등록 후 작업 ID 반환 (configs 가 여러 개면 한 번의 렌더링 패스로 여러 rendition 을 만드는 작업). 실패 시 -1
+  int submit(std::shared_ptr<Timeline> timeline, std::vector<EncoderConfig> configs, int priority = 0);
+
+  // 작업 상태 변경 알림 받을 listener 설정 (작업 스레드가 잠금 없이 읽으므로 작업 등록 전에 한 번만 설정)
+  void setListener(JobListener listener);
+
+  // 작업 취소 요청 (블로킹 없음). 취소할 수 있는 상태(대기/실행 중)였으면 true
+  bool cancel(int jobId);
+  // 대기/실행 중인 모든 작업 취소 요청
+  void cancelAll();
+
+  // 동시 실행 작업 수 제한 설정 (1 ~ TaskScheduler::exportCapacity())
+  void setMaxConcurrent(int maxConcurrent);
+  int maxConcurrent() const;
+
+  // 작업 상태/진행률([0.0, 1.0])/출력 경로 조회
+  ExportJobStatus status(int jobId) const;
+  double progress(int jobId) const;
+  std::vector<std::string> outputPaths(int jobId) const;
+  // 작업 실행 시간(초). 실행 중이면 지금까지 걸린 시간, 대기 중이면 0
+  double elapsedSec(int jobId) const;
+
+  // 대기 또는 실행 중인 작업이 하나라도 있는지 여부
+  bool hasActiveJobs() const;
+  // 대기/실행 중인 작업이 모두 끝날 때까지 호출한 스레드를 대기 (헤드리스 배치 렌더링용. JS 스레드에서 호출 금지)
+  void waitUntilIdle();
+
+  // 상태값을 JS 에 전달하기 위한 문자열로 변환
+  static const char* statusName(ExportJobStatus status);
+
+private:
+  struct Job
+  {
+    int id = 0;                                 // 작업 ID
+    int priority = 0;                           // 우선순위 (클수록 먼저 실행)
+    std::shared_ptr<Timeline> timeline;         // 인코딩할 Timeline 스냅샷
+    std::vector<EncoderConfig> configs;         // rendition 별 인코딩 설정
+    ExportJobStatus status = ExportJobStatus::Queued; // 작업 상태 (m_mtx 로 보호)
+    bool dispatched = false;                    // TaskScheduler 에 등록됨 (실행 시작 전까지 상태는 Queued, m_mtx 로 보호)
+    std::vector<std::string> outputPaths;       // 완료 후 출력 파일 경로 (m_mtx 로 보호)
+    std::atomic<bool> cancelFlag = false;       // IEncoder::encodeBlocking 에 전달되는 취소 플래그
+    std::atomic<double> progress = 0.0;         // 진행률
+    std::chrono::steady_clock::time_point startTime; // 실행 시작 시각 (m_mtx 로 보호)
+    std::chrono::steady_clock::time_point endTime;   // 실행 종료 시각 (m_mtx 로 보호)
+  };
+
+  // 동시 실행 제한에 여유가 있는 만큼 대기열의 작업을 TaskScheduler 에 등록 (m_mtx 잠금 상태에서 호출)
+  void dispatchLocked();
+  // 요청한 동시 실행 수를 [1, TaskScheduler::exportCapacity()] 로 제한
+  static int clampConcurrency(int maxConcurrent);
+  void runJob(const std::shared_ptr<Job>& job);
+  // 대기열에서 우선순위가 가장 높은 작업을 꺼냄 (m_mtx 잠금 상태에서 호출)
+  std::shared_ptr<Job> popNextLocked();
+  // 작업 종료 상태 기록 + 끝난 작업 기록이 너무 많이 쌓이지 않도록 오래된 것부터 정리 (m_mtx 잠금 상태에서 호출)
+  void finishLocked(const std::shared_ptr<Job>& job, ExportJobStatus status);
+  // listener 에 작업 상태 전달 (m_mtx 잠금 밖에서 호출 -> listener 안에서 상태 조회 API 를 불러도 교착되지 않음)
+  void notify(const Job& job, ExportJobStatus status, const std::vector<std::string>& outputPaths = {}) const;
+
+private:
+  EncoderFactory m_factory;                         // 인코더 생성 팩토리
+  JobListener m_listener;                           // 작업 상태 변경 알림 대상 (없으면 nullptr)
+  mutable std::mutex m_mtx;                         // 아래 상태 보호용 mutex
+  std::condition_variable m_idleCv;                 // 작업 종료를 waitUntilIdle() / 소멸자에 알림
+  std::vector<std::shared_ptr<Job>> m_queue;        // 실행 대기 중인 작업들
+  std::map<int, std::shared_ptr<Job>> m_jobs;       // 상태 조회용 전체 작업 목록 (대기/실행/종료)
+  std::deque<int> m_finishedOrder;                  // 종료된 작업 ID (오래된 순)
+  int m_maxConcurrent = 1;                          // 동시 실행 작업 수 제한
+  int m_running = 0;                                // TaskScheduler 에 등록된(실행 대기 + 실행 중) 작업 수
+  int m_nextId = 1;                                 // 다음에 발급할 작업 ID
+  bool m_quit = false;                              // 종료 요청 (새 작업 등록/실행 시작 중단)
+
+private:
+  static constexpr size_t k_maxFinishedJobs = 32;   // 상태 조회를 위해 보관하는 종료 작업 수
+  static constexpr const char* k_logTag = "ExportJobManager";
+};
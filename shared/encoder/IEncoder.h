@@ -4,8 +4,9 @@
 #include <atomic>
 #include <functional>
 #include <string>
+#include <vector>
 #include "../video/Timeline.h"
-#include "../EncoderConfig.h"
+#include "./EncoderConfig.h"
 
 /*
  * IEncoder
@@ -23,7 +24,7 @@
  * - encodeBlocking(...)은 블로킹 함수(인코딩 동기적으로 구현된 함수 == 내부에서 자체적인 작업 스레드를 생성하지 않음.)이므로,
  *   메인(UI) 스레드에서 직접 호출하면 인코딩이 끝날 때까지 메인 스레드는 아무런 작업도 하지 못하게 됩니다.
  * - 메인 스레드를 막지 않으려면, encodeBlocking은 반드시 별도 작업 스레드를 만들어서 그 안에서 호출하세요.
- *   (ex> Engine::m_encodeThread). -> GPT5 는 이런 걸 "백그라운드 스레드" 라는 어려운 말로 표현하기도 한답니다.
+ *   (ex> ExportJobManager 의 작업 스레드). -> GPT5 는 이런 걸 "백그라운드 스레드" 라는 어려운 말로 표현하기도 한답니다.
  * - setTimeline/prepare/release는 호출자가 동기화 책임을 집니다(일반적으로 Engine에서 단일 스레드 소유).
  *
  * 타임라인 공유:
@@ -60,7 +61,7 @@ public:
    * @param onProgress 0.0 ~ 1.0 범위의 진행률 콜백(선택)
    * @return 성공 여부
    * @note 이 함수는 "블로킹(동기적으로 실행되는 함수)"이다: 작업이 끝날 때까지 해당 함수를 호출한 메인 스레드는 다음 줄로 진행하지 않는다.
-   * - 메인 스레드를 막지 않으려면 별도 작업 스레드(ex> Engine::m_encodeThread)를 생성 후 그 안에서 작업을 호출하도록 멀티스레딩 처리한다.
+   * - 메인 스레드를 막지 않으려면 별도 작업 스레드(ex> ExportJobManager 의 작업 스레드)를 생성 후 그 안에서 작업을 호출하도록 멀티스레딩 처리한다.
    * - 외부에서 cancelFlag가 true가 되면 프레임 인코딩 루프를 멈추고 안전하게 인코딩 작업 종료를 시도한다.
    * - onProgress(0.0~1.0)는 진행률 콜백이며, 인코딩 스레드에서 호출된다.
    */
@@ -77,4 +78,11 @@ public:
    * @return 출력 경로(prepare 시 설정한 경로)
    */
   virtual std::string outputPath() const = 0;
+
+  /**
+   * @brief 생성되는 모든 출력 파일의 절대 경로 반환
+   * @return 출력 경로 목록(기본 구현은 outputPath() 하나)
+   * @note 여러 rendition 을 동시에 만드는 구현체는 모든 rendition 의 경로를 반환하도록 재정의합니다.
+   */
+  virtual std::vector<std::string> outputPaths() const { return { outputPath() }; };
 };
@@ -0,0 +1,73 @@
+#include "./KeyframePlan.h"
+#include <algorithm> // std::sort, std::max, std::binary_search
+#include <cmath>     // std::ceil, std::llround
+
+std::vector<double> KeyframePlan::boundaryTimes(const Timeline& timeline) {
+  std::vector<double> times;
+  for (int ti = 0; ti < timeline.trackCount(); ti++) {
+    const std::vector<Timeline::Segment>& segs = timeline.segments(ti);
+    for (size_t i = 0; i < segs.size(); i++) {
+      const Timeline::Segment& seg = segs[i];
+      if (ti == 0) {
+        /**
+         * 기본 트랙: 새 클립"만" 보이기 시작하는 시각
+         * - 앞 클립과 겹치는(xfade) 전환이면 앞 클립이 끝나는 시각(= 전환 종료), hard cut 이면 자신의 시작 시각
+         * - 전환 중 프레임들은 두 이미지가 섞여 있어 어차피 P-frame 예측 효율이 낮으므로, 전환이 끝난 직후에 키프레임을 둔다.
+         */
+        if (i == 0) {
+          if (seg.start > 0.0) times.push_back(seg.start);
+          continue;
+        }
+        const Timeline::Segment& prev = segs[i - 1];
+        times.push_back(std::max(prev.start + prev.duration, seg.start));
+      } else {
+        // overlay 트랙: 클립이 나타나고 사라지는 시각
+        times.push_back(seg.start);
+        times.push_back(seg.start + seg.duration);
+      }
+    }
+  }
+  std::sort(times.begin(), times.end());
+  return times;
+};
+
+KeyframePlan KeyframePlan::build(const Timeline& timeline, int fps, double maxIntervalSec, double minIntervalSec) {
+  KeyframePlan plan;
+  fps = std::max(1, fps);
+  const int totalFrames = std::max(1, (int)std::ceil(std::max(0.0, timeline.totalDuration()) * fps));
+  const int minFrames = std::max(1, (int)std::llround(minIntervalSec * fps));
+  const int maxFrames = maxIntervalSec > 0.0 ? std::max(minFrames, (int)std::llround(maxIntervalSec * fps)) : 0;
+
+  // 경계 시각 -> 그 시각 이후의 첫 프레임 (프레임 i 의 시간 = i / fps, 부동소수 오차 허용)
+  std::vector<int> candidates;
+  for (double t : boundaryTimes(timeline)) {
+    const int frame = (int)std::ceil(t * fps - 1e-6);
+    if (frame > 0 && frame < totalFrames) candidates.push_back(frame);
+  }
+
+  plan.m_frames.push_back(0);
+  auto appendCapped = [&](int until) {
+    // 직전 키프레임에서 until 까지가 최대 간격보다 길면 중간에 채움 (채운 키프레임 때문에 until 의 경계가 건너뛰어지지 않도록 minFrames 앞에서 멈춤)
+    if (maxFrames <= 0) return;
+    while (until - plan.m_frames.back() > maxFrames) {
+      plan.m_frames.push_back(std::min(plan.m_frames.back() + maxFrames, until - minFrames));
+    }
+  };
+  for (int frame : candidates) {
+    appendCapped(frame);
+    if (frame - plan.m_frames.back() >= minFrames) {
+      plan.m_frames.push_back(frame);
+    }
+  }
+  appendCapped(totalFrames);
+  return plan;
+};
+
+KeyframePlan KeyframePlan::fromConfig(const Timeline& timeline, const EncoderConfig& cfg) {
+  if (!cfg.contentAwareKeyframes) return KeyframePlan();
+  return build(timeline, cfg.fps, cfg.maxKeyframeIntervalSec);
+};
+
+bool KeyframePlan::isKeyframe(int frameIndex) const {
+  return std::binary_search(m_frames.begin(), m_frames.end(), frameIndex);
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include "./EncoderConfig.h"
+#include "../video/Timeline.h"
+
+/**
+ * Timeline 구조(클립 경계/전환 종료 시점)를 보고 키프레임(sync frame)을 요청할 프레임 번호를 미리 정하는 계획표
+ *
+ * - 고정 간격(iFrameIntervalSec) 키프레임은 정지 구간 한가운데에 비트를 낭비하고, 정작 장면이 통째로 바뀌는 hard cut 은 P-frame 으로 코딩된다.
+ *   -> 새 클립만 보이기 시작하는 첫 프레임(hard cut 직후 / 전환이 끝난 직후)과 overlay 클립이 나타나거나 사라지는 프레임에 키프레임을 둔다.
+ * - 경계가 너무 촘촘하면(minIntervalSec 이내) 뒤의 경계는 건너뛰고, 경계가 없는 긴 구간은 maxIntervalSec 마다 키프레임을 넣는다. (탐색 성능 보장)
+ * - 인코더는 프레임 루프에서 isKeyframe(i) 가 true 인 프레임을 그리기 직전에 Codec 에 sync frame 을 요청한다. (0번 프레임은 항상 키프레임)
+ * - 계산만 하는 값 객체이므로 Codec 없이도 결과(frames())를 검증할 수 있다.
+ */
+class KeyframePlan
+{
+public:
+  KeyframePlan() = default;
+
+  // 최소 키프레임 간격 기본값(초) : 경계가 이보다 가까우면 뒤의 경계는 건너뜀
+  static constexpr double k_minIntervalSec = 0.5;
+
+  /**
+   * timeline 을 fps 로 인코딩할 때의 키프레임 계획 생성
+   * @param maxIntervalSec  키프레임 사이 최대 간격(초), 0 이하면 제한 없음
+   */
+  static KeyframePlan build(const Timeline& timeline, int fps, double maxIntervalSec, double minIntervalSec = k_minIntervalSec);
+
+  // EncoderConfig 기준 계획 생성 (contentAwareKeyframes 가 꺼져 있으면 빈 계획 -> Codec 의 고정 간격을 그대로 사용)
+  static KeyframePlan fromConfig(const Timeline& timeline, const EncoderConfig& cfg);
+
+  // 프레임(frameIndex)에서 키프레임을 요청해야 하는지 여부
+  bool isKeyframe(int frameIndex) const;
+
+  // 키프레임을 둘 프레임 번호 목록 (오름차순, 비어있지 않으면 0 부터 시작)
+  const std::vector<int>& frames() const { return m_frames; };
+  bool empty() const { return m_frames.empty(); };
+
+  // 장면이 바뀌는 시각(초) 목록 (클립 경계 / 전환 종료 / overlay 등장·퇴장, 오름차순)
+  static std::vector<double> boundaryTimes(const Timeline& timeline);
+
+private:
+  std::vector<int> m_frames;          // 키프레임 프레임 번호 (오름차순)
+};
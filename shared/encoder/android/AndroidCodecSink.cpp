@@ -0,0 +1,446 @@
+#include "./AndroidCodecSink.h"
+#include "../../logger/Logger.h"
+#include "../../trace/Trace.h"
+
+// [fcntl/ unistd 헤더 용도 설명]
+// - <fcntl.h>  : 출력 mp4 파일 "열기"에 사용 (POSIX open)
+//                예) m_outputFd = ::open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+// - <unistd.h> : 파일 "닫기" 등 POSIX 함수에 사용
+//                예) ::close(m_outputFd);
+#include <fcntl.h>      // POSIX open
+#include <unistd.h>     // POSIX close
+#include <algorithm>    // std::min
+#include <cstring>      // std::memcpy
+
+// [COLOR_FormatSurface 상수 설명]
+// - 의미: "인코더 입력을 Surface로 받겠다"는 스위치(설정값)
+// - 쓰는 곳: AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_COLOR_FORMAT, COLOR_FormatSurface);
+// - 왜 필요: 이걸 켜야 AMediaCodec_createInputSurface(...)로 Codec 이 결과물을 그릴 수 있는 전용 Native Surface를 만들어 준다.
+// - 왜 하드코딩: NDK 헤더에 이 상수가 심볼로 노출되지 않아 값(자바 쪽 상수값)을 직접 정의해 사용한다.
+static const int32_t COLOR_FormatSurface = 0x7F000789;
+
+// AAC-LC (MediaCodecInfo.CodecProfileLevel.AACObjectLC) 와 오디오 입력 버퍼 크기(한 PCM 블록 이상)
+static const int32_t AACObjectLC = 2;
+static const int32_t k_audioMaxInputBytes = 16 * 1024;
+
+AndroidCodecSink::~AndroidCodecSink() {
+  release(); // 소멸자에서 안전하게 자원 해제
+};
+
+bool AndroidCodecSink::prepare(const EncoderConfig& cfg, const AudioFormat* audio) {
+  // 인코딩 설정 옵션 보관
+  m_encoderConfig = cfg;
+
+  // 1) Codec/native 입력 Surface(ANativeWindow -> offscreen 전용 native surface) 준비
+  if (!createCodecAndSurface()) return false;
+  if (audio && !createAudioCodec(*audio)) return false;
+
+  // 2) Muxer 준비(출력 파일 오픈)
+  if (!openMuxer()) return false;
+
+  // 3) 코덱 시작
+  if (!startCodec()) return false;
+
+  return true;
+};
+
+bool AndroidCodecSink::signalEndOfStream() {
+  if (!m_pCodec) return false;
+
+  // 더 이상 인코딩할 프레임이 없음을 Codec 에 알리기 (EOS)
+  media_status_t ms = AMediaCodec_signalEndOfInputStream(m_pCodec);
+  if (ms != AMEDIA_OK) {
+    Logger::error(k_logTag, "AMediaCodec_signalEndOfInputStream failed: %d", ms);
+    return false;
+  }
+  return true;
+};
+
+void AndroidCodecSink::release() {
+  if (m_pInputWindow) {
+    // offscreen 전용 AMediaCodec native surface 해제
+    ANativeWindow_release(m_pInputWindow);
+    m_pInputWindow = nullptr;
+  }
+
+  if (m_pCodec) {
+    // AMediaCodec 정지 후 해제
+    AMediaCodec_stop(m_pCodec);
+    AMediaCodec_delete(m_pCodec);
+    m_pCodec = nullptr;
+  }
+  m_videoEnded = false;
+  disableAudio();
+
+  // Muxer 닫기
+  closeMuxer();
+};
+
+bool AndroidCodecSink::createCodecAndSurface() {
+  // Codec 이 각 프레임을 어떤 방식으로 압축할 지 codec format 설정
+  AMediaFormat* fmt = AMediaFormat_new();
+  AMediaFormat_setString(fmt, AMEDIAFORMAT_KEY_MIME, m_encoderConfig.mime.c_str());                   // 어떤 코덱 알고리즘으로 압축할 지?(ex> H.264, HEVC 등...)
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_WIDTH, m_encoderConfig.width);                          // 출력 영상의 가로 해상도
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_HEIGHT, m_encoderConfig.height);                        // 출력 영상의 세로 해상도
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_BIT_RATE, m_encoderConfig.bitrate);                     // 비트레이트(bps)
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_FRAME_RATE, m_encoderConfig.fps);                       // 프레임레이트(fps)
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_I_FRAME_INTERVAL, keyframeIntervalSec());               // I-프레임 간격(초)
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_COLOR_FORMAT, COLOR_FormatSurface);                     // 입력을 Surface 로 받겠다는 설정
+
+  // 특정 코덱 알고리즘에 해당하는 Codec 생성
+  m_pCodec = AMediaCodec_createEncoderByType(m_encoderConfig.mime.c_str());
+  if (!m_pCodec) {
+    // Codec 생성 실패 시, codec format 메모리 해제 후 실패 리턴
+    Logger::error(k_logTag, "createCodecAndSurface failed: %s", m_encoderConfig.mime.c_str());
+    AMediaFormat_delete(fmt);
+    return false;
+  }
+
+  // 생성한 Codec 을 "인코딩 모드(encoder)"로 설정한다.
+  // (참고로 AMediaCodec 에서 "Codec" 이란 encoder/decoder 모드를 모두 포괄하는 추상화된 구현체이므로, 목적에 따라 Codec 모드를 설정해서 사용)
+  media_status_t ms = AMediaCodec_configure(m_pCodec, fmt, nullptr, nullptr, AMEDIACODEC_CONFIGURE_FLAG_ENCODE);
+  if (ms != AMEDIA_OK) {
+    Logger::error(k_logTag, "AMediaCodec_configure failed: %d", ms);
+    return false;
+  }
+
+  // 생성한 Codec(encoder) 에 공급할 '입력 프레임'을 그릴 offscreen 전용 native surface 를 AMediaCodec API 를 통해 생성한다.
+  /**
+   * 이 native surface는 AMediaCodec API 로 생성한 인코딩 전용 surface 이므로 화면에 보이지 않으며,
+   * 우리가 EGL/Skia 를 여기에 바인딩하여 그림을 그리면, 해당 프레임이 encoder 입력으로 들어간다.
+   */
+  ms = AMediaCodec_createInputSurface(m_pCodec, &m_pInputWindow);
+  if (ms != AMEDIA_OK || !m_pInputWindow) {
+    Logger::error(k_logTag, "AMediaCodec_createInputSurface failed: %d", ms);
+    return false;
+  }
+
+  return true;
+};
+
+// 코덱을 시작하기 위해 호출하는 함수
+bool AndroidCodecSink::startCodec() {
+  // AMediaCodec_start()를 호출해야 그때부터 offscreen 전용 native surface에 그린 프레임이 실제로 인코더로 흘러간다.
+  // 즉, 이 API 가 호출 및 성공해야 AMediaCodec 내부 BufferQueue 를 통해 연결된 surface -> 인코더 입력 파이프라인이 가동되기 시작함.
+  media_status_t ms = AMediaCodec_start(m_pCodec);
+  if (ms != AMEDIA_OK) {
+    // 시작 실패에 대한 예외 처리
+    Logger::error(k_logTag, "AMediaCodec_start failed: %d", ms);
+    return false;
+  }
+  if (m_pAudioCodec) {
+    ms = AMediaCodec_start(m_pAudioCodec);
+    if (ms != AMEDIA_OK) {
+      Logger::error(k_logTag, "AMediaCodec_start(audio) failed: %d", ms);
+      return false;
+    }
+  }
+  return true;
+};
+
+int AndroidCodecSink::keyframeIntervalSec() const {
+  // 클립 경계 기반 배치를 쓰면 키프레임은 requestSyncFrame() 으로 직접 요청하고, Codec 의 주기적 키프레임은 최대 간격에서만 안전망으로 동작
+  return m_encoderConfig.contentAwareKeyframes ? m_encoderConfig.maxKeyframeIntervalSec : m_encoderConfig.iFrameIntervalSec;
+};
+
+bool AndroidCodecSink::requestSyncFrame() {
+  if (!m_pCodec) return false;
+
+  // "request-sync" (MediaCodec.PARAMETER_KEY_REQUEST_SYNC_FRAME): 다음에 입력되는 프레임을 키프레임으로 인코딩하도록 요청
+  AMediaFormat* params = AMediaFormat_new();
+  AMediaFormat_setInt32(params, "request-sync", 0);
+  media_status_t ms = AMediaCodec_setParameters(m_pCodec, params);
+  AMediaFormat_delete(params);
+  if (ms != AMEDIA_OK) {
+    Logger::warn(k_logTag, "request-sync failed: %d", ms);
+    return false;
+  }
+  return true;
+};
+
+bool AndroidCodecSink::createAudioCodec(const AudioFormat& audio) {
+  /**
+   * 오디오는 Surface 가 아니라 입력 버퍼(ByteBuffer)로 PCM 을 직접 넣는 방식이다.
+   * - 입력: interleaved 16bit PCM (AudioMixer 가 만든 고정 크기 블록)
+   * - 출력: AAC-LC 패킷 -> 같은 Muxer 의 오디오 트랙
+   */
+  m_audioFormat = audio;
+  const char* mime = "audio/mp4a-latm";
+  AMediaFormat* fmt = AMediaFormat_new();
+  AMediaFormat_setString(fmt, AMEDIAFORMAT_KEY_MIME, mime);
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_SAMPLE_RATE, audio.sampleRate);
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_CHANNEL_COUNT, audio.channels);
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_BIT_RATE, m_encoderConfig.audioBitrate);
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_AAC_PROFILE, AACObjectLC);
+  AMediaFormat_setInt32(fmt, AMEDIAFORMAT_KEY_MAX_INPUT_SIZE, k_audioMaxInputBytes);
+
+  m_pAudioCodec = AMediaCodec_createEncoderByType(mime);
+  if (!m_pAudioCodec) {
+    Logger::error(k_logTag, "createAudioCodec failed: %s", mime);
+    AMediaFormat_delete(fmt);
+    return false;
+  }
+  media_status_t ms = AMediaCodec_configure(m_pAudioCodec, fmt, nullptr, nullptr, AMEDIACODEC_CONFIGURE_FLAG_ENCODE);
+  AMediaFormat_delete(fmt);
+  if (ms != AMEDIA_OK) {
+    Logger::error(k_logTag, "AMediaCodec_configure(audio) failed: %d", ms);
+    return false;
+  }
+  return true;
+};
+
+void AndroidCodecSink::disableAudio() {
+  if (m_pAudioCodec) {
+    AMediaCodec_stop(m_pAudioCodec);
+    AMediaCodec_delete(m_pAudioCodec);
+    m_pAudioCodec = nullptr;
+  }
+  m_audioTrackIndex = -1;
+  m_audioEnded = false;
+};
+
+bool AndroidCodecSink::startMuxerIfReady() {
+  // 트랙은 Muxer 시작 전에만 추가할 수 있으므로, 오디오가 있으면 두 트랙이 모두 추가될 때까지 기다린다.
+  if (m_muxerStarted || m_trackIndex < 0 || (m_pAudioCodec && m_audioTrackIndex < 0)) return true;
+
+  media_status_t ms = AMediaMuxer_start(m_pMuxer);
+  if (ms != AMEDIA_OK) {
+    Logger::error(k_logTag, "AMediaMuxer_start failed: %d", ms);
+    return false;
+  }
+  m_muxerStarted = true;
+  return true;
+};
+
+bool AndroidCodecSink::queueAudio(const int16_t* pcm, int frames, int64_t ptsUs, bool endOfStream, bool drainWhenFull) {
+  if (!m_pAudioCodec) return false;
+  TRACE_SCOPE("export", "queueAudio");
+
+  const size_t bytes = (size_t)frames * m_audioFormat.channels * sizeof(int16_t);
+  for (int attempt = 0; attempt < k_audioInputRetries; attempt++) {
+    ssize_t idx = AMediaCodec_dequeueInputBuffer(m_pAudioCodec, 10'000);
+    if (idx < 0) {
+      // 입력 버퍼가 모두 사용 중이면 출력 패킷을 꺼내 Codec 이 입력 버퍼를 돌려줄 수 있게 함 (Muxer 시작 전에는 대기만)
+      if (drainWhenFull && m_muxerStarted && !drainAudio(false)) return false;
+      continue;
+    }
+
+    size_t capacity = 0;
+    uint8_t* in = AMediaCodec_getInputBuffer(m_pAudioCodec, (size_t)idx, &capacity);
+    const size_t copied = in ? std::min(bytes, capacity) : 0;
+    if (copied > 0) {
+      std::memcpy(in, pcm, copied);
+    }
+    media_status_t ms = AMediaCodec_queueInputBuffer(m_pAudioCodec, (size_t)idx, 0, copied, (uint64_t)ptsUs,
+                                                     endOfStream ? AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM : 0);
+    if (ms != AMEDIA_OK) {
+      Logger::error(k_logTag, "AMediaCodec_queueInputBuffer(audio) failed: %d", ms);
+      return false;
+    }
+    return true;
+  }
+  Logger::error(k_logTag, "Audio input buffer timeout");
+  return false;
+};
+
+bool AndroidCodecSink::drainAudio(bool endOfStream) {
+  if (!m_pAudioCodec || !m_pMuxer) return false;
+  if (m_audioEnded) return true;
+
+  AMediaCodecBufferInfo info{};
+  for (;;) {
+    ssize_t idx = AMediaCodec_dequeueOutputBuffer(m_pAudioCodec, &info, 10'000);
+
+    if (idx == AMEDIACODEC_INFO_TRY_AGAIN_LATER) {
+      if (endOfStream) continue;
+      break;
+    } else if (idx == AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED) {
+      // 오디오 트랙 추가 (AAC 설정 정보(csd-0)는 출력 포맷에 들어 있음)
+      AMediaFormat* ofmt = AMediaCodec_getOutputFormat(m_pAudioCodec);
+      m_audioTrackIndex = AMediaMuxer_addTrack(m_pMuxer, ofmt);
+      AMediaFormat_delete(ofmt);
+      if (m_audioTrackIndex < 0) {
+        Logger::error(k_logTag, "AMediaMuxer_addTrack(audio) failed");
+        return false;
+      }
+      if (!startMuxerIfReady()) return false;
+      // 비디오 트랙이 아직이면 Muxer 가 시작되지 않았으므로 출력 패킷은 다음 drain 때 꺼낸다.
+      if (!m_muxerStarted) break;
+    } else if (idx >= 0) {
+      size_t outSize = 0;
+      uint8_t* out = AMediaCodec_getOutputBuffer(m_pAudioCodec, idx, &outSize);
+      // codec config 패킷은 트랙 포맷(csd-0)으로 이미 전달되었으므로 기록하지 않음
+      if (out && info.size > 0 && m_muxerStarted && !(info.flags & AMEDIACODEC_BUFFER_FLAG_CODEC_CONFIG)) {
+        TRACE_SCOPE("export", "muxAudio");
+        AMediaMuxer_writeSampleData(m_pMuxer, m_audioTrackIndex, out + info.offset, &info);
+      }
+      AMediaCodec_releaseOutputBuffer(m_pAudioCodec, idx, false /* render */);
+
+      if (info.flags & AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM) {
+        m_audioEnded = true;
+        break;
+      }
+    }
+  }
+  return true;
+};
+
+bool AndroidCodecSink::drain(bool endOfStream) {
+  if (!m_pCodec || !m_pMuxer) {
+    // Codec 또는 Muxer 가 준비되지 않았으면 인코딩된 패킷을 .mp4 컨테이너에 붙여넣을 수 없음
+    return false;
+  }
+  // EOS 패킷을 이미 기록했으면 더 나올 패킷이 없음 (다른 스레드의 drain(false) 가 EOS 를 먼저 받은 뒤 drain(true) 를 불러도 기다리지 않음)
+  if (m_videoEnded) return true;
+
+  AMediaCodecBufferInfo info{};
+  const int timeoutUs = 10'000; // 10ms -> AMediaCodec_dequeueOutputBuffer API 의 최대 blocking 시간
+
+  for (;;) {
+    /**
+     * AMediaCodec_dequeueOutputBuffer
+     * - 호출 스레드(ExportJobManager 작업 스레드)를 최대 timeoutUs(여기서는 10ms)까지 대기시키고,
+     *   그 사이 인코딩된 출력 버퍼가 queue에 생기면 즉시 idx로 돌려준다.
+     * - 10ms 동안 아무것도 나오지 않으면 AMEDIACODEC_INFO_TRY_AGAIN_LATER를 반환해 “이번엔 buffer queue 에 인코딩된 패킷이 없었다”는 신호를 준다.
+     *
+     * idx 값이 의미하는 상태와 처리
+     * - AMEDIACODEC_INFO_TRY_AGAIN_LATER: 아직 dequeue할 패킷이 없다. 평상시엔 루프 종료, EOS 플러시 시(endOfStream==true)엔 남은 패킷을 기다리기 위해 계속 반복.
+     * - AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED: 코덱이 최초로 인코딩 출력 포맷을 알려주는 순간. 이때 딱 한 번 AMediaMuxer_addTrack → AMediaMuxer_start를 호출해 mp4 트랙을 준비한다.
+     * - idx >= 0: 실제 인코딩된 패킷이 queue에 준비된 상태. 버퍼 포인터를 얻어 해당 트랙에 쓰고, EOS 플래그가 설정돼 있으면 루프를 종료한다.
+     *
+     * 흐름 요약: 포맷 변경 이벤트가 첫 한 번 발생한 이후에는 AMEDIACODEC_INFO_TRY_AGAIN_LATER와 실제 패킷(idx>=0)이 교대로 반복되며,
+     *            drain 호출은 새 패킷을 발견할 때마다 muxer 트랙에 기록하고, 종료 시에는 endOfStream 플래그로 남은 패킷을 모두 비운다.
+     *
+     * (참고로, idx 는 AMEDIACODEC_INFO_TRY_AGAIN_LATER, AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED 와 같은 음수 값인 상태값이 반환될 수 있기 때문에
+     * 부호가 있는 사이즈를 뜻하는 타입인 ssize_t 로 선언되어 있다.)
+     */
+    ssize_t idx = AMediaCodec_dequeueOutputBuffer(m_pCodec, &info, timeoutUs);
+
+    if (idx == AMEDIACODEC_INFO_TRY_AGAIN_LATER) {
+      /** 10ms 동안 기다려봐도 buffer queue 에 인코딩된 패킷이 없는 경우 처리 */
+
+      if (endOfStream) {
+        // 호출부(drain(true))가 인코딩 루프 탈출 후 남은 패킷을 확인사살 하고자 호출한 지점이라면, 다음 for(;;) 루프를 반복하면서 남은 패킷이 나올 때까지 계속 대기
+        continue;
+      }
+
+      // 호출부(drain(false))가 인코딩 루프 안쪽이면, 이미 현재 인코딩 루프에서 렌더링 및 인코딩된 패킷이 dequeue 되어버려
+      // 남아있는 패킷이 없다는 뜻이므로 for(;;) 루프를 탈출하고 다음 인코딩 루프로 넘어가도록 함.
+      break;
+    } else if (idx == AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED) {
+      /** 코덱이 최초로 인코딩 출력 포맷을 알려주는 순간 처리 */
+
+      // AndroidCodecSink::createCodecAndSurface()에서 설정한 "각 프레임을 어떤 방식으로 압축할 지"에 대한 codec format 정보를 가져옴.
+      AMediaFormat* ofmt = AMediaCodec_getOutputFormat(m_pCodec);
+      // 알려준 출력 포맷에 맞춰 mp4 트랙을 준비한다.
+      /**
+       * 참고로, MP4 컨테이너는 하나 이상의 트랙(track)으로 구성되고,
+       * 각각의 트랙 안에 같은 종류의 샘플(예: 비디오 프레임, 오디오 프레임)이 순서대로 저장된다.
+       *
+       * 즉, 비디오냐 오디오냐에 따라 각각 트랙을 구분하여 추가하면 되는건데,
+       * 여기서는 비디오 트랙을 만들고, 오디오 트랙은 drainAudio() 에서 따로 추가한다.
+       *
+       * 코드에서 AMediaMuxer_addTrack으로 만드는 것도 바로 그 “비디오 트랙”이고,
+       * AMediaMuxer_writeSampleData로 한 프레임씩 붙여 넣으면 해당 트랙에 누적됩니다.
+       */
+      m_trackIndex = AMediaMuxer_addTrack(m_pMuxer, ofmt);
+      // 사용이 끝난 codec format 메모리 해제
+      AMediaFormat_delete(ofmt);
+
+      if (m_trackIndex < 0) {
+        Logger::error(k_logTag, "AMediaMuxer_addTrack failed");
+        return false;
+      }
+
+      // 생성된 비디오 트랙에 새 패킷들을 붙여넣을 수 있는 상태가 되도록 Muxer 시작 함수 호출 (오디오 트랙이 있으면 둘 다 추가된 뒤에 시작)
+      if (!startMuxerIfReady()) return false;
+
+    } else if (idx >= 0) {
+      /** 실제 인코딩된 패킷이 buffer queue에 준비된 상태 처리 */
+
+      // 인코딩된 패킷의 버퍼 포인터를 얻어온다.
+      size_t outSize = 0;
+      uint8_t* out = AMediaCodec_getOutputBuffer(m_pCodec, idx, &outSize);
+      if (out && info.size > 0 && m_muxerStarted) {
+        // 얻어온 버퍼 포인터가 유효하고, 패킷 크기가 0보다 크고, Muxer가 시작된 상태라면 mp4 트랙에 붙여넣기
+        TRACE_SCOPE("export", "mux");
+        AMediaMuxer_writeSampleData(m_pMuxer, m_trackIndex, out + info.offset, &info);
+      }
+
+      // 사용이 끝난 출력 버퍼를 AMediaCodec 에게 반환한다.
+      AMediaCodec_releaseOutputBuffer(m_pCodec, idx,  false /* render */);
+
+      if (info.flags & AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM) {
+        // info.flags 와 비트단위 AND 연산을 수행하여 AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM 상태가 켜져있는지 확인
+        // -> 만약 EOS 플래그가 설정되어 있다면, 이 버퍼가 스트림의 마지막 패킷임을 Codec 이 알린 것이므로, for(;;) 루프 탈출
+        m_videoEnded = true;
+        break;
+      }
+    } else {
+      /** 그 외 정보성 상태값이 반환된 경우 처리 */
+      // 그 외(정보성 코드)는 현재 로직에선 따로 처리할 필요가 없다.
+    }
+  }
+
+  return true;
+};
+
+bool AndroidCodecSink::openMuxer() {
+  /** .mp4 파일을 생성 및 열고, AMediaMuxer 인스턴스를 생성한다 */
+  /**
+   * POSIX open()은 전역 네임스페이스(::open)에 정의된 시스템 호출이다.
+   * - POSIX(Portable Operating System Interface)는 유닉스 계열 운영체제들에서 서로 다른 이름으로 정의된 시스템 호출을
+   *   어느 운영체제에서든 하나의 이름으로 호출할 수 있도록 전역 스페이스에 공통으로 정의된 시스템 호출 인터페이스 표준.
+   *   덕분에 ::open, ::close처럼 전역 함수 형태로 접근한다.
+   * - open()은 파일이나 장치를 열고, 그 식별자로서 “파일 디스크립터(fd)”를 돌려준다.
+   *   파일 디스크립터는 OS가 파일/디바이스를 구분하기 위해 배정하는 정수 ID로, 일종의 핸들(handle) 역할을 한다.
+   */
+  m_outputFd = ::open(
+    m_encoderConfig.outputPath.c_str(),
+    O_CREAT | O_TRUNC | O_WRONLY, // 해당 경로에 파일이 없으면 생성, 있으면 비우고, 쓰기 전용으로 연다.
+    0644                          // 해당 파일에 대한 사용자 계정별 권한을 8진수로 정의 (6: 소유자는 읽기/쓰기 허용, 4: 그룹 사용자는 읽기 허용, 4: 기타 사용자는 읽기 허용)
+  );
+  if (m_outputFd < 0) {
+    Logger::error(k_logTag, "open output file failed: %s", m_encoderConfig.outputPath.c_str());
+    return false;
+  }
+
+  // AMediaMuxer는 C FILE*가 아니라 파일 디스크립터(int)를 요구한다.
+  // 그래서 std::fopen 대신 POSIX open()에서 받은 fd를 그대로 넘긴다.
+  m_pMuxer = AMediaMuxer_new(m_outputFd, AMEDIAMUXER_OUTPUT_FORMAT_MPEG_4);
+  if (!m_pMuxer) {
+    // Muxer 생성 실패 시, 생성된 파일 디스크립터 닫고 실패 리턴
+    Logger::error(k_logTag, "AMediaMuxer_new failed");
+    ::close(m_outputFd);
+    m_outputFd = -1;
+    return false;
+  }
+
+  return true;
+};
+
+void AndroidCodecSink::closeMuxer() {
+  /** Muxer에서 사용한 리소스를 정리하고 파일 디스크립터도 닫는다. */
+  if (m_pMuxer) {
+    // Muxer 가 시작된 상태라면 AMediaMuxer_stop() 로 정지시킨 이후에 mp4 파일을 정상적으로 닫는다.
+    if (m_muxerStarted) {
+      AMediaMuxer_stop(m_pMuxer);
+    }
+    // Muxer 인스턴스 해제
+    AMediaMuxer_delete(m_pMuxer);
+    m_pMuxer = nullptr;
+  }
+
+  if (m_outputFd >= 0) {
+    /**
+     * close() 역시 POSIX 전역 함수로, fd를 커널에 반환해 재사용 가능 상태로 돌린다.
+     * fd를 닫은 뒤 -1로 초기화해 “더 이상 유효하지 않다”는 것을 코드상에서 명확히 한다.
+     */
+    ::close(m_outputFd);
+    m_outputFd = -1;
+  }
+
+  // Muxer 관련 멤버변수 초기화
+  m_muxerStarted = false;
+  m_trackIndex = -1;
+};
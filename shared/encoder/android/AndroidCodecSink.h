@@ -0,0 +1,95 @@
+#pragma once
+
+#include <android/native_window.h>         // Surface를 NDK에서 쓰기 위한 타입
+#include <media/NdkMediaCodec.h>           // AMediaCodec (코덱)
+#include <media/NdkMediaFormat.h>          // AMediaFormat (포맷)
+#include <media/NdkMediaMuxer.h>           // AMediaMuxer (mp4 저장)
+#include <atomic>
+#include "../EncoderConfig.h"              // 공용 config
+#include "../../audio/AudioClip.h"         // 오디오 PCM 형식
+
+/**
+ * AMediaCodec(비디오 인코더) + 입력 Surface + AMediaMuxer(.mp4) 묶음
+ *
+ * - 인코더 입력 Surface(inputWindow)에 그려진 프레임을 Codec 이 압축하면, drain() 으로 패킷을 꺼내 mp4 트랙에 기록한다.
+ * - 렌더링(EGL/Skia)은 담당하지 않으므로, 하나의 렌더링 결과를 여러 sink 로 나눠 보내는 구성(multi rendition)에도 재사용된다.
+ * - prepare 에 오디오 형식을 넘기면 AAC 오디오 Codec 도 함께 만들어 같은 mp4 의 오디오 트랙으로 기록한다.
+ *   (PCM 블록은 queueAudio() 로 넣고 drainAudio() 로 꺼냄. Muxer 는 비디오/오디오 트랙이 모두 추가된 뒤에 시작)
+ * - drain() 은 한 번에 하나의 스레드에서만 호출해야 하며, 서로 다른 sink 는 각각 다른 스레드에서 병렬로 drain 할 수 있다.
+ */
+class AndroidCodecSink
+{
+public:
+  AndroidCodecSink() = default;
+  ~AndroidCodecSink();
+
+  AndroidCodecSink(const AndroidCodecSink&) = delete;
+  AndroidCodecSink& operator=(const AndroidCodecSink&) = delete;
+
+public:
+  // Codec/입력 Surface 생성 -> Muxer 준비(출력 파일 오픈) -> 코덱 시작 (audio 가 있으면 AAC 오디오 Codec 도 생성)
+  bool prepare(const EncoderConfig& cfg, const AudioFormat* audio = nullptr);
+  // Codec 에서 인코딩된 출력 패킷을 뽑아서 Muxer 를 통해 .mp4 컨테이너에 기록 (endOfStream 이면 EOS 패킷까지 모두 기록, EOS 를 이미 기록했으면 바로 반환)
+  bool drain(bool endOfStream);
+  // 더 이상 입력할 프레임이 없음을 Codec 에 알림 (EOS)
+  bool signalEndOfStream();
+  // 다음에 입력(swapBuffers)되는 프레임을 키프레임으로 인코딩하도록 Codec 에 요청
+  bool requestSyncFrame();
+  // Codec/입력 Surface/Muxer 해제
+  void release();
+
+  /**
+   * interleaved int16 PCM 블록(frames 프레임)을 오디오 Codec 입력으로 넣기 (ptsUs: 타임라인 기준 블록 시작 시간)
+   * - 입력 버퍼가 비어있지 않으면 오디오 출력을 꺼내가며 잠시 기다린다. endOfStream 이면 마지막 블록으로 표시
+   * - drainWhenFull 이 false 면 출력은 꺼내지 않고 기다리기만 한다. (다른 스레드가 drainAudio 를 맡는 경우)
+   */
+  bool queueAudio(const int16_t* pcm, int frames, int64_t ptsUs, bool endOfStream, bool drainWhenFull = true);
+  // 오디오 Codec 의 출력 패킷을 꺼내 오디오 트랙에 기록 (endOfStream 이면 EOS 패킷까지 모두 기록)
+  bool drainAudio(bool endOfStream);
+  // 오디오 Codec 을 닫고 비디오만 기록 (Muxer 시작 전에만 호출 가능)
+  void disableAudio();
+
+public:
+  ANativeWindow* inputWindow() const { return m_pInputWindow; };
+  const EncoderConfig& config() const { return m_encoderConfig; };
+  bool hasAudio() const { return m_pAudioCodec != nullptr; };
+  bool audioTrackReady() const { return m_audioTrackIndex >= 0; };
+  bool muxerStarted() const { return m_muxerStarted; };
+
+private:
+  // Codec/native 입력 Surface(ANativeWindow -> offscreen 전용 native surface) 준비
+  bool createCodecAndSurface();
+  bool startCodec();
+  // Codec 에 설정할 주기적 키프레임 간격(초)
+  int keyframeIntervalSec() const;
+  // AAC 오디오 Codec 생성/설정
+  bool createAudioCodec(const AudioFormat& audio);
+
+  // 필요한 트랙(비디오 + 오디오)이 모두 추가되었으면 Muxer 시작
+  bool startMuxerIfReady();
+
+  // Muxer 열고 닫기
+  bool openMuxer();
+  void closeMuxer();
+
+private:
+  EncoderConfig m_encoderConfig;                // 인코딩 설정(해상도/FPS/비트레이트/코덱/출력 경로)
+
+  AMediaCodec* m_pCodec = nullptr;              // MediaCodec(비디오 인코더)
+  ANativeWindow* m_pInputWindow = nullptr;      // MediaCodec의 입력 Surface(NDK 윈도우)
+
+  AMediaMuxer* m_pMuxer = nullptr;              // Muxer(.mp4 컨테이너에 인코딩 결과 패키징)
+  int m_trackIndex = -1;                        // 트랙 인덱스 (포맷 확정 후 설정)
+  std::atomic<bool> m_muxerStarted = false;     // Muxer 시작 여부 (drain 스레드가 시작하고 인코딩 스레드가 읽을 수 있음)
+  int m_outputFd = -1;                          // .mp4 출력 파일 디스크립터
+  bool m_videoEnded = false;                    // 비디오 EOS 패킷까지 기록했는지 (이후 drain 은 바로 반환)
+
+  AMediaCodec* m_pAudioCodec = nullptr;         // MediaCodec(AAC 오디오 인코더), 오디오가 없으면 nullptr
+  AudioFormat m_audioFormat;                    // 오디오 입력 PCM 형식
+  int m_audioTrackIndex = -1;                   // 오디오 트랙 인덱스 (포맷 확정 후 설정)
+  bool m_audioEnded = false;                    // 오디오 EOS 패킷까지 기록했는지 (이후 drainAudio 는 바로 반환)
+
+private:
+  static constexpr int k_audioInputRetries = 50;  // 오디오 입력 버퍼를 기다리는 최대 횟수 (10ms 단위)
+  static constexpr const char* k_logTag = "AndroidCodecSink";
+};
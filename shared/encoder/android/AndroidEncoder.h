@@ -1,15 +1,20 @@
 #pragma once
 
 #include <android/native_window.h>         // Surface를 NDK에서 쓰기 위한 타입
-#include <media/NdkMediaCodec.h>           // AMediaCodec (코덱)
-#include <media/NdkMediaFormat.h>          // AMediaFormat (포맷)
-#include <media/NdkMediaMuxer.h>           // AMediaMuxer (mp4 저장)
+#include "./AndroidCodecSink.h"            // AMediaCodec + AMediaMuxer (코덱/mp4 저장)
 #include "../IEncoder.h"                   // 공용 인터페이스
 #include "../EncoderConfig.h"              // 공용 config
 #include "../../render/EglContext.h"       // Encoder 전용 EGL 컨텍스트
 #include "../../render/SkiaGanesh.h"       // Encoder 전용 Skia wrapper
 #include "../../video/Timeline.h"          // 인코딩할 타임라인
-
+#include "../../audio/AudioMixer.h"        // 오디오 클립 믹싱
+#include "../KeyframePlan.h"               // 클립 경계 기반 키프레임 배치
+
+/**
+ * Timeline 을 GPU(EGL/Skia Ganesh)로 렌더링해 MediaCodec 으로 인코딩하는 Android 인코더
+ * - Timeline 에 오디오 클립이 있으면 AudioMixer 로 만든 PCM 블록을 AAC 로 인코딩해 같은 mp4 의 오디오 트랙으로 기록한다.
+ *   (프레임마다 해당 프레임 시각까지의 블록만 넣으므로 오디오/비디오 PTS 가 같은 0초 기준으로 함께 증가)
+ */
 class AndroidEncoder : public IEncoder {
 public:
     AndroidEncoder();
@@ -28,9 +33,7 @@ public:
   std::string outputPath() const override;
 
 private:
-  // 1) Codec/native 입력 Surface(ANativeWindow -> offscreen 전용 native surface) 준비
-  bool createCodecAndSurface();
-  bool startCodec();
+  // 1) Codec/native 입력 Surface/Muxer 준비 및 패킷 기록은 AndroidCodecSink 가 담당
 
   // 2) EGL/Skia 준비 및 해제 (AMediaCodec native surface에 바인딩해서 GL/Skia로 그림을 그리기 위함)
   bool initEGL();         // EglContext로 AMediaCodec native surface 와 EGLSurface 연결
@@ -41,14 +44,7 @@ private:
   // 3) 주어진 시간값(tSec)에 맞는 타임라인 프레임을 SkCanvas 에 렌더링
   bool renderOneFrame(double tSec);
 
-  // 4) Codec 에서 인코딩된 출력 패킷을 뽑아서 Muxer 를 통해 .mp4 컨테이너에 기록
-  bool drainEncoderAndMux(bool endOfStream);
-
-  // 5) Muxer 열고 닫기
-  bool openMuxer();
-  void closeMuxer();
-
-  // 6) 프레임 표시 시간(PTS) 지정: "이 프레임을 언제 보여줄지"를 ns 단위로 각 프레임마다 붙여주는 시간 스티커
+  // 4) 프레임 표시 시간(PTS) 지정: "이 프레임을 언제 보여줄지"를 ns 단위로 각 프레임마다 붙여주는 시간 스티커
   /**
    * PTS (Presentation Time Stamp) 계산 함수
    *
@@ -79,13 +75,19 @@ private:
    */
   void setPresentationTimeNs(int64_t ptsNs);
 
+  // 5) 오디오: 첫 블록을 넣어 오디오 트랙을 Muxer 에 추가 (비디오 첫 패킷보다 먼저 트랙이 준비되어야 Muxer 를 시작할 수 있음)
+  bool primeAudio();
+  // 타임라인 시간 untilUs 까지의 오디오 블록을 믹싱해 오디오 Codec 에 넣기 (untilUs < 0 이면 끝까지 + EOS)
+  bool feedAudio(int64_t untilUs);
+  // 취소 시 남은 오디오는 믹싱하지 않고 빈 EOS 블록만 넣어 오디오 Codec 을 닫음 (이미 마지막 블록을 넣었으면 아무것도 하지 않음)
+  bool endAudio();
+
 private:
   std::shared_ptr<Timeline> m_pTimeline;        // 인코딩에 사용할 타임라인(프리뷰와 동일한 그림을 그리기 위함)
 
   EncoderConfig m_encoderConfig;                // 인코딩 설정(해상도/FPS/비트레이트/코덱/출력 경로)
 
-  AMediaCodec* m_pCodec = nullptr;              // MediaCodec(비디오 인코더)
-  ANativeWindow* m_pInputWindow = nullptr;      // MediaCodec의 입력 Surface(NDK 윈도우)
+  AndroidCodecSink m_sink;                      // MediaCodec(비디오 인코더) + 입력 Surface + Muxer
 
   // EGL + Skia (Renderer 에서 쓰는 것과 공유하지 못하도록 Encoder 전용으로 사용)
   EglContext m_egl;                             // encoder 전용 EGL 컨텍스트(native 입력 Surface에 바인딩해서 GL/Skia로 그림을 그리기 위함)
@@ -93,13 +95,13 @@ private:
   bool m_eglInitialized = false;                // EGL 초기화 여부 플래그
   bool m_skiaInitialized = false;               // Skia 초기화 여부 플래그
 
-  AMediaMuxer* m_pMuxer = nullptr;              // Muxer(.mp4 컨테이너에 인코딩 결과 패키징)
-  int m_trackIndex = -1;                        // 트랙 인덱스 (포맷 확정 후 설정)
-  bool m_muxerStarted = false;                  // Muxer 시작 여부
-  int m_outputFd = -1;                          // .mp4 출력 파일 디스크립터
-
   double m_durationSec = 0.0;                   // 타임라인 총 길이(초) 캐시(프레임 수 계산용)
 
+  KeyframePlan m_keyframes;                     // 키프레임을 요청할 프레임 계획 (비어있으면 Codec 고정 간격)
+  std::unique_ptr<AudioMixer> m_audioMixer;     // 오디오 믹서 (오디오 클립이 없으면 nullptr)
+  std::vector<int16_t> m_audioBlock;            // 믹싱된 PCM 블록 버퍼
+
 private:
+  static constexpr int k_audioPrimeAttempts = 100; // 오디오 트랙 포맷을 기다리는 최대 횟수 (drainAudio 1회 = 최대 10ms)
   static constexpr const char* k_logTag = "AndroidEncoder";
 };
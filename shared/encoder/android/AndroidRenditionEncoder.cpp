@@ -0,0 +1,368 @@
+#include "./AndroidRenditionEncoder.h"
+#include "../../logger/Logger.h"
+#include "../../trace/Trace.h"
+#include <core/SkSamplingOptions.h>
+#include <utility>      // std::move 사용을 위해
+#include <cmath>        // 수학 함수 (ceil, llround, max)
+
+AndroidRenditionEncoder::~AndroidRenditionEncoder() {
+  release(); // 소멸자에서 안전하게 자원 해제
+};
+
+void AndroidRenditionEncoder::setTimeline(std::shared_ptr<Timeline> tl) {
+  m_pTimeline = std::move(tl);
+  m_durationSec = (m_pTimeline ? m_pTimeline->totalDuration() : 0.0);
+};
+
+bool AndroidRenditionEncoder::prepare(const EncoderConfig& cfg) {
+  return prepareRenditions({ cfg });
+};
+
+bool AndroidRenditionEncoder::prepareRenditions(const std::vector<EncoderConfig>& cfgs) {
+  if (!m_pTimeline) {
+    Logger::error(k_logTag, "Timeline not set");
+    return false;
+  }
+  if (cfgs.empty()) {
+    Logger::error(k_logTag, "No rendition configs");
+    return false;
+  }
+
+  // 모든 rendition 은 같은 프레임(같은 PTS)을 공유하므로 fps 는 첫 번째 설정값으로 통일
+  m_fps = std::max(1, cfgs.front().fps);
+
+  // 키프레임 계획도 첫 번째 설정 기준으로 모든 rendition 이 공유 (같은 프레임에서 키프레임 -> rendition 간 전환(ABR) 지점이 맞춰짐)
+  EncoderConfig keyframeCfg = cfgs.front();
+  keyframeCfg.fps = m_fps;
+  m_keyframes = KeyframePlan::fromConfig(*m_pTimeline, keyframeCfg);
+
+  // 오디오 클립이 있으면 믹서는 하나만 만들고 모든 rendition sink 에 AAC 오디오 트랙을 요청
+  m_audioMixer = std::make_unique<AudioMixer>(m_pTimeline->audioClips(), m_durationSec);
+  if (!m_audioMixer->hasAudio()) {
+    m_audioMixer.reset();
+  } else {
+    m_audioBlock.resize((size_t)AudioMixer::k_blockFrames * m_audioMixer->format().channels);
+  }
+  const AudioFormat* audioFormat = m_audioMixer ? &m_audioMixer->format() : nullptr;
+
+  m_renditions.clear();
+  m_masterIndex = 0;
+  for (size_t i = 0; i < cfgs.size(); i++) {
+    EncoderConfig cfg = cfgs[i];
+    cfg.fps = m_fps;
+
+    // rendition 별 Codec/입력 Surface/Muxer 준비
+    auto rendition = std::make_unique<Rendition>();
+    if (!rendition->sink.prepare(cfg, audioFormat)) {
+      Logger::error(k_logTag, "Rendition %zu prepare failed (%dx%d)", i, cfg.width, cfg.height);
+      return false;
+    }
+
+    // 가장 큰 해상도(픽셀 수 기준) rendition 을 master 로 지정
+    const auto& master = cfgs[m_masterIndex];
+    if ((int64_t)cfg.width * cfg.height > (int64_t)master.width * master.height) {
+      m_masterIndex = i;
+    }
+    m_renditions.push_back(std::move(rendition));
+  }
+  return true;
+};
+
+bool AndroidRenditionEncoder::encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) {
+  if (m_renditions.empty() || !m_pTimeline) return false;
+
+  // EGL/Skia 초기화는 AndroidEncoder 와 마찬가지로 반드시 인코딩 스레드에서 수행한다. (EGLContext 는 생성된 스레드에 묶임)
+  if (!m_graphicsInitialized && !initGraphics()) {
+    Logger::error(k_logTag, "Graphics init failed on encoding thread");
+    return false;
+  }
+
+  // 오디오 트랙을 먼저 준비 (drain 스레드 시작 전이라 sink 를 이 스레드만 사용. 실패하면 모든 rendition 을 비디오만 기록)
+  if (m_audioMixer && !primeAudio()) {
+    Logger::warn(k_logTag, "Audio track unavailable, exporting video only");
+    for (auto& r : m_renditions) {
+      r->sink.disableAudio();
+    }
+    m_audioMixer.reset();
+  }
+
+  // rendition 별 drain 스레드 시작 -> 렌더링과 병렬로 각 mp4 에 패킷 기록
+  startDrainThreads();
+
+  const double frameDur = 1.0 / (double)m_fps;
+  const double dur = std::max(0.0, m_durationSec);
+  const int totalFrames = std::max(1, (int)std::ceil(dur * m_fps));
+
+  bool ok = true;
+  bool cancelled = false;
+  for (int i = 0; i < totalFrames; i++)
+  {
+    if (cancelFlag.load() || m_drainFailed.load()) {
+      cancelled = cancelFlag.load();
+      break;
+    }
+
+    const double t = std::min(dur, i * frameDur);
+    if (i > 0 && m_keyframes.isKeyframe(i)) {
+      for (auto& r : m_renditions) {
+        r->sink.requestSyncFrame();
+      }
+    }
+    if (!renderOneFrame(t)) {
+      Logger::error(k_logTag, "renderOneFrame failed");
+      ok = false;
+      break;
+    }
+
+    // 이번 프레임이 끝나는 시각까지의 오디오를 넣음 (출력 패킷은 drain 스레드가 기록)
+    if (m_audioMixer && allMuxersStarted()) {
+      const int64_t untilUs = (int64_t)std::llround((i + 1) * frameDur * 1'000'000.0);
+      if (!feedAudio(untilUs)) {
+        Logger::error(k_logTag, "audio failed at frame %d", i);
+        ok = false;
+        break;
+      }
+    }
+
+    if (onProgress) {
+      onProgress(double(i + 1) / double(totalFrames));
+    }
+  }
+
+  // 모든 sink 에 EOS 를 알리고 drain 스레드가 남은 패킷을 모두 기록할 때까지 대기
+  for (auto& r : m_renditions) {
+    if (!r->sink.signalEndOfStream()) {
+      ok = false;
+    }
+  }
+  // 남은 오디오 블록을 모두 넣고 마지막 블록에 EOS (실패/취소된 경우 남은 구간은 인코딩하지 않고 EOS 만 보냄)
+  if (m_audioMixer && !((ok && !cancelled && !m_drainFailed.load()) ? feedAudio(-1) : endAudio())) {
+    Logger::error(k_logTag, "audio final feed failed");
+    ok = false;
+  }
+  if (!finishDrainThreads()) {
+    ok = false;
+  }
+
+  return ok && !m_drainFailed.load();
+};
+
+void AndroidRenditionEncoder::release() {
+  // drain 스레드가 남아있다면 먼저 정리
+  m_inputDone.store(true);
+  for (auto& r : m_renditions) {
+    if (r->drainThread.joinable()) {
+      r->drainThread.join();
+    }
+  }
+
+  destroyGraphics();
+
+  for (auto& r : m_renditions) {
+    r->sink.release();
+  }
+  m_renditions.clear();
+  m_keyframes = KeyframePlan();
+  m_durationSec = 0.0;
+  m_audioMixer.reset();
+  m_audioBlock.clear();
+};
+
+std::string AndroidRenditionEncoder::outputPath() const {
+  if (m_masterIndex >= m_renditions.size()) return std::string();
+  return m_renditions[m_masterIndex]->sink.config().outputPath;
+};
+
+std::vector<std::string> AndroidRenditionEncoder::outputPaths() const {
+  std::vector<std::string> paths;
+  paths.reserve(m_renditions.size());
+  for (const auto& r : m_renditions) {
+    paths.push_back(r->sink.config().outputPath);
+  }
+  return paths;
+};
+
+bool AndroidRenditionEncoder::initGraphics() {
+  Rendition& master = *m_renditions[m_masterIndex];
+  const EncoderConfig& masterCfg = master.sink.config();
+
+  // 1) master rendition 의 입력 Surface 로 EGLContext 생성 -> 나머지 rendition 은 같은 EGLContext 를 공유하는 EGLSurface 를 추가 생성
+  if (!m_egl.init(master.sink.inputWindow())) {
+    Logger::error(k_logTag, "EglContext::init failed");
+    return false;
+  }
+  master.eglSurface = m_egl.surface();
+  for (size_t i = 0; i < m_renditions.size(); i++) {
+    if (i == m_masterIndex) continue;
+    m_renditions[i]->eglSurface = m_egl.createWindowSurface(m_renditions[i]->sink.inputWindow());
+    if (m_renditions[i]->eglSurface == EGL_NO_SURFACE) return false;
+  }
+
+  // 2) GrDirectContext 생성 + 각 rendition EGLSurface 의 default framebuffer 를 감싸는 SkSurface 생성
+  if (!m_skia.setupSkiaSurface(masterCfg.width, masterCfg.height)) {
+    Logger::error(k_logTag, "SkiaGanesh::setupSkiaSurface failed");
+    return false;
+  }
+  for (auto& r : m_renditions) {
+    if (!m_egl.makeCurrent(r->eglSurface)) return false;
+    m_skia.directContext()->resetContext();
+    r->skSurface = m_skia.wrapWindowFramebuffer(r->sink.config().width, r->sink.config().height);
+    if (!r->skSurface) return false;
+  }
+
+  // 3) 프레임을 한 번만 렌더링할 master offscreen render target (축소 시 mipmap 샘플링 사용)
+  m_master = m_skia.makeRenderTarget(masterCfg.width, masterCfg.height, m_renditions.size() > 1);
+  if (!m_master) return false;
+
+  m_graphicsInitialized = true;
+  return true;
+};
+
+void AndroidRenditionEncoder::destroyGraphics() {
+  // GPU 자원을 먼저 해제한 뒤 EGLSurface/EGLContext 해제
+  m_master = nullptr;
+  for (auto& r : m_renditions) {
+    r->skSurface = nullptr;
+  }
+  m_skia.destroy();
+
+  for (size_t i = 0; i < m_renditions.size(); i++) {
+    // master 의 EGLSurface 는 EglContext::destroy() 에서 해제됨
+    if (i != m_masterIndex) {
+      m_egl.destroySurface(m_renditions[i]->eglSurface);
+    }
+    m_renditions[i]->eglSurface = EGL_NO_SURFACE;
+  }
+  m_egl.destroy();
+  m_graphicsInitialized = false;
+};
+
+bool AndroidRenditionEncoder::renderOneFrame(double tSec) {
+  TRACE_SCOPE("export", "render");
+
+  // 1) master offscreen render target 에 Timeline 을 원본 해상도로 한 번만 렌더링
+  Rendition& masterRendition = *m_renditions[m_masterIndex];
+  if (!m_egl.makeCurrent(masterRendition.eglSurface)) {
+    Logger::error(k_logTag, "EglContext::makeCurrent failed");
+    return false;
+  }
+  m_skia.directContext()->resetContext();
+
+  SkCanvas* masterCanvas = m_master->getCanvas();
+  RenderContext ctx{ masterCanvas, m_master->width(), m_master->height(), tSec };
+  ctx.quality = RenderQuality::Export;
+  m_pTimeline->render(ctx);
+  sk_sp<SkImage> frame = m_master->makeImageSnapshot();
+  if (!frame) return false;
+
+  // 2) 모든 rendition 의 입력 Surface 에 같은 프레임을 크기에 맞게 축소해서 그린 뒤 PTS 를 붙여 Codec 으로 제출
+  const int64_t ptsNs = (int64_t)std::llround(tSec * 1'000'000'000.0);
+  for (auto& r : m_renditions) {
+    if (!m_egl.makeCurrent(r->eglSurface)) {
+      Logger::error(k_logTag, "EglContext::makeCurrent failed");
+      return false;
+    }
+    // EGLSurface 가 바뀌면 default framebuffer 가 가리키는 대상도 바뀌므로 Skia 가 캐시한 GL 상태를 초기화
+    m_skia.directContext()->resetContext();
+
+    const SkRect dst = SkRect::MakeIWH(r->skSurface->width(), r->skSurface->height());
+    const bool sameSize = r->skSurface->width() == frame->width() && r->skSurface->height() == frame->height();
+    const SkSamplingOptions sampling = sameSize ? SkSamplingOptions()
+                                                : SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kLinear);
+    r->skSurface->getCanvas()->drawImageRect(frame, dst, sampling);
+    m_skia.flush();
+
+    m_egl.setPresentationTimeNs(r->eglSurface, ptsNs);
+    if (!m_egl.swapBuffer(r->eglSurface)) {
+      Logger::error(k_logTag, "EglContext::swapBuffer failed");
+      return false;
+    }
+  }
+  return true;
+};
+
+void AndroidRenditionEncoder::startDrainThreads() {
+  m_inputDone.store(false);
+  m_drainFailed.store(false);
+
+  for (auto& r : m_renditions) {
+    AndroidCodecSink* sink = &r->sink;
+    r->drainThread = std::thread([this, sink]() {
+      TRACE_THREAD_NAME("RenditionDrain");
+      // 입력이 끝날 때까지 출력 패킷이 생기는 대로 계속 기록 (drain(false) 는 패킷이 없으면 최대 10ms 대기 후 반환)
+      // 오디오 패킷은 Muxer 가 시작된 뒤부터 기록 (그 전에 꺼내면 기록하지 못하고 버려짐)
+      while (!m_inputDone.load()) {
+        if (!sink->drain(false)) {
+          m_drainFailed.store(true);
+          return;
+        }
+        if (sink->hasAudio() && sink->muxerStarted() && !sink->drainAudio(false)) {
+          m_drainFailed.store(true);
+          return;
+        }
+      }
+      // EOS 이후 남은 패킷을 모두 기록
+      if (!sink->drain(true) || (sink->hasAudio() && !sink->drainAudio(true))) {
+        m_drainFailed.store(true);
+      }
+    });
+  }
+};
+
+bool AndroidRenditionEncoder::finishDrainThreads() {
+  m_inputDone.store(true);
+  for (auto& r : m_renditions) {
+    if (r->drainThread.joinable()) {
+      r->drainThread.join();
+    }
+  }
+  return !m_drainFailed.load();
+};
+
+bool AndroidRenditionEncoder::primeAudio() {
+  TRACE_SCOPE("export", "primeAudio");
+  if (m_audioMixer->finished()) return false;
+
+  // 첫 블록을 모든 rendition 에 넣고 각 AAC Codec 이 출력 포맷을 알려줄 때까지 기다림 (포맷이 나오면 오디오 트랙이 Muxer 에 추가됨)
+  const int64_t ptsUs = m_audioMixer->nextPtsUs();
+  const int frames = m_audioMixer->mixNext(m_audioBlock.data());
+  for (auto& r : m_renditions) {
+    AndroidCodecSink& sink = r->sink;
+    if (!sink.queueAudio(m_audioBlock.data(), frames, ptsUs, m_audioMixer->finished())) return false;
+    for (int attempt = 0; attempt < k_audioPrimeAttempts && !sink.audioTrackReady(); attempt++) {
+      if (!sink.drainAudio(false)) return false;
+    }
+    if (!sink.audioTrackReady()) return false;
+  }
+  return true;
+};
+
+bool AndroidRenditionEncoder::feedAudio(int64_t untilUs) {
+  TRACE_SCOPE("export", "audio");
+  while (!m_audioMixer->finished() && (untilUs < 0 || m_audioMixer->nextPtsUs() < untilUs)) {
+    const int64_t ptsUs = m_audioMixer->nextPtsUs();
+    const int frames = m_audioMixer->mixNext(m_audioBlock.data());
+    for (auto& r : m_renditions) {
+      // drain 스레드가 출력을 꺼내므로 입력 버퍼가 찰 때는 기다리기만 함 (sink 를 두 스레드에서 drain 하지 않도록)
+      if (!r->sink.queueAudio(m_audioBlock.data(), frames, ptsUs, m_audioMixer->finished(), false)) return false;
+    }
+  }
+  return true;
+};
+
+bool AndroidRenditionEncoder::endAudio() {
+  if (m_audioMixer->finished()) return true;
+  const int64_t ptsUs = m_audioMixer->nextPtsUs();
+  bool ok = true;
+  for (auto& r : m_renditions) {
+    if (!r->sink.queueAudio(m_audioBlock.data(), 0, ptsUs, true, false)) ok = false;
+  }
+  return ok;
+};
+
+bool AndroidRenditionEncoder::allMuxersStarted() const {
+  for (const auto& r : m_renditions) {
+    if (!r->sink.muxerStarted()) return false;
+  }
+  return true;
+};
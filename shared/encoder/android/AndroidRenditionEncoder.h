@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include "./AndroidCodecSink.h"            // AMediaCodec + AMediaMuxer (코덱/mp4 저장)
+#include "../IEncoder.h"                   // 공용 인터페이스
+#include "../EncoderConfig.h"              // 공용 config
+#include "../../render/EglContext.h"       // Encoder 전용 EGL 컨텍스트
+#include "../../render/SkiaGanesh.h"       // Encoder 전용 Skia wrapper
+#include "../../video/Timeline.h"          // 인코딩할 타임라인
+#include "../KeyframePlan.h"               // 클립 경계 기반 키프레임 배치
+#include "../../audio/AudioMixer.h"        // 오디오 클립 믹싱
+
+/**
+ * 한 번의 렌더링 패스로 여러 해상도(rendition)의 mp4 를 동시에 만드는 인코더
+ *
+ * - 매 프레임 Timeline 을 "가장 큰 해상도"의 offscreen GPU render target 에 한 번만 렌더링하고,
+ *   그 결과(snapshot)를 각 rendition 의 인코더 입력 Surface 크기로 축소해 나눠 그린다(fan-out).
+ * - 모든 rendition 의 EGLSurface 는 하나의 EGLContext/GrDirectContext 를 공유하므로 snapshot 텍스처를 복사 없이 재사용한다.
+ * - 각 rendition 의 Codec 출력 패킷은 rendition 별 drain 스레드가 병렬로 꺼내 각자의 mp4 에 기록한다.
+ *   -> 전체 비용은 "export 1회 + 축소 draw" 에 가깝다.
+ * - Timeline 에 오디오 클립이 있으면 PCM 블록을 한 번만 믹싱해 모든 rendition 의 AAC Codec 에 넣는다.
+ *   (오디오 출력 패킷도 rendition 별 drain 스레드가 기록하므로 Muxer 는 항상 한 스레드에서만 쓰임)
+ */
+class AndroidRenditionEncoder : public IEncoder {
+public:
+  AndroidRenditionEncoder() = default;
+  ~AndroidRenditionEncoder() override;
+
+public:
+  // 인코딩에 사용할 타임라인 설정(프리뷰와 동일한 렌더 경로 재사용)
+  void setTimeline(std::shared_ptr<Timeline> tl) override;
+  // rendition 1개짜리로 준비 (IEncoder 호환용)
+  bool prepare(const EncoderConfig& cfg) override;
+  // 여러 rendition 준비 (rendition 별 Codec/Surface/Muxer 생성). fps 는 첫 번째 설정값을 공통으로 사용
+  bool prepareRenditions(const std::vector<EncoderConfig>& cfgs);
+  // 실제 인코딩(모든 프레임 처리). 호출한 스레드는 이 함수가 끝날 때까지 기다린다.
+  bool encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) override;
+  // 내부 자원 정리(Codec/Surface/EGL/Skia/Muxer 등)
+  void release() override;
+  // 가장 큰 해상도 rendition 의 출력 파일 경로 반환
+  std::string outputPath() const override;
+  // 모든 rendition 의 출력 파일 경로 반환 (prepareRenditions 에 전달한 순서)
+  std::vector<std::string> outputPaths() const override;
+
+private:
+  // rendition 하나에 해당하는 인코딩 출력 단위
+  struct Rendition
+  {
+    AndroidCodecSink sink;                      // Codec + 입력 Surface + Muxer
+    EGLSurface eglSurface = EGL_NO_SURFACE;     // sink 입력 Surface 에 연결된 EGLSurface (공유 EGLContext 사용)
+    sk_sp<SkSurface> skSurface;                 // eglSurface 의 default framebuffer 를 감싼 SkSurface
+    std::thread drainThread;                    // sink 출력 패킷을 mp4 에 기록하는 스레드
+  };
+
+  // 인코딩 스레드에서 EGL/Skia 및 rendition 별 surface 준비
+  bool initGraphics();
+  void destroyGraphics();
+
+  // 주어진 시간값(tSec)의 프레임을 master 에 한 번 렌더링한 뒤 모든 rendition 에 축소해서 그림
+  bool renderOneFrame(double tSec);
+
+  // rendition 별 drain 스레드 시작/종료
+  void startDrainThreads();
+  bool finishDrainThreads();
+
+  // 오디오: 모든 rendition 에 첫 블록을 넣어 오디오 트랙을 Muxer 에 추가 (drain 스레드 시작 전, 인코딩 스레드에서 호출)
+  bool primeAudio();
+  // 타임라인 시간 untilUs 까지의 오디오 블록을 한 번 믹싱해 모든 rendition 에 넣기 (untilUs < 0 이면 끝까지 + EOS)
+  bool feedAudio(int64_t untilUs);
+  // 취소 시 남은 오디오는 믹싱하지 않고 모든 rendition 에 빈 EOS 블록만 넣음
+  bool endAudio();
+  // 모든 rendition 의 Muxer 가 시작되었는지 (오디오 패킷은 Muxer 시작 후에만 기록 가능)
+  bool allMuxersStarted() const;
+
+private:
+  std::shared_ptr<Timeline> m_pTimeline;                // 인코딩에 사용할 타임라인(프리뷰와 동일한 그림을 그리기 위함)
+  std::vector<std::unique_ptr<Rendition>> m_renditions; // rendition 목록
+  size_t m_masterIndex = 0;                             // 가장 큰 해상도 rendition 의 인덱스
+  int m_fps = 30;                                       // 공통 프레임레이트
+  KeyframePlan m_keyframes;                             // 모든 rendition 이 공통으로 쓰는 키프레임 계획 (같은 프레임에서 키프레임 -> rendition 간 전환 지점 정렬)
+
+  EglContext m_egl;                                     // 모든 rendition 이 공유하는 EGL 컨텍스트
+  SkiaGanesh m_skia;                                    // 모든 rendition 이 공유하는 GrDirectContext
+  sk_sp<SkSurface> m_master;                            // 가장 큰 해상도로 한 번 렌더링하는 offscreen render target
+  bool m_graphicsInitialized = false;                   // EGL/Skia 초기화 여부 플래그
+
+  std::atomic<bool> m_inputDone = false;                // 모든 sink 에 EOS 를 보냈는지 여부 (drain 스레드 종료 신호)
+  std::atomic<bool> m_drainFailed = false;              // drain 스레드 중 하나라도 실패했는지 여부
+
+  double m_durationSec = 0.0;                           // 타임라인 총 길이(초) 캐시(프레임 수 계산용)
+
+  std::unique_ptr<AudioMixer> m_audioMixer;             // 오디오 믹서 (오디오 클립이 없으면 nullptr, 인코딩 스레드에서만 접근)
+  std::vector<int16_t> m_audioBlock;                    // 믹싱된 PCM 블록 버퍼
+
+private:
+  static constexpr int k_audioPrimeAttempts = 100;      // 오디오 트랙 포맷을 기다리는 최대 횟수 (drainAudio 1회 = 최대 10ms)
+  static constexpr const char* k_logTag = "AndroidRenditionEncoder";
+};
@@ -0,0 +1,198 @@
+#include "./CpuEncoder.h"
+#include "../../logger/Logger.h"
+#include "../../trace/Trace.h"
+#include "../../video/ColorManagedDecoder.h"
+#include <core/SkCanvas.h>
+#include <core/SkPixmap.h>
+#include <utility>      // std::move 사용을 위해
+#include <cmath>        // 수학 함수 (ceil)
+#include <algorithm>    // std::min, std::max
+
+CpuEncoder::~CpuEncoder() {
+  release(); // 소멸자에서 안전하게 자원 해제
+};
+
+void CpuEncoder::setTimeline(std::shared_ptr<Timeline> tl) {
+  m_pTimeline = std::move(tl);
+  m_durationSec = (m_pTimeline ? m_pTimeline->totalDuration() : 0.0);
+};
+
+bool CpuEncoder::prepare(const EncoderConfig& cfg) {
+  m_encoderConfig = cfg;
+
+  if (!m_pTimeline) {
+    Logger::error(k_logTag, "Timeline not set");
+    return false;
+  }
+  if (cfg.width <= 0 || cfg.height <= 0 || cfg.outputPath.empty()) {
+    Logger::error(k_logTag, "Invalid config (%dx%d, path=%s)", cfg.width, cfg.height, cfg.outputPath.c_str());
+    return false;
+  }
+
+  // 1) CPU raster 렌더링 대상 생성 (RGBA 순서로 고정해 YUV 변환 시 채널 위치를 단순화)
+  //    (디코딩된 이미지와 같은 출력 색공간/형식 -> draw 시 색 변환 없음)
+  const SkImageInfo info = ColorManagedDecoder::outputInfo(cfg.width, cfg.height);
+  m_surface = SkSurfaces::Raster(info);
+  if (!m_surface) {
+    Logger::error(k_logTag, "SkSurfaces::Raster failed (%dx%d)", cfg.width, cfg.height);
+    return false;
+  }
+
+  // 2) I420 변환 버퍼 (chroma plane 은 가로/세로 절반, 홀수 크기는 올림)
+  const size_t chromaW = (size_t)(cfg.width + 1) / 2;
+  const size_t chromaH = (size_t)(cfg.height + 1) / 2;
+  m_yuv.resize((size_t)cfg.width * cfg.height + 2 * chromaW * chromaH);
+
+  // 3) 출력 파일 오픈 + y4m 스트림 헤더 기록
+  m_file = std::fopen(cfg.outputPath.c_str(), "wb");
+  if (!m_file) {
+    Logger::error(k_logTag, "Cannot open output: %s", cfg.outputPath.c_str());
+    return false;
+  }
+  std::setvbuf(m_file, nullptr, _IOFBF, k_fileBufferBytes);
+  std::fprintf(m_file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", cfg.width, cfg.height, std::max(1, cfg.fps));
+
+  // 4) 오디오 클립이 있으면 믹서 + 같은 이름의 .wav 출력 준비
+  m_audioMixer = std::make_unique<AudioMixer>(m_pTimeline->audioClips(), m_durationSec);
+  if (!m_audioMixer->hasAudio()) {
+    m_audioMixer.reset();
+    return true;
+  }
+  const size_t dot = cfg.outputPath.find_last_of('.');
+  const size_t slash = cfg.outputPath.find_last_of('/');
+  m_audioPath = (dot != std::string::npos && (slash == std::string::npos || dot > slash) ? cfg.outputPath.substr(0, dot) : cfg.outputPath) + ".wav";
+  m_audioBlock.resize((size_t)AudioMixer::k_blockFrames * m_audioMixer->format().channels);
+  return m_audioWriter.open(m_audioPath, m_audioMixer->format());
+};
+
+bool CpuEncoder::encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) {
+  if (!m_surface || !m_file || !m_pTimeline) return false;
+
+  // FPS, 한 프레임 길이, 전체 길이, 총 프레임 수 계산 (AndroidEncoder 와 동일한 프레임 시간 규칙)
+  const int fps = std::max(1, m_encoderConfig.fps);
+  const double frameDur = 1.0 / (double)fps;
+  const double dur = std::max(0.0, m_durationSec);
+  const int totalFrames = std::max(1, (int)std::ceil(dur * fps));
+
+  for (int i = 0; i < totalFrames; i++)
+  {
+    TRACE_SCOPE_ARG("export", "frame", "index", i);
+
+    if (cancelFlag.load()) {
+      break;
+    }
+
+    const double t = std::min(dur, i * frameDur);
+    if (!renderOneFrame(t) || !writeFrame()) {
+      Logger::error(k_logTag, "Frame %d failed", i);
+      return false;
+    }
+    if (m_audioMixer && !writeAudioUntil((i + 1) * frameDur)) {
+      Logger::error(k_logTag, "Audio for frame %d failed", i);
+      return false;
+    }
+
+    if (onProgress) {
+      onProgress(double(i + 1) / double(totalFrames));
+    }
+  }
+
+  // 버퍼에 남은 데이터를 파일에 기록 (오디오는 헤더 크기 필드까지 채워서 닫음)
+  const bool audioOk = !m_audioMixer || m_audioWriter.close();
+  return std::fflush(m_file) == 0 && audioOk;
+};
+
+void CpuEncoder::release() {
+  if (m_file) {
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+  m_audioWriter.close();
+  m_audioMixer.reset();
+  m_surface = nullptr;
+  m_yuv.clear();
+  m_yuv.shrink_to_fit();
+  m_audioBlock.clear();
+  m_audioBlock.shrink_to_fit();
+};
+
+std::string CpuEncoder::outputPath() const {
+  return m_encoderConfig.outputPath;
+};
+
+std::vector<std::string> CpuEncoder::outputPaths() const {
+  if (m_audioPath.empty()) return { outputPath() };
+  return { outputPath(), m_audioPath };
+};
+
+bool CpuEncoder::writeAudioUntil(double untilSec) {
+  TRACE_SCOPE("export", "audio");
+  const int64_t untilUs = (int64_t)(untilSec * 1'000'000.0);
+  while (!m_audioMixer->finished() && m_audioMixer->nextPtsUs() < untilUs) {
+    const int frames = m_audioMixer->mixNext(m_audioBlock.data());
+    if (!m_audioWriter.write(m_audioBlock.data(), frames)) return false;
+  }
+  return true;
+};
+
+bool CpuEncoder::renderOneFrame(double tSec) {
+  TRACE_SCOPE("export", "render");
+
+  // 클립이 덮지 않는 영역(위/아래 여백)은 Timeline::render 가 검은색으로 초기화 (화면을 완전히 덮으면 생략)
+  SkCanvas* canvas = m_surface->getCanvas();
+
+  RenderContext ctx{ canvas, m_encoderConfig.width, m_encoderConfig.height, tSec };
+  ctx.quality = RenderQuality::Export; // 인코딩 결과물은 항상 원본 해상도 기준으로 렌더링
+  m_pTimeline->render(ctx);
+  return true;
+};
+
+bool CpuEncoder::writeFrame() {
+  TRACE_SCOPE("export", "convertAndWrite");
+
+  SkPixmap rgba;
+  if (!m_surface->peekPixels(&rgba)) return false;
+
+  const int w = rgba.width();
+  const int h = rgba.height();
+  const int chromaW = (w + 1) / 2;
+  const int chromaH = (h + 1) / 2;
+  uint8_t* yPlane = m_yuv.data();
+  uint8_t* uPlane = yPlane + (size_t)w * h;
+  uint8_t* vPlane = uPlane + (size_t)chromaW * chromaH;
+
+  /**
+   * RGBA -> I420 (BT.601 limited range, 8bit 고정소수점)
+   * - 불투명 프레임(검은 배경 위 렌더링)이므로 premul 을 되돌릴 필요 없음
+   * - chroma 는 2x2 픽셀 평균을 한 번만 변환 (가장자리 홀수 픽셀은 존재하는 픽셀만 평균)
+   */
+  for (int y = 0; y < h; y++) {
+    const uint8_t* row = static_cast<const uint8_t*>(rgba.addr(0, y));
+    uint8_t* yRow = yPlane + (size_t)y * w;
+    for (int x = 0; x < w; x++) {
+      const int r = row[4 * x + 0];
+      const int g = row[4 * x + 1];
+      const int b = row[4 * x + 2];
+      yRow[x] = (uint8_t)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+    }
+  }
+  for (int cy = 0; cy < chromaH; cy++) {
+    const int y0 = cy * 2;
+    const int y1 = std::min(y0 + 1, h - 1);
+    const uint8_t* row0 = static_cast<const uint8_t*>(rgba.addr(0, y0));
+    const uint8_t* row1 = static_cast<const uint8_t*>(rgba.addr(0, y1));
+    for (int cx = 0; cx < chromaW; cx++) {
+      const int x0 = cx * 2;
+      const int x1 = std::min(x0 + 1, w - 1);
+      const int r = (row0[4 * x0 + 0] + row0[4 * x1 + 0] + row1[4 * x0 + 0] + row1[4 * x1 + 0] + 2) >> 2;
+      const int g = (row0[4 * x0 + 1] + row0[4 * x1 + 1] + row1[4 * x0 + 1] + row1[4 * x1 + 1] + 2) >> 2;
+      const int b = (row0[4 * x0 + 2] + row0[4 * x1 + 2] + row1[4 * x0 + 2] + row1[4 * x1 + 2] + 2) >> 2;
+      uPlane[(size_t)cy * chromaW + cx] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+      vPlane[(size_t)cy * chromaW + cx] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+  }
+
+  // y4m 프레임 = "FRAME\n" + Y + U + V
+  std::fputs("FRAME\n", m_file);
+  return std::fwrite(m_yuv.data(), 1, m_yuv.size(), m_file) == m_yuv.size();
+};
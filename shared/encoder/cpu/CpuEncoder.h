@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <core/SkSurface.h>
+#include "../IEncoder.h"                   // 공용 인터페이스
+#include "../EncoderConfig.h"              // 공용 config
+#include "../../video/Timeline.h"          // 인코딩할 타임라인
+#include "../../audio/AudioMixer.h"        // 오디오 클립 믹싱
+#include "../../audio/WavWriter.h"         // 믹싱 결과 기록
+
+/**
+ * GPU/하드웨어 Codec 없이 CPU(Skia raster 백엔드)만으로 Timeline 을 렌더링하는 인코더 (Linux 서버 배치 렌더링용)
+ *
+ * - 매 프레임 Timeline 을 raster SkSurface 에 렌더링한 뒤 RGBA -> YUV 4:2:0(BT.601 limited range)으로 변환해
+ *   YUV4MPEG2(.y4m) 비압축 스트림으로 기록한다. (EncoderConfig::mime / bitrate 는 사용하지 않음)
+ * - .y4m 은 ffmpeg 등 대부분의 도구가 바로 입력으로 받으므로, 서버에서는 이 결과를 원하는 코덱으로 후처리한다.
+ * - Timeline 에 오디오 클립이 있으면 AudioMixer 로 블록 단위 믹싱한 결과를 같은 이름의 .wav 파일로 함께 기록한다.
+ *   (프레임마다 해당 프레임 끝 시각까지의 오디오만 믹싱하므로 영상/오디오 진행이 맞춰지고, 메모리 사용량은 오디오 길이와 무관)
+ * - 플랫폼 API(EGL/MediaCodec)에 의존하지 않으므로 여러 인스턴스를 서로 다른 스레드에서 동시에 실행할 수 있다.
+ */
+class CpuEncoder : public IEncoder {
+public:
+  CpuEncoder() = default;
+  ~CpuEncoder() override;
+
+public:
+  // 인코딩에 사용할 타임라인 설정(프리뷰와 동일한 렌더 경로 재사용)
+  void setTimeline(std::shared_ptr<Timeline> tl) override;
+  // 인코더 준비(raster surface 생성 + 출력 파일 오픈 + y4m 헤더 기록)
+  bool prepare(const EncoderConfig& cfg) override;
+  // 실제 인코딩(모든 프레임 처리). 호출한 스레드는 이 함수가 끝날 때까지 기다린다.
+  bool encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) override;
+  // 내부 자원 정리(surface/출력 파일)
+  void release() override;
+  // 최종 출력 파일 경로 반환
+  std::string outputPath() const override;
+  // 출력 파일 경로 목록 (오디오가 있으면 .wav 포함)
+  std::vector<std::string> outputPaths() const override;
+
+private:
+  // 주어진 시간값(tSec)의 프레임을 raster surface 에 렌더링
+  bool renderOneFrame(double tSec);
+  // 렌더링된 RGBA 픽셀을 I420 으로 변환해 y4m 프레임으로 기록
+  bool writeFrame();
+  // 타임라인 시간 untilSec 까지의 오디오 블록을 믹싱해 .wav 에 기록
+  bool writeAudioUntil(double untilSec);
+
+private:
+  std::shared_ptr<Timeline> m_pTimeline;        // 인코딩에 사용할 타임라인
+  EncoderConfig m_encoderConfig;                // 인코딩 설정(해상도/FPS/출력 경로)
+  sk_sp<SkSurface> m_surface;                   // CPU raster 렌더링 대상 (RGBA_8888)
+  std::vector<uint8_t> m_yuv;                   // I420 변환 버퍼 (Y plane + U plane + V plane)
+  std::FILE* m_file = nullptr;                  // 출력 .y4m 파일
+  double m_durationSec = 0.0;                   // 타임라인 총 길이(초) 캐시(프레임 수 계산용)
+  std::unique_ptr<AudioMixer> m_audioMixer;     // 오디오 믹서 (오디오 클립이 없으면 nullptr)
+  WavWriter m_audioWriter;                      // 출력 .wav 파일
+  std::string m_audioPath;                      // 출력 .wav 경로
+  std::vector<int16_t> m_audioBlock;            // 믹싱된 PCM 블록 버퍼
+
+private:
+  static constexpr size_t k_fileBufferBytes = 1 << 20;  // 출력 파일 stdio 버퍼 크기(1MB)
+  static constexpr const char* k_logTag = "CpuEncoder";
+};
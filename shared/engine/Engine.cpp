@@ -1,10 +1,11 @@
 #include "Engine.h"
 #include "../drawables/RotatingRect.h"
 #include "../logger/Logger.h"
+#include "../trace/Trace.h"
 #include <android/native_window_jni.h> // ANativeWindow_fromSurface, ANativeWindow_release
-#include <algorithm> // std::clamp
 #if defined (__ANDROID__)
   #include "../encoder/android/AndroidEncoder.h"
+  #include "../encoder/android/AndroidRenditionEncoder.h"
 #elif defined (__APPLE__)
   #include <TargetConditionals.h>
   #if TARGET_OS_IOS
@@ -17,6 +18,44 @@ Engine& Engine::instance() {
   return instance;
 }
 
+Engine::Engine()
+  : m_renderer(std::make_shared<Renderer>()),
+    m_previewController(std::make_shared<PreviewController>(m_renderer)),
+    m_core(&Engine::createEncoder) {
+  // Preview 쪽 메모리(디코딩 캐시, Timeline 이미지, 화면/GPU 리소스)도 엔진 코어의 메모리 예산에서 함께 집계/회수
+  m_renderer->attachMemoryBudget(m_core.memoryBudget());
+
+  // 각 스레드(export 작업/렌더링/import)의 상태 변경을 이벤트로 변환해 적재 (sink 가 없으면 EventThrottle 이 버림)
+  m_core.setExportListener([this](int jobId, ExportJobStatus status, double progress, const std::vector<std::string>& outputPaths) {
+    EngineEvent event;
+    event.jobId = jobId;
+    event.value = progress;
+    switch (status) {
+      case ExportJobStatus::Completed:
+        event.type = EngineEventType::ExportCompleted;
+        event.outputPaths = outputPaths;
+        break;
+      case ExportJobStatus::Failed:    event.type = EngineEventType::ExportFailed; break;
+      case ExportJobStatus::Cancelled: event.type = EngineEventType::ExportCancelled; break;
+      default:                         event.type = EngineEventType::ExportProgress; break;
+    }
+    m_events.post(std::move(event));
+  });
+  m_renderer->setTimeListener([this](double tSec) {
+    EngineEvent event;
+    event.type = EngineEventType::PreviewTime;
+    event.value = tSec;
+    m_events.post(std::move(event));
+  });
+  m_previewController->setImportProgressListener([this](int done, int total) {
+    EngineEvent event;
+    event.type = EngineEventType::ImportProgress;
+    event.done = done;
+    event.total = total;
+    m_events.post(std::move(event));
+  });
+};
+
 void Engine::initSurface(ANativeWindow *window)
 {
   if (!window) return;
@@ -29,16 +68,6 @@ void Engine::initSurface(ANativeWindow *window)
     return;
   }
 
-  // renderer nullptr check
-  if (!m_renderer) {
-    m_renderer = std::make_shared<Renderer>();
-  }
-
-  // preview controller nullptr check
-  if (!m_previewController) {
-    m_previewController = std::make_shared<PreviewController>(m_renderer);
-  }
-
   /** drawable 객체 생성 및 추가 */
   // 회전 사각형 생성
   auto pRect = std::make_shared<RotatingRect>();
@@ -56,189 +85,268 @@ void Engine::initSurface(ANativeWindow *window)
 
 void Engine::changeSurface(int width, int height)
 {
-  std::lock_guard<std::mutex> lock(m_mtx);
-  if (m_rendererStarted && m_renderer) {
-    m_renderer->resize(width, height);
-  }
+  // 크기 변경은 Renderer 명령 큐에 적재되어 렌더링 스레드의 다음 프레임 시작 시점에 반영됨
+  m_renderer->resize(width, height);
 };
 
 void Engine::destroySurface()
 {
   std::lock_guard<std::mutex> lock(m_mtx);
   if (!m_rendererStarted) return; // 초기화도 안된 상태에서 메모리 해제 시도 방지
-  if (m_renderer) {
-    m_renderer->clearDrawables();
-    m_renderer->stop();
-  }
+  m_renderer->clearDrawables();
+  m_renderer->stop();
   m_rendererStarted = false;
 };
 
 void Engine::setImageSequence(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec)
 {
-  std::lock_guard<std::mutex> lock(m_mtx);
-  if (!m_renderer) {
-    m_renderer = std::make_shared<Renderer>();
-  }
-
-  // preview controller nullptr check
-  if (!m_previewController) {
-    m_previewController = std::make_shared<PreviewController>(m_renderer);
+  // 이미지 로드/Timeline 생성은 호출한 스레드에서 잠금 없이 수행하고,
+  // 완성된 Timeline 은 Renderer 명령 큐를 통해 다음 프레임 시작 시점에 교체된다.
+  if (m_previewController->setImageSequence(paths, clipDurSec, xfadeSec)) {
+    m_lastTimelineDurationSec = m_previewController->durationSec();
   }
+  m_core.memoryBudget()->enforceBudget();
+};
 
-  if (m_previewController) {
-    if (m_previewController->setImageSequence(paths, clipDurSec, xfadeSec)) {
-      m_lastTimelineDurationSec = m_previewController->durationSec();
+void Engine::setTransitions(const std::vector<std::string>& names)
+{
+  std::vector<TransitionType> transitions;
+  transitions.reserve(names.size());
+  for (const auto& name : names) {
+    TransitionType type = TransitionType::Crossfade;
+    if (!Transition::fromName(name, type)) {
+      Logger::warn(k_logTag, "Unknown transition '%s', using crossfade", name.c_str());
     }
+    transitions.push_back(type);
   }
+  m_previewController->setTransitions(std::move(transitions));
+};
+
+void Engine::setKenBurnsEnabled(bool enabled)
+{
+  m_previewController->setKenBurnsEnabled(enabled);
+};
+
+void Engine::setBackgroundMusic(const std::string& path, double gain)
+{
+  m_previewController->setBackgroundMusic(path, (float)gain);
+};
+
+bool Engine::saveProject(const std::string& path)
+{
+  return m_previewController->saveProject(path);
+};
+
+bool Engine::loadProject(const std::string& path)
+{
+  if (!m_previewController->loadProject(path)) return false;
+  m_lastTimelineDurationSec = m_previewController->durationSec();
+  m_core.memoryBudget()->enforceBudget();
+  return true;
+};
+
+bool Engine::insertClip(int index, const std::string& path)
+{
+  return onTimelineEdited(m_previewController->insertClip(index, path));
+};
+
+bool Engine::removeClip(int index)
+{
+  return onTimelineEdited(m_previewController->removeClip(index));
+};
+
+bool Engine::moveClip(int from, int to)
+{
+  return onTimelineEdited(m_previewController->moveClip(from, to));
+};
+
+bool Engine::retimeClip(int index, double durationSec, double xfadeSec)
+{
+  return onTimelineEdited(m_previewController->retimeClip(index, durationSec, xfadeSec));
+};
+
+bool Engine::replaceClip(int index, const std::string& path)
+{
+  return onTimelineEdited(m_previewController->replaceClip(index, path));
+};
+
+int Engine::clipCount() const
+{
+  return m_previewController->clipCount();
+};
+
+bool Engine::onTimelineEdited(bool edited)
+{
+  if (!edited) return false;
+  m_lastTimelineDurationSec = m_previewController->durationSec();
+  // insert/replace 로 새 이미지가 추가됐을 수 있으므로 메모리 예산 확인
+  m_core.memoryBudget()->enforceBudget();
+  return true;
 };
 
 void Engine::previewPlay()
 {
-  std::lock_guard<std::mutex> lock(m_mtx);
-  if (m_previewController)
-  {
-    m_previewController->previewPlay();
-  }
+  m_previewController->previewPlay();
 };
 
 void Engine::previewPause()
 {
-  std::lock_guard<std::mutex> lock(m_mtx);
-  if (m_previewController)
-  {
-    m_previewController->previewPause();
-  }
+  m_previewController->previewPause();
 };
 
 void Engine::previewStop()
 {
-  std::lock_guard<std::mutex> lock(m_mtx);
-  if (m_previewController)
-  {
-    m_previewController->previewStop();
-  }
+  m_previewController->previewStop();
+};
+
+void Engine::previewSeek(double tSec)
+{
+  m_previewController->previewSeek(tSec);
 };
 
 void Engine::startEncoding(const EncoderConfig& config) {
-  // 이미 인코딩 중일때는 중복 시작 방지
-  if (m_isEncoding.load()) {
-    Logger::warn(k_logTag, "Encoding is already in progress.");
-    return;
+  // 단일 해상도 인코딩도 export 작업 관리자를 통해 실행 (가장 최근 작업 ID 를 기존 조회 API 용으로 기억)
+  const int jobId = submitExportJob({ config }, 0);
+  if (jobId >= 0) {
+    m_lastJobId.store(jobId);
+  }
+};
+
+void Engine::startEncodingRenditions(const std::vector<EncoderConfig>& configs) {
+  const int jobId = submitExportJob(configs, 0);
+  if (jobId >= 0) {
+    m_lastJobId.store(jobId);
+  }
+};
+
+void Engine::cancelEncoding() {
+  // 가장 최근 작업에 취소 요청만 보내고 즉시 반환 (정리는 작업 스레드에서 백그라운드로 진행)
+  const int jobId = m_lastJobId.load();
+  if (jobId < 0) return;
+  m_core.cancelExportJob(jobId);
+};
+
+bool Engine::isEncoding() const {
+  const ExportJobStatus st = m_core.getExportJobStatus(m_lastJobId.load());
+  return st == ExportJobStatus::Queued || st == ExportJobStatus::Running;
+};
+
+std::string Engine::getLastEncodedPath() const {
+  const int jobId = m_lastJobId.load();
+  if (m_core.getExportJobStatus(jobId) != ExportJobStatus::Completed) return std::string();
+  std::vector<std::string> paths = m_core.getExportJobOutputPaths(jobId);
+  return paths.empty() ? std::string() : paths.front();
+};
+
+double Engine::getEncodingProgress() const {
+  return m_core.getExportJobProgress(m_lastJobId.load());
+};
+
+int Engine::submitExportJob(const std::vector<EncoderConfig>& configs, int priority) {
+  if (configs.empty()) {
+    Logger::error(k_logTag, "No encoder configs for export job.");
+    return -1;
   }
 
   // Renderer 가 들고 있는 Timeline 스냅샷 획득
   // (Renderer 가 hosting 하고 있는 동일한 Timeline 을 공유하여 인코딩에 사용하기 위한 목적)
-  std::shared_ptr<Timeline> timeline;
-  {
-    std::lock_guard<std::mutex> lock(m_mtx);
-    if (!m_renderer) {
-      Logger::error(k_logTag, "Renderer is not initialized. Cannot start encoding.");
-      return;
-    }
-    timeline = m_renderer->timelineSnapshot();
-  }
+  std::shared_ptr<Timeline> timeline = m_renderer->timelineSnapshot();
 
   // Timeline 스냅샷 획득 여부 검사
   if (!timeline) {
     Logger::error(k_logTag, "No timeline available for encoding.");
-    return;
+    return -1;
   }
 
-  // 현재 플랫폼에 맞는 인코더 객체 생성
-#if defined (__ANDROID__)
-  auto encoder = std::make_shared<AndroidEncoder>();
-#elif defined (__APPLE__)
-  #if TARGET_OS_IOS
-    // TODO : iOS Encoder 객체 생성
-    std::shared_ptr<IEncoder> encoder; // 임시
-  #endif
-#endif
+  return m_core.submitExportJob(std::move(timeline), configs, priority);
+};
 
-  // 인코더 객체 생성 여부 검사
-  if (!encoder) {
-    Logger::error(k_logTag, "Failed to create encoder for the current platform.");
-  }
+bool Engine::cancelExportJob(int jobId) {
+  return m_core.cancelExportJob(jobId);
+};
 
-  // 인코더 객체에 Timeline 세팅과 준비 작업 수행
-  encoder->setTimeline(timeline);
-  if (!encoder->prepare(config)) {
-    Logger::error(k_logTag, "Encoder preparation failed.");
-    return;
-  }
+ExportJobStatus Engine::getExportJobStatus(int jobId) const {
+  return m_core.getExportJobStatus(jobId);
+};
 
-  /**
-   * Encoder 객체 생성, Timeline 세팅, encoding 준비 등 무거운 작업들은 락 밖에서 미리 처리하고,
-   * 공유 상태(m_encoder, m_lastEncodedPath)를 수정할 때만 잠금으로 m_encoder 를 보호한다.
-   *
-   * -> 멀티스레드 환경(encoding 스레드와 main 스레드가 경합 가능성 존재)에서
-   * shared_ptr 레퍼런스 카운트 갱신이 안전하게 이루어지도록 하기 위함
-   */
-  {
-    std::lock_guard<std::mutex> lock(m_mtx);
-    m_encoder = encoder;
-    m_lastEncodedPath.clear();
-  }
+double Engine::getExportJobProgress(int jobId) const {
+  return m_core.getExportJobProgress(jobId);
+};
 
-  // 인코딩 수행 직전 관련 상태값 초기화
-  m_isEncoding.store(true);
-  m_cancelFlag.store(false);
-  m_encodingProgress.store(0.0);
-
-  // 인코딩 작업을 별도 스레드에서 수행
-  m_encodeThread = std::thread([this, encoder]() {
-    // 인코딩 진행률 콜백함수 정의
-    auto progressCb = [this](double ratio) {
-      m_encodingProgress.store(std::clamp(ratio, 0.0, 1.0));
-    };
-
-    // 모든 프레임을 돌려 인코딩 수행
-    bool ok = encoder->encodeBlocking(m_cancelFlag, progressCb);
-    std::string output = ok ? encoder->outputPath() : std::string();
-    encoder->release();
+std::vector<std::string> Engine::getExportJobOutputPaths(int jobId) const {
+  return m_core.getExportJobOutputPaths(jobId);
+};
 
-    // 인코딩 성공 여부 및 중단 여부에 따라 인코딩 진행률을 최종 갱신
-    if (ok && !m_cancelFlag.load()) {
-      /** 인코딩 성공 시 진행률을 100% 로 최종 갱신 */
-      m_encodingProgress.store(1.0);
-    } else if (!ok && !m_cancelFlag.load()) {
-      /** 인코딩 실패 시 진행률을 0% 로 최종 갱신 */
-      m_encodingProgress.store(0.0);
-      Logger::error(k_logTag, "Encoding failed.");
-    }
+void Engine::setMaxConcurrentExports(int maxConcurrent) {
+  m_core.setMaxConcurrentExports(maxConcurrent);
+};
 
-    // 인코딩 결과물(.mp4)가 생성되어 있는 파일 경로 문자열을 멤버변수에 이동
-    {
-      std::lock_guard<std::mutex> lock(m_mtx);
-      if (ok) {
-        m_lastEncodedPath = std::move(output);
-      }
-      // 인코딩 작업이 완료되었으므로 멤버변수로 붙들고 있던 인코더 객체 해제
-      m_encoder.reset();
-    }
+std::shared_ptr<FrameBuffer> Engine::renderFrameToBuffer(double timeSec, int width, int height) {
+  std::shared_ptr<Timeline> timeline = m_renderer->timelineSnapshot();
+  if (!timeline) {
+    Logger::error(k_logTag, "No timeline available for renderFrameToBuffer.");
+    return nullptr;
+  }
+  return m_core.renderFrameToBuffer(*timeline, timeSec, width, height, m_renderer->surfaceWidth(), m_renderer->surfaceHeight());
+};
 
-    // 인코딩 작업이 모두 끝났으므로 인코딩 상태 플래그를 false 로 갱신
-    m_isEncoding.store(false);
-  });
+MemoryStats Engine::getMemoryStats() const {
+  return m_core.getMemoryStats();
 };
 
-void Engine::cancelEncoding() {
-  // 인코딩 중이 아닐 때에는 취소 요청 무시
-  if (!m_isEncoding.load()) return;
+void Engine::trimMemory(int androidLevel) {
+  const TrimLevel level = MemoryBudget::levelFromAndroid(androidLevel);
+  if (level == TrimLevel::None) return;
+  Logger::info(k_logTag, "trimMemory(androidLevel=%d)", androidLevel);
+  m_core.trimMemory(level);
+};
+
+TaskSchedulerStats Engine::getTaskStats() const {
+  return TaskScheduler::instance().stats();
+};
 
-  // 인코딩 취소가 요청되었음을 로그 출력
-  Logger::info(k_logTag, "Encoding cancellation requested.");
+void Engine::setEventSink(EventThrottle::Sink sink) {
+  m_events.setSink(std::move(sink));
+};
+
+void Engine::setEventMaxRate(double maxRateHz) {
+  m_events.setMaxRate(maxRateHz);
+};
 
-  // 인코딩 취소 플래그 설정 -> IEncoder::encodeBlocking() 의 인코딩 루프에서 주기적으로 체크하여 인코딩 중단 처리
-  m_cancelFlag.store(true);
+void Engine::startTracing() {
+  Trace::start();
+};
 
-  // 인코딩 루프 중단 후 인코딩 스레드가 안전하게 종료될 때까지 대기
-  joinEncodeThread();
+bool Engine::stopTracing(const std::string& outputPath) {
+  Trace::stop();
+  return Trace::dumpJson(outputPath);
 };
 
-void Engine::joinEncodeThread() {
-  // 기존에 실행 중인 인코딩 스레드가 있다면 작업이 끝날 때까지 대기 후 스레드 자원 정리.
-  // -> 인코딩 스레드 정리 및 중복 생성 방지 목적
-  if (m_encodeThread.joinable()) {
-    m_encodeThread.join();
+std::shared_ptr<IEncoder> Engine::createEncoder(const std::vector<EncoderConfig>& configs, std::shared_ptr<Timeline> timeline) {
+  // 현재 플랫폼에 맞는 인코더 객체 생성 (rendition 이 여러 개면 한 번의 렌더링 패스로 모두 인코딩하는 인코더 사용)
+#if defined (__ANDROID__)
+  if (configs.size() == 1) {
+    auto encoder = std::make_shared<AndroidEncoder>();
+    encoder->setTimeline(std::move(timeline));
+    if (!encoder->prepare(configs.front())) {
+      Logger::error(k_logTag, "Encoder preparation failed.");
+      encoder->release();
+      return nullptr;
+    }
+    return encoder;
   }
+
+  auto encoder = std::make_shared<AndroidRenditionEncoder>();
+  encoder->setTimeline(std::move(timeline));
+  if (!encoder->prepareRenditions(configs)) {
+    Logger::error(k_logTag, "Rendition encoder preparation failed.");
+    encoder->release();
+    return nullptr;
+  }
+  return encoder;
+#else
+  // TODO : iOS Encoder 객체 생성
+  Logger::error(k_logTag, "Failed to create encoder for the current platform.");
+  return nullptr;
+#endif
 };
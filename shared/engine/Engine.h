@@ -4,12 +4,14 @@
 #include <string>
 #include <vector>
 #include <atomic>
-#include <thread>
 #include <android/native_window.h> // ANativeWindow
 #include "../render/Renderer.h"
 #include "../preview/PreviewController.h"
 #include "../encoder/EncoderConfig.h"
 #include "../encoder/IEncoder.h"
+#include "../task/TaskScheduler.h"
+#include "./EngineCore.h"
+#include "./EngineEvents.h"
 
 class Engine
 {
@@ -26,50 +28,119 @@ public:
 
   // 입력받은 파일 경로 -> 이미지 시퀀스 생성 → Timeline 생성(경로 배열, 초 단위 길이/페이드, 그릴 영역 크기)
   void setImageSequence(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec);
+  // 다음 setImageSequence 부터 적용할 클립 사이 전환 방식 이름 목록 (Transition::fromName 참고)
+  void setTransitions(const std::vector<std::string>& names);
+  // 다음 setImageSequence 부터 클립마다 Ken Burns(pan/zoom) 애니메이션 적용 여부
+  void setKenBurnsEnabled(bool enabled);
+  // 다음 setImageSequence 부터 export 결과에 믹싱할 배경 음악(WAV) 경로와 음량 (빈 경로면 배경 음악 없음)
+  void setBackgroundMusic(const std::string& path, double gain);
+  // 현재 Timeline 을 프로젝트 파일로 저장 / 프로젝트 파일에서 Timeline 복원 (setImageSequence 대신 사용)
+  bool saveProject(const std::string& path);
+  bool loadProject(const std::string& path);
+  // 현재 Timeline 기본 트랙의 클립 편집 (바뀐 클립 외에는 다시 읽지 않고, 재생 위치 유지, 성공 여부 반환)
+  bool insertClip(int index, const std::string& path);
+  bool removeClip(int index);
+  bool moveClip(int from, int to);
+  bool retimeClip(int index, double durationSec, double xfadeSec);
+  bool replaceClip(int index, const std::string& path);
+  int clipCount() const;
 
   // Preview 제어
   void previewPlay();
   void previewPause();
   void previewStop();
+  void previewSeek(double tSec);
 
   // Timeline 총 재생 길이(초) 조회(최근에 생성된 Timeline 기준)
   double getTimelineDuration() { return m_lastTimelineDurationSec; };
 
-  // Encoder 제어
+  // Encoder 제어 (가장 최근에 시작한 export 작업 기준)
   void startEncoding(const EncoderConfig& config);
+  // 한 번의 렌더링 패스로 여러 해상도(rendition)를 동시에 인코딩
+  void startEncodingRenditions(const std::vector<EncoderConfig>& configs);
+  // 취소 요청만 보내고 즉시 반환 (Codec drain/자원 해제는 작업 스레드에서 백그라운드로 진행)
   void cancelEncoding();
-  void joinEncodeThread();
-  bool isEncoding() const { return m_isEncoding.load(); };
+  bool isEncoding() const;
 
   // 인코딩된 파일 경로 조회
-  std::string getLastEncodedPath() const { return m_lastEncodedPath; };
+  std::string getLastEncodedPath() const;
 
   // 인코딩 진행률([0.0, 1.0]) 조회
-  double getEncodingProgress() const { return m_encodingProgress.load(); };
+  double getEncodingProgress() const;
+
+  // Export 작업 제어 (작업 ID 기반. 우선순위가 클수록 먼저 실행)
+  int submitExportJob(const std::vector<EncoderConfig>& configs, int priority);
+  bool cancelExportJob(int jobId);
+  ExportJobStatus getExportJobStatus(int jobId) const;
+  double getExportJobProgress(int jobId) const;
+  std::vector<std::string> getExportJobOutputPaths(int jobId) const;
+  // 동시에 실행할 export 작업 수 제한
+  void setMaxConcurrentExports(int maxConcurrent);
+
+  /**
+   * 현재 Timeline 의 timeSec 장면을 (width x height) RGBA 픽셀 버퍼로 렌더링 (CPU raster, 호출한 스레드에서 동기적으로 실행)
+   * - 클립 배치 기준은 Preview surface 크기이며, 출력 크기에 맞춰 비율대로 확대/축소된다.
+   * - 버퍼는 재사용 풀에서 빌려오며 마지막 참조가 사라지면 풀로 돌아간다. (EngineCore::renderFrameToBuffer 참고)
+   * @return Timeline 이 없거나 크기가 잘못되었으면 nullptr
+   */
+  std::shared_ptr<FrameBuffer> renderFrameToBuffer(double timeSec, int width, int height);
+
+  // 분류별(encoded/decoded/render target/cache) 메모리 사용량 조회
+  MemoryStats getMemoryStats() const;
+  // 메모리 회수 (Android ComponentCallbacks2.onTrimMemory 의 level 값을 그대로 전달)
+  void trimMemory(int androidLevel);
+
+  // 공용 작업 스레드 풀의 QoS 별 대기 작업 수 / 대기 시간 / 실행 시간 조회
+  TaskSchedulerStats getTaskStats() const;
+
+  /**
+   * export 진행/완료/실패/취소, Preview 재생 위치, import 진행 이벤트를 받을 sink 설정 (nullptr 이면 해제)
+   * - 진행률/재생 위치 이벤트는 maxRateHz 빈도 이하로 최신 값만 묶어서 전달되고, 완료/실패/취소는 즉시 전달된다.
+   * - sink 는 엔진의 이벤트 전달 스레드에서 호출되므로 JS 로 넘기려면 CallInvoker 로 JS 스레드에 예약해야 한다.
+   */
+  void setEventSink(EventThrottle::Sink sink);
+  void setEventMaxRate(double maxRateHz);
+
+  // trace event 기록 시작/중지 (중지 시 outputPath 에 Chrome/Perfetto JSON 으로 저장)
+  void startTracing();
+  bool stopTracing(const std::string& outputPath);
 
 private:
-  Engine() = default;
+  Engine();
   ~Engine() = default;
   Engine(const Engine&) = delete;
   Engine& operator=(const Engine&) = delete;
   Engine(Engine&&) = delete;
   Engine& operator=(Engine&&) = delete;
 
+  // 클립 편집 결과 반영 (성공했으면 Timeline 길이 캐시 갱신)
+  bool onTimelineEdited(bool edited);
+
+private:
+  // JS 로 보내는 이벤트 묶음/빈도 제한 (다른 멤버보다 먼저 생성/나중에 해제 -> 렌더링/export 작업 스레드가 종료될 때까지 유효)
+  EventThrottle m_events;
+
 private:
+  /**
+   * m_renderer / m_previewController 는 생성자에서 한 번만 만들어지고 이후 교체되지 않으므로 잠금 없이 접근한다.
+   * -> Preview 제어 명령(play/pause/stop/seek/resize/timeline 교체)은 Renderer 의 lock-free 명령 큐에 적재만 하고 즉시 반환되어
+   *    JS 스레드가 다른 무거운 작업(이미지 로드, 인코딩 준비 등)의 잠금 뒤에서 대기하지 않는다.
+   * m_mtx 는 surface 생명주기처럼 여러 스레드가 함께 수정하는 상태만 보호한다. (인코딩 상태는 EngineCore 가 자체적으로 보호)
+   */
   std::mutex m_mtx;
-  std::shared_ptr<Renderer> m_renderer;
-  std::shared_ptr<PreviewController> m_previewController;
+  const std::shared_ptr<Renderer> m_renderer;
+  const std::shared_ptr<PreviewController> m_previewController;
   bool m_rendererStarted = false;
   double m_lastTimelineDurationSec = 0.0; // 가장 최근에 생성된 Timeline 전체 길이(초) 캐시
 
+private:
+  // 플랫폼별 인코더 생성 + 준비 (EngineCore 의 export 작업 스레드에서 호출됨)
+  static std::shared_ptr<IEncoder> createEncoder(const std::vector<EncoderConfig>& configs, std::shared_ptr<Timeline> timeline);
+
 private:
   // Encoder 관련 멤버변수들
-  std::shared_ptr<IEncoder> m_encoder;
-  std::thread m_encodeThread;
-  std::atomic<bool> m_isEncoding = false;
-  std::atomic<bool> m_cancelFlag = false;
-  std::atomic<double> m_encodingProgress = 0.0;
-  std::string m_lastEncodedPath;
+  EngineCore m_core;                      // 플랫폼 독립 엔진 코어 (export 작업 대기열/실행/취소 관리)
+  std::atomic<int> m_lastJobId = -1;      // startEncoding 계열 API 로 가장 최근에 등록한 작업 ID
 
 private:
   static constexpr const char* k_logTag = "Engine";
@@ -0,0 +1,191 @@
+#include "EngineCore.h"
+#include "../video/ClipLoader.h"
+#include "../video/ColorManagedDecoder.h"
+#include "../project/ProjectFile.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <core/SkCanvas.h>
+#include <core/SkGraphics.h>
+#include <algorithm> // std::min, std::max
+#include <cmath> // std::ceil
+
+EngineCore::EngineCore(ExportJobManager::EncoderFactory encoderFactory, int maxConcurrentExports, size_t imageCacheBudgetBytes)
+  : m_memoryBudget(MemoryBudget::create()),
+    m_imageCache(imageCacheBudgetBytes),
+    m_exportJobs(std::move(encoderFactory), maxConcurrentExports),
+    m_frameBuffers(FrameBufferPool::create()) {
+  // 전환 효과 셰이더를 미리 컴파일 (export 작업의 첫 전환 프레임에서 컴파일 지연이 생기지 않도록)
+  Transition::warmUp();
+
+  // 작업 간 공유 디코딩 캐시 : Light 면 절반만 남기고, 그 이상이면 전부 비움 (Timeline 이 들고 있는 이미지는 참조 카운트로 유지됨)
+  m_memorySources.push_back(m_memoryBudget->addSource("core.imageCache", MemoryCategory::Decoded,
+    [this]() { return m_imageCache.usedBytes(); },
+    [this](TrimLevel level) {
+      if (level == TrimLevel::Light) {
+        m_imageCache.trimTo(m_imageCache.usedBytes() / 2);
+      } else {
+        m_imageCache.clear();
+      }
+    },
+    10));
+
+  // Skia 전역 리소스 캐시 (지연 디코딩 이미지의 디코딩 결과, 폰트 캐시 등) : raster 백엔드에서도 사용됨
+  m_memorySources.push_back(m_memoryBudget->addSource("skia.resourceCache", MemoryCategory::Caches,
+    []() { return SkGraphics::GetResourceCacheTotalBytesUsed(); },
+    [](TrimLevel level) {
+      if (level == TrimLevel::Critical) {
+        SkGraphics::PurgeAllCaches();
+      } else {
+        SkGraphics::PurgeResourceCache();
+      }
+    },
+    20));
+
+  // renderFrameToBuffer 버퍼 풀 : 반환된 버퍼만 해제 (JS 가 들고 있는 버퍼는 그대로)
+  m_memorySources.push_back(m_memoryBudget->addSource("core.frameBuffers", MemoryCategory::RenderTargets,
+    [this]() { return m_frameBuffers->idleBytes() + m_frameBuffers->inUseBytes(); },
+    [this](TrimLevel) { m_frameBuffers->trim(); },
+    5));
+};
+
+std::shared_ptr<Timeline> EngineCore::buildTimeline(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec, int width, int height,
+                                                 const std::vector<TransitionType>& transitions, bool kenBurns) {
+  ClipLoadOptions opts;
+  opts.width = width;
+  opts.height = height;
+  opts.proxyScale = kenBurns ? ClipMotion::k_maxScale : 1.0f;
+  opts.sharedCache = &m_imageCache;
+
+  std::vector<Timeline::ClipRenderData> renderDataList = ClipLoader::load(paths, opts);
+  if (renderDataList.empty()) {
+    Logger::warn(k_logTag, "No images loaded");
+    return nullptr;
+  }
+  static const std::vector<std::shared_ptr<const ClipMotion>> s_noMotion;
+  std::shared_ptr<Timeline> timeline = Timeline::FromClipRenderData(renderDataList, clipDurSec, xfadeSec, transitions,
+                                                                    kenBurns ? ClipMotion::kenBurnsPresets() : s_noMotion);
+
+  // 디코딩으로 늘어난 메모리가 예산을 넘었으면 캐시부터 회수
+  m_memoryBudget->enforceBudget();
+  return timeline;
+};
+
+std::shared_ptr<Timeline> EngineCore::loadProject(const std::string& path, int width, int height) {
+  ProjectFile project;
+  if (!project.open(path)) return nullptr;
+
+  ClipLoadOptions opts;
+  opts.width = width;
+  opts.height = height;
+  opts.sharedCache = &m_imageCache;
+  std::shared_ptr<Timeline> timeline = project.buildTimeline(opts);
+
+  m_memoryBudget->enforceBudget();
+  return timeline;
+};
+
+int EngineCore::addOverlayTrack(Timeline& timeline, const std::vector<OverlayClip>& overlays) {
+  std::vector<Timeline::Segment> segs;
+  for (const auto& overlay : overlays) {
+    ClipLoadOptions opts;
+    opts.width = (int)std::ceil(overlay.rect.width());
+    opts.height = (int)std::ceil(overlay.rect.height());
+    opts.sharedCache = &m_imageCache;
+    if (opts.width <= 0 || opts.height <= 0 || overlay.durationSec <= 0.0) {
+      Logger::warn(k_logTag, "Skipping overlay '%s': empty rect or duration", overlay.path.c_str());
+      continue;
+    }
+
+    std::vector<Timeline::ClipRenderData> loaded = ClipLoader::load({ overlay.path }, opts);
+    if (loaded.empty()) continue;
+
+    // ClipLoader 는 (0, 0) 기준 영역에 배치하므로 overlay 위치만큼 이동
+    Timeline::ClipRenderData clip = std::move(loaded.front());
+    clip.dst.offset(overlay.rect.left(), overlay.rect.top());
+    segs.emplace_back(std::move(clip), overlay.durationSec, overlay.startSec);
+  }
+  if (segs.empty()) {
+    Logger::warn(k_logTag, "No overlay images loaded");
+    return -1;
+  }
+  const int track = timeline.addTrack(segs);
+  m_memoryBudget->enforceBudget();
+  return track;
+};
+
+int EngineCore::submitExportJob(std::shared_ptr<Timeline> timeline, const std::vector<EncoderConfig>& configs, int priority) {
+  return m_exportJobs.submit(std::move(timeline), configs, priority);
+};
+
+bool EngineCore::cancelExportJob(int jobId) {
+  return m_exportJobs.cancel(jobId);
+};
+
+void EngineCore::cancelAllExportJobs() {
+  m_exportJobs.cancelAll();
+};
+
+ExportJobStatus EngineCore::getExportJobStatus(int jobId) const {
+  return m_exportJobs.status(jobId);
+};
+
+double EngineCore::getExportJobProgress(int jobId) const {
+  return m_exportJobs.progress(jobId);
+};
+
+std::vector<std::string> EngineCore::getExportJobOutputPaths(int jobId) const {
+  return m_exportJobs.outputPaths(jobId);
+};
+
+double EngineCore::getExportJobElapsedSec(int jobId) const {
+  return m_exportJobs.elapsedSec(jobId);
+};
+
+void EngineCore::setMaxConcurrentExports(int maxConcurrent) {
+  m_exportJobs.setMaxConcurrent(maxConcurrent);
+};
+
+void EngineCore::setExportListener(ExportJobManager::JobListener listener) {
+  m_exportJobs.setListener(std::move(listener));
+};
+
+void EngineCore::waitForExports() {
+  m_exportJobs.waitUntilIdle();
+};
+
+std::shared_ptr<FrameBuffer> EngineCore::renderFrameToBuffer(const Timeline& timeline, double timeSec, int width, int height, int layoutWidth, int layoutHeight) {
+  TRACE_SCOPE("render", "EngineCore::renderFrameToBuffer");
+  if (width <= 0 || height <= 0 || width > k_maxFrameBufferDim || height > k_maxFrameBufferDim) {
+    Logger::error(k_logTag, "renderFrameToBuffer: invalid size %dx%d", width, height);
+    return nullptr;
+  }
+  if (timeline.totalDuration() <= 0.0) return nullptr;
+
+  const SkImageInfo info = ColorManagedDecoder::outputInfo(width, height, true);
+  std::shared_ptr<FrameBuffer> buffer = m_frameBuffers->acquire(info.computeMinByteSize());
+  std::unique_ptr<SkCanvas> canvas = buffer ? SkCanvas::MakeRasterDirect(info, buffer->data(), info.minRowBytes()) : nullptr;
+  if (!canvas) {
+    Logger::error(k_logTag, "renderFrameToBuffer: canvas creation failed (%dx%d)", width, height);
+    return nullptr;
+  }
+
+  // 클립은 배치 기준 크기 좌표계에 있으므로 출력 크기에 맞춰 캔버스를 확대/축소 (풀에서 받은 버퍼의 이전 내용은 Timeline::render 가 덮어씀)
+  const int layoutW = layoutWidth > 0 ? layoutWidth : width;
+  const int layoutH = layoutHeight > 0 ? layoutHeight : height;
+  const float sx = (float)width / layoutW;
+  const float sy = (float)height / layoutH;
+  canvas->scale(sx, sy);
+
+  RenderContext ctx{ canvas.get(), layoutW, layoutH, timeSec };
+  ctx.quality = std::max(sx, sy) > 1.0f ? RenderQuality::Export : RenderQuality::Preview;
+  timeline.render(ctx);
+  return buffer;
+};
+
+MemoryStats EngineCore::getMemoryStats() const {
+  return m_memoryBudget->stats();
+};
+
+size_t EngineCore::trimMemory(TrimLevel level) {
+  return m_memoryBudget->trimMemory(level);
+};
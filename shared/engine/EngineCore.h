@@ -0,0 +1,108 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "../encoder/EncoderConfig.h"
+#include "../encoder/ExportJobManager.h"
+#include "../video/SharedImageCache.h"
+#include "../video/Timeline.h"
+#include "../memory/MemoryBudget.h"
+#include "../render/FrameBufferPool.h"
+
+// 기본 사진 트랙 위에 얹을 이미지 클립 (sticker/title 등)
+struct OverlayClip
+{
+  std::string path;                   // 이미지 파일 경로
+  double startSec = 0.0;              // 보이기 시작하는 시간(초)
+  double durationSec = 0.0;           // 보여줄 시간(초)
+  SkRect rect = SkRect::MakeEmpty();  // 출력 좌표계 기준 영역 (이미지는 영역 너비에 맞춰 세로 가운데 정렬)
+};
+
+/**
+ * 플랫폼(Android surface, JSI, 싱글톤)에 의존하지 않는 엔진 핵심부
+ *
+ * - 이미지 경로 -> Timeline 생성(작업 간 공유 디코딩 캐시 사용)과 export 작업 대기열을 묶어서 제공한다.
+ * - 인코더 생성 방식은 생성자에서 팩토리로 주입받으므로,
+ *   앱(Engine)은 MediaCodec 인코더를, 헤드리스 배치 렌더링 도구는 CPU 인코더를 사용하는 식으로 같은 코어를 공유한다.
+ * - 싱글톤이 아니므로 한 프로세스에서 여러 인스턴스를 만들 수 있다.
+ * - 공유 디코딩 캐시와 Skia 전역 리소스 캐시는 MemoryBudget 에 등록되며, 플랫폼 쪽 자원(Renderer 등)도 memoryBudget() 에 등록해 함께 집계/회수한다.
+ */
+class EngineCore
+{
+public:
+  explicit EngineCore(ExportJobManager::EncoderFactory encoderFactory,
+                      int maxConcurrentExports = 1,
+                      size_t imageCacheBudgetBytes = 256 * 1024 * 1024);
+
+  EngineCore(const EngineCore&) = delete;
+  EngineCore& operator=(const EngineCore&) = delete;
+
+public:
+  /**
+   * 이미지 경로 목록으로 (width x height) 출력용 Timeline 생성
+   * - 이미지는 출력 크기에 맞춰 축소 디코딩되며, 같은 이미지를 쓰는 다른 Timeline 과 디코딩 결과를 공유한다.
+   * - 호출한 스레드에서 동기적으로 디코딩하므로 여러 스레드에서 동시에 호출해 병렬로 준비할 수 있다.
+   * - transitions 는 클립 사이 전환 방식 (비어있으면 crossfade, 클립 수보다 적으면 반복 적용)
+   * - kenBurns 가 true 면 클립마다 Ken Burns(pan/zoom) 프리셋 애니메이션을 번갈아 적용 (확대 배율만큼 크게 디코딩)
+   * @return 생성된 Timeline, 이미지를 하나도 읽지 못했으면 nullptr
+   */
+  std::shared_ptr<Timeline> buildTimeline(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec, int width, int height,
+                                          const std::vector<TransitionType>& transitions = {}, bool kenBurns = false);
+
+  /**
+   * 프로젝트 파일(ProjectFile)로 (width x height) 출력용 Timeline 복원 (저장 당시 캔버스 크기와 다르면 dst 를 비율대로 변환)
+   * - 이미지는 클립 dst 크기로 축소 디코딩되어 공유 디코딩 캐시를 사용한다.
+   * @return 복원된 Timeline, 파일을 열 수 없거나 이미지를 하나도 읽지 못했으면 nullptr
+   */
+  std::shared_ptr<Timeline> loadProject(const std::string& path, int width, int height);
+
+  /**
+   * overlays 를 하나의 overlay 트랙으로 만들어 timeline 의 맨 위에 추가 (export 작업에 넘기기 전에 호출)
+   * - 이미지는 각 영역 크기로 축소 디코딩되어 공유 디코딩 캐시를 사용한다.
+   * @return 추가된 트랙 번호, 이미지를 하나도 읽지 못했으면 -1
+   */
+  int addOverlayTrack(Timeline& timeline, const std::vector<OverlayClip>& overlays);
+
+  // Export 작업 제어 (ExportJobManager 참고)
+  int submitExportJob(std::shared_ptr<Timeline> timeline, const std::vector<EncoderConfig>& configs, int priority);
+  bool cancelExportJob(int jobId);
+  void cancelAllExportJobs();
+  ExportJobStatus getExportJobStatus(int jobId) const;
+  double getExportJobProgress(int jobId) const;
+  std::vector<std::string> getExportJobOutputPaths(int jobId) const;
+  double getExportJobElapsedSec(int jobId) const;
+  void setMaxConcurrentExports(int maxConcurrent);
+  // export 작업 상태/진행률 변경 알림 대상 설정 (작업 등록 전에 설정)
+  void setExportListener(ExportJobManager::JobListener listener);
+  // 등록된 export 작업이 모두 끝날 때까지 대기 (헤드리스 전용)
+  void waitForExports();
+
+  /**
+   * timeline 의 timeSec 장면을 (width x height) 픽셀 버퍼로 렌더링 (CPU raster, 호출한 스레드에서 동기적으로 실행)
+   * - layoutWidth/layoutHeight: timeline 의 클립 배치 기준 크기 (Preview surface 크기). 출력 크기와 다르면 비율대로 확대/축소해서 그림
+   *   (0 이면 출력 크기와 같다고 봄)
+   * - 출력 크기가 배치 기준보다 작으면 Preview 해상도(proxy), 크면 원본 해상도 이미지로 그린다.
+   * - 버퍼는 풀에서 빌려오며, 행 사이 여백 없이(width * 4 byte) 채워진 불투명 RGBA_8888 (sRGB)
+   * @return 크기가 잘못되었거나 timeline 이 비어있으면 nullptr
+   */
+  std::shared_ptr<FrameBuffer> renderFrameToBuffer(const Timeline& timeline, double timeSec, int width, int height, int layoutWidth = 0, int layoutHeight = 0);
+
+  // 작업 간 공유 디코딩 캐시 (통계 조회용)
+  const SharedImageCache& imageCache() const { return m_imageCache; };
+
+  // 메모리 사용량 집계/회수 (MemoryBudget 참고)
+  MemoryStats getMemoryStats() const;
+  size_t trimMemory(TrimLevel level);
+  const std::shared_ptr<MemoryBudget>& memoryBudget() const { return m_memoryBudget; };
+
+private:
+  const std::shared_ptr<MemoryBudget> m_memoryBudget;     // 서브시스템별 메모리 집계/회수 관리자
+  SharedImageCache m_imageCache;                          // 작업 간 공유 디코딩 캐시 (m_exportJobs 보다 먼저 생성/나중에 해제)
+  ExportJobManager m_exportJobs;                          // export 작업 대기열/실행/취소 관리
+  const std::shared_ptr<FrameBufferPool> m_frameBuffers;  // renderFrameToBuffer 결과 버퍼 재사용 풀
+  std::vector<MemoryBudget::Registration> m_memorySources; // MemoryBudget 등록 핸들 (다른 멤버보다 먼저 해제되도록 마지막에 선언)
+
+private:
+  static constexpr int k_maxFrameBufferDim = 8192;        // renderFrameToBuffer 최대 너비/높이
+  static constexpr const char* k_logTag = "EngineCore";
+};
@@ -0,0 +1,101 @@
+#include "EngineEvents.h"
+#include "../trace/Trace.h"
+#include <algorithm> // std::find_if, std::max
+
+const char* EngineEvent::typeName(EngineEventType type) {
+  switch (type) {
+    case EngineEventType::ExportProgress:  return "exportProgress";
+    case EngineEventType::ExportCompleted: return "exportCompleted";
+    case EngineEventType::ExportFailed:    return "exportFailed";
+    case EngineEventType::ExportCancelled: return "exportCancelled";
+    case EngineEventType::PreviewTime:     return "previewTime";
+    case EngineEventType::ImportProgress:  return "importProgress";
+  }
+  return "unknown";
+};
+
+bool EngineEvent::isCoalesced(EngineEventType type) {
+  return type == EngineEventType::ExportProgress || type == EngineEventType::PreviewTime || type == EngineEventType::ImportProgress;
+};
+
+EventThrottle::EventThrottle(double maxRateHz)
+  : m_interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / std::max(1.0, maxRateHz)))),
+    m_thread([this]() { dispatchLoop(); }) {};
+
+EventThrottle::~EventThrottle() {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_quit = true;
+  }
+  m_cv.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+};
+
+void EventThrottle::setSink(Sink sink) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_sink = std::move(sink);
+  if (!m_sink) {
+    m_pending.clear();
+  }
+};
+
+void EventThrottle::setMaxRate(double maxRateHz) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / std::max(1.0, maxRateHz)));
+};
+
+void EventThrottle::post(EngineEvent event) {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (!m_sink) return;
+
+    if (EngineEvent::isCoalesced(event.type)) {
+      // 같은 (종류, 작업 ID) 의 대기 중인 이벤트가 있으면 최신 값으로 덮어씀 (도착 순서는 처음 들어온 자리 유지)
+      auto it = std::find_if(m_pending.begin(), m_pending.end(), [&](const EngineEvent& e) {
+        return e.type == event.type && e.jobId == event.jobId;
+      });
+      if (it != m_pending.end()) {
+        *it = std::move(event);
+        return; // 이미 대기 중인 이벤트가 있으므로 dispatcher 를 깨울 필요 없음
+      }
+      m_pending.push_back(std::move(event));
+    } else {
+      m_pending.push_back(std::move(event));
+      m_urgent = true;
+    }
+  }
+  m_cv.notify_one();
+};
+
+void EventThrottle::dispatchLoop() {
+  TRACE_THREAD_NAME("EventDispatch");
+
+  std::unique_lock<std::mutex> lock(m_mtx);
+  for (;;) {
+    m_cv.wait(lock, [this]() { return m_quit || !m_pending.empty(); });
+    if (m_quit) return;
+
+    // 빈도 제한: 마지막 전달 후 최소 간격이 지날 때까지 대기 (그 사이 들어온 값은 덮어써짐). 즉시 전달 이벤트가 오면 바로 깨어남
+    const auto due = m_lastFlush + m_interval;
+    if (!m_urgent && std::chrono::steady_clock::now() < due) {
+      m_cv.wait_until(lock, due, [this]() { return m_quit || m_urgent; });
+      if (m_quit) return;
+    }
+
+    std::vector<EngineEvent> batch;
+    batch.swap(m_pending);
+    m_urgent = false;
+    m_lastFlush = std::chrono::steady_clock::now();
+    Sink sink = m_sink;
+
+    // sink 는 잠금 없이 호출 (sink 안에서 post() 를 불러도 교착되지 않도록)
+    lock.unlock();
+    if (sink && !batch.empty()) {
+      TRACE_SCOPE_ARG("events", "dispatch", "count", batch.size());
+      sink(std::move(batch));
+    }
+    lock.lock();
+  }
+};
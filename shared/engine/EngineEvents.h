@@ -0,0 +1,82 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// JS 로 전달하는 엔진 이벤트 종류
+enum class EngineEventType
+{
+  ExportProgress,   // export 진행률 (jobId, value = [0, 1]). 작업 실행 시작 시 0 으로 한 번 전달 - 빈도 제한 대상
+  ExportCompleted,  // export 성공 (jobId, outputPaths)
+  ExportFailed,     // export 실패 (jobId)
+  ExportCancelled,  // export 취소 (jobId)
+  PreviewTime,      // Preview 재생 위치 (value = 초) - 빈도 제한 대상
+  ImportProgress,   // 이미지 import 진행 (done / total) - 빈도 제한 대상
+};
+
+// JS 로 전달하는 엔진 이벤트 한 건
+struct EngineEvent
+{
+  EngineEventType type = EngineEventType::ExportProgress;
+  int jobId = -1;                       // export 이벤트의 작업 ID
+  double value = 0.0;                   // 진행률 / 재생 위치(초)
+  int done = 0;                         // import: 처리한 이미지 수
+  int total = 0;                        // import: 전체 이미지 수
+  std::vector<std::string> outputPaths; // ExportCompleted: 출력 파일 경로
+
+  // JS 에 전달할 이벤트 이름 ("exportProgress" 등)
+  static const char* typeName(EngineEventType type);
+  // 빈도 제한(최신 값으로 덮어쓰기) 대상인지 여부 (완료/실패처럼 한 번뿐인 이벤트는 즉시 전달)
+  static bool isCoalesced(EngineEventType type);
+};
+
+/**
+ * 엔진 이벤트를 모아 일정 빈도 이하로 묶어서 전달하는 dispatcher
+ *
+ * - post() 는 어느 스레드(렌더링/export 작업/import)에서나 호출할 수 있으며 잠깐의 잠금 후 즉시 반환한다.
+ * - 진행률/재생 위치처럼 자주 바뀌는 이벤트는 같은 (종류, 작업 ID) 의 대기 중인 이벤트를 최신 값으로 덮어쓰고,
+ *   전용 스레드가 최대 maxRateHz 빈도로 대기 중인 이벤트들을 한 번에(배치) sink 로 넘긴다. -> JS 스레드 호출 횟수가 빈도 이하로 제한됨
+ * - 완료/실패/취소 이벤트는 덮어쓰지 않으며, 들어오면 빈도 제한을 무시하고 즉시 그때까지 쌓인 이벤트와 함께 전달한다.
+ *   (같은 작업의 마지막 진행률이 완료 이벤트보다 먼저 도착하도록 순서 유지)
+ * - sink 는 dispatcher 스레드에서 호출되므로, JS 로 넘기려면 sink 안에서 CallInvoker 로 JS 스레드에 작업을 예약해야 한다.
+ */
+class EventThrottle
+{
+public:
+  using Sink = std::function<void(std::vector<EngineEvent>)>;
+
+  explicit EventThrottle(double maxRateHz = k_defaultRateHz);
+  ~EventThrottle();
+
+  EventThrottle(const EventThrottle&) = delete;
+  EventThrottle& operator=(const EventThrottle&) = delete;
+
+public:
+  // 이벤트를 받을 sink 설정 (nullptr 이면 이벤트를 버림)
+  void setSink(Sink sink);
+  // 빈도 제한이 있는 이벤트의 최대 전달 빈도(Hz, 최소 1)
+  void setMaxRate(double maxRateHz);
+  // 이벤트 적재 (sink 가 없으면 버림)
+  void post(EngineEvent event);
+
+private:
+  void dispatchLoop();
+
+private:
+  std::mutex m_mtx;                           // 아래 상태 보호
+  std::condition_variable m_cv;               // 새 이벤트 / 종료를 dispatcher 스레드에 알림
+  Sink m_sink;                                // 이벤트 전달 대상
+  std::vector<EngineEvent> m_pending;         // 전달 대기 중인 이벤트 (도착 순)
+  bool m_urgent = false;                      // 빈도 제한 없이 즉시 전달할 이벤트가 있는지 여부
+  bool m_quit = false;                        // dispatcher 스레드 종료 요청
+  std::chrono::steady_clock::duration m_interval; // 최소 전달 간격 (1 / maxRateHz)
+  std::chrono::steady_clock::time_point m_lastFlush; // 마지막 전달 시각
+  std::thread m_thread;                       // dispatcher 스레드 (마지막에 선언: 다른 멤버 초기화 후 시작)
+
+private:
+  static constexpr double k_defaultRateHz = 10.0;
+};
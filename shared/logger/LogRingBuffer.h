@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 로그 레코드 전달용 고정 크기 다중 생산자 / 단일 소비자 lock-free 링 버퍼 (Dmitry Vyukov 의 bounded 큐 방식)
+ *
+ * - 슬롯마다 sequence 번호를 두어, 생산자는 "쓰기 가능한 슬롯"을 CAS 한 번으로 예약하고 그 자리에 직접 기록한다.
+ *   -> MpscQueue 와 달리 push 마다 노드를 할당하지 않으므로 렌더링/인코딩 스레드에서 호출해도 힙 할당이 없다.
+ * - 버퍼가 가득 차면 기다리지 않고 실패(false)를 반환한다. (로그 때문에 렌더링 스레드가 막히는 것보다 유실이 낫다)
+ * - tryPop() 은 반드시 하나의 소비자 스레드(로그 출력 스레드)에서만 호출해야 한다.
+ * - Capacity 는 2 의 거듭제곱이어야 하며, T 는 기본 생성/복사 가능한 고정 크기 구조체여야 한다.
+ */
+template <typename T, size_t Capacity>
+class LogRingBuffer
+{
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  LogRingBuffer() {
+    for (size_t i = 0; i < Capacity; i++) {
+      m_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+  };
+
+  LogRingBuffer(const LogRingBuffer&) = delete;
+  LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+public:
+  /**
+   * 슬롯 하나를 예약한 뒤 fill(T&) 로 내용을 직접 채우고 소비자에게 공개
+   * -> 레코드를 스택에 만든 뒤 복사하는 대신 슬롯에 바로 포맷팅하기 위한 형태
+   * @return 버퍼가 가득 차서 기록하지 못했으면 false
+   */
+  template <typename Fill>
+  bool tryPush(Fill&& fill) {
+    Slot* slot = nullptr;
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+      slot = &m_slots[pos & (Capacity - 1)];
+      const size_t seq = slot->seq.load(std::memory_order_acquire);
+      const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+      if (diff == 0) {
+        // 비어있는 슬롯 -> 예약 시도 (다른 생산자가 먼저 가져가면 pos 가 갱신되어 다시 시도)
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        // 소비자가 아직 비우지 못한 슬롯 -> 가득 참
+        return false;
+      } else {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+
+    fill(slot->value);
+    slot->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  };
+
+  // 가장 오래된 레코드를 꺼냄 (단일 소비자 전용). 비어있으면 false
+  bool tryPop(T& out) {
+    Slot& slot = m_slots[m_dequeuePos & (Capacity - 1)];
+    const size_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != m_dequeuePos + 1) return false; // 비어있거나 생산자가 아직 기록 중
+
+    out = slot.value;
+    slot.seq.store(m_dequeuePos + Capacity, std::memory_order_release);
+    m_dequeuePos++;
+    return true;
+  };
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> seq;          // 슬롯 상태 (== pos: 쓰기 가능, == pos + 1: 읽기 가능)
+    T value;
+  };
+
+  Slot m_slots[Capacity];
+  alignas(64) std::atomic<size_t> m_enqueuePos = 0;   // 다음에 예약할 위치 (생산자들이 공유)
+  alignas(64) size_t m_dequeuePos = 0;                // 다음에 꺼낼 위치 (소비자 전용)
+};
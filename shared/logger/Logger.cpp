@@ -1,5 +1,15 @@
 #include "Logger.h"
+#include "LogRingBuffer.h"
 #include <cstdarg> // va_list, va_start, va_end (가변 인자 처리)
+#include <cstdio>
+#include <cstdlib> // std::atexit
+#include <cstring>
+#include <ctime>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #if defined (__ANDROID__)
   #include <android/log.h>
@@ -10,58 +20,196 @@
   #endif
 #endif
 
-void Logger::verbose(const std::string& tag, const char* fmt, ...) {
-#if defined (__ANDROID__)
-  va_list args;
-  va_start(args, fmt);
-  __android_log_vprint(ANDROID_LOG_VERBOSE, tag.c_str(), fmt, args);
-  va_end(args);
-#elif defined(__APPLE__) && TARGET_OS_IOS
-  // TODO : implement iOS logging backend
-#endif
+namespace {
+
+// 링 버퍼 한 칸에 담기는 로그 레코드 (고정 크기 -> 기록 시 힙 할당 없음, 긴 메시지는 잘림)
+struct LogRecord
+{
+  LogLevel level = LogLevel::Info;
+  int64_t timeMs = 0;                 // 기록 시각 (epoch 기준 ms, stdout/파일 출력용)
+  char tag[32] = {};
+  char message[472] = {};
 };
 
-void Logger::debug(const std::string& tag, const char* fmt, ...) {
+/**
+ * 백그라운드 로그 스레드 + 출력 대상(sink)
+ * - 프로세스 종료 시점에 다른 정적 객체의 소멸자에서 로그를 남겨도 안전하도록 해제하지 않는다(의도된 leak).
+ * - 종료 시 atexit 에서 남은 로그를 모두 출력한다.
+ */
+class LogBackend
+{
+public:
+  static LogBackend& instance() {
+    static LogBackend* s_backend = []() {
+      auto* backend = new LogBackend();
+      std::atexit([]() { LogBackend::instance().flush(); });
+      return backend;
+    }();
+    return *s_backend;
+  };
+
+  void push(LogLevel level, const char* tag, const char* fmt, va_list args) {
+    const bool pushed = m_ring.tryPush([&](LogRecord& rec) { fill(rec, level, tag, fmt, args); });
+    if (pushed) {
+      m_pushed.fetch_add(1, std::memory_order_release);
+      // 로그 스레드가 대기 중일 때만 깨움 (깨우기에 실패하더라도 최대 k_idleWaitMs 후에는 출력됨)
+      if (m_consumerSleeping.exchange(false, std::memory_order_acq_rel)) {
+        m_wakeCv.notify_one();
+      }
+      return;
+    }
+
+    if (level == LogLevel::Error) {
+      // 버퍼가 가득 차도 에러는 유실하지 않도록 호출한 스레드에서 바로 출력
+      LogRecord rec;
+      fill(rec, level, tag, fmt, args);
+      std::lock_guard<std::mutex> lock(m_sinkMtx);
+      writeSink(rec);
+      return;
+    }
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+  };
+
+  bool setLogFile(const char* path) {
+    FILE* file = nullptr;
+    if (path) {
+      file = std::fopen(path, "a");
+      if (!file) return false;
+    }
+    std::lock_guard<std::mutex> lock(m_sinkMtx);
+    if (m_file) {
+      std::fclose(m_file);
+    }
+    m_file = file;
+    return true;
+  };
+
+  void flush() {
+    const size_t target = m_pushed.load(std::memory_order_acquire);
+    m_consumerSleeping.store(false);
+    m_wakeCv.notify_one();
+
+    std::unique_lock<std::mutex> lock(m_flushMtx);
+    m_flushCv.wait_for(lock, std::chrono::seconds(2), [&]() { return m_written.load() >= target; });
+  };
+
+  size_t droppedCount() const { return m_dropped.load(std::memory_order_relaxed); };
+
+private:
+  LogBackend() {
+    // 프로세스가 끝날 때까지 살아있는 로그 스레드 (LogBackend 를 해제하지 않으므로 join 하지 않음)
+    std::thread([this]() { run(); }).detach();
+  };
+
+  static void fill(LogRecord& rec, LogLevel level, const char* tag, const char* fmt, va_list args) {
+    rec.level = level;
+    rec.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::snprintf(rec.tag, sizeof(rec.tag), "%s", tag ? tag : "");
+    va_list copy;
+    va_copy(copy, args);
+    std::vsnprintf(rec.message, sizeof(rec.message), fmt ? fmt : "", copy);
+    va_end(copy);
+  };
+
+  void run() {
+    LogRecord rec;
+    size_t reportedDrops = 0;
+    for (;;) {
+      // 쌓인 로그를 한 번에 출력 (sink 잠금은 배치 단위로 한 번만)
+      bool wrote = false;
+      {
+        std::lock_guard<std::mutex> lock(m_sinkMtx);
+        while (m_ring.tryPop(rec)) {
+          writeSink(rec);
+          m_written.fetch_add(1, std::memory_order_release);
+          wrote = true;
+        }
+
+        const size_t dropped = m_dropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops) {
+          LogRecord note;
+          note.level = LogLevel::Warn;
+          note.timeMs = rec.timeMs;
+          std::snprintf(note.tag, sizeof(note.tag), "%s", k_logTag);
+          std::snprintf(note.message, sizeof(note.message), "%zu log messages dropped (buffer full)", dropped - reportedDrops);
+          writeSink(note);
+          reportedDrops = dropped;
+        }
+        if (wrote && m_file) {
+          std::fflush(m_file);
+        } else if (wrote) {
+          std::fflush(stdout);
+        }
+      }
+      if (wrote) {
+        std::lock_guard<std::mutex> lock(m_flushMtx);
+        m_flushCv.notify_all();
+      }
+
+      std::unique_lock<std::mutex> lock(m_wakeMtx);
+      m_consumerSleeping.store(true, std::memory_order_release);
+      m_wakeCv.wait_for(lock, std::chrono::milliseconds(k_idleWaitMs), [this]() {
+        return !m_consumerSleeping.load(std::memory_order_acquire);
+      });
+      m_consumerSleeping.store(false, std::memory_order_release);
+    }
+  };
+
+  // m_sinkMtx 를 잡은 상태에서 호출
+  void writeSink(const LogRecord& rec) {
 #if defined (__ANDROID__)
-  va_list args;
-  va_start(args, fmt);
-  __android_log_vprint(ANDROID_LOG_DEBUG, tag.c_str(), fmt, args);
-  va_end(args);
+    static constexpr int k_priorities[] = { ANDROID_LOG_VERBOSE, ANDROID_LOG_DEBUG, ANDROID_LOG_INFO, ANDROID_LOG_WARN, ANDROID_LOG_ERROR };
+    __android_log_write(k_priorities[(int)rec.level], rec.tag, rec.message);
+    if (!m_file) return;
 #elif defined(__APPLE__) && TARGET_OS_IOS
-  // TODO : implement iOS logging backend
+    // TODO : implement iOS logging backend
+    if (!m_file) return;
 #endif
+    // stdout / 파일 : "HH:MM:SS.mmm L/tag: message"
+    static constexpr char k_levelChars[] = { 'V', 'D', 'I', 'W', 'E' };
+    const std::time_t sec = (std::time_t)(rec.timeMs / 1000);
+    std::tm tm{};
+    localtime_r(&sec, &tm);
+    std::fprintf(m_file ? m_file : stdout, "%02d:%02d:%02d.%03d %c/%s: %s\n",
+                 tm.tm_hour, tm.tm_min, tm.tm_sec, (int)(rec.timeMs % 1000), k_levelChars[(int)rec.level], rec.tag, rec.message);
+  };
+
+private:
+  LogRingBuffer<LogRecord, 512> m_ring;             // 호출 스레드 -> 로그 스레드 레코드 전달 (약 256KB)
+  std::atomic<size_t> m_pushed = 0;                 // 링 버퍼에 넣은 레코드 수
+  std::atomic<size_t> m_written = 0;                // 로그 스레드가 출력한 레코드 수 (flush 대기용)
+  std::atomic<size_t> m_dropped = 0;                // 버퍼가 가득 차서 버린 레코드 수
+  std::atomic<bool> m_consumerSleeping = false;     // 로그 스레드 대기 여부 (대기 중일 때만 notify)
+
+  std::mutex m_wakeMtx;                             // m_wakeCv 용 mutex
+  std::condition_variable m_wakeCv;                 // 로그 스레드 깨우기
+  std::mutex m_flushMtx;                            // m_flushCv 용 mutex
+  std::condition_variable m_flushCv;                // 출력 진행을 flush() 대기자에게 알림
+  std::mutex m_sinkMtx;                             // m_file 및 출력 순서 보호
+  FILE* m_file = nullptr;                           // 파일 출력 대상 (nullptr 이면 stdout / logcat)
+
+private:
+  static constexpr int k_idleWaitMs = 50;           // 깨우기 신호를 놓쳤을 때의 최대 출력 지연
+  static constexpr const char* k_logTag = "Logger";
 };
 
-void Logger::info(const std::string& tag, const char* fmt, ...) {
-#if defined (__ANDROID__)
+} // namespace
+
+void Logger::write(LogLevel level, const char* tag, const char* fmt, ...) {
   va_list args;
   va_start(args, fmt);
-  __android_log_vprint(ANDROID_LOG_INFO, tag.c_str(), fmt, args);
+  LogBackend::instance().push(level, tag, fmt, args);
   va_end(args);
-#elif defined(__APPLE__) && TARGET_OS_IOS
-  // TODO : implement iOS logging backend
-#endif
 };
 
-void Logger::warn(const std::string& tag, const char* fmt, ...) {
-#if defined (__ANDROID__)
-  va_list args;
-  va_start(args, fmt);
-  __android_log_vprint(ANDROID_LOG_WARN, tag.c_str(), fmt, args);
-  va_end(args);
-#elif defined(__APPLE__) && TARGET_OS_IOS
-  // TODO : implement iOS logging backend
-#endif
+bool Logger::setLogFile(const char* path) {
+  return LogBackend::instance().setLogFile(path);
 };
 
-void Logger::error(const std::string& tag, const char* fmt, ...) {
-#if defined (__ANDROID__)
-  va_list args;
-  va_start(args, fmt);
-  __android_log_vprint(ANDROID_LOG_ERROR, tag.c_str(), fmt, args);
-  va_end(args);
-#elif defined(__APPLE__) && TARGET_OS_IOS
-  // TODO : implement iOS logging backend
-#endif
+void Logger::flush() {
+  LogBackend::instance().flush();
 };
 
+size_t Logger::droppedCount() {
+  return LogBackend::instance().droppedCount();
+};
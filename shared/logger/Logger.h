@@ -1,11 +1,71 @@
 #pragma once
-#include <string>
+#include <cstddef>
+
+// 로그 레벨 (값이 클수록 중요)
+enum class LogLevel : int
+{
+  Verbose = 0,
+  Debug = 1,
+  Info = 2,
+  Warn = 3,
+  Error = 4,
+};
+
+/**
+ * 컴파일 시점 로그 레벨 필터
+ * - 이 값보다 낮은 레벨의 Logger 호출은 if constexpr 로 통째로 제거되어 release 빌드에서 비용이 0 이 된다.
+ * - 빌드 옵션으로 -DLOGGER_MIN_LEVEL=<0~4> 를 지정해 덮어쓸 수 있다. (기본: release(NDEBUG) 는 Info, debug 는 Verbose)
+ */
+#ifndef LOGGER_MIN_LEVEL
+  #if defined (NDEBUG)
+    #define LOGGER_MIN_LEVEL 2
+  #else
+    #define LOGGER_MIN_LEVEL 0
+  #endif
+#endif
+
+/**
+ * 비동기 로거
+ *
+ * - 호출한 스레드는 고정 크기 레코드에 메시지를 포맷팅해 lock-free 링 버퍼에 넣기만 하고 바로 반환한다.
+ *   실제 출력(logcat / stdout / 파일)은 백그라운드 로그 스레드가 모아서 수행하므로
+ *   렌더링/인코딩 스레드가 출력 I/O 나 잠금 때문에 멈추지 않는다.
+ * - tag 는 k_logTag 같은 문자열 리터럴(const char*)을 그대로 받으므로 호출마다 std::string 임시 객체가 생기지 않는다.
+ * - 링 버퍼가 가득 차면 Error 는 호출한 스레드에서 바로 출력하고, 나머지 레벨은 버린 뒤 개수만 기록한다.
+ * - 포맷팅은 호출 시점에 수행한다. (가변 인자로 넘어온 c_str() 등의 포인터는 호출이 끝나면 유효하지 않을 수 있음)
+ */
+class Logger
+{
+public:
+  template <typename... Args>
+  static void verbose(const char* tag, const char* fmt, Args... args) { log<LogLevel::Verbose>(tag, fmt, args...); };
+  template <typename... Args>
+  static void debug(const char* tag, const char* fmt, Args... args) { log<LogLevel::Debug>(tag, fmt, args...); };
+  template <typename... Args>
+  static void info(const char* tag, const char* fmt, Args... args) { log<LogLevel::Info>(tag, fmt, args...); };
+  template <typename... Args>
+  static void warn(const char* tag, const char* fmt, Args... args) { log<LogLevel::Warn>(tag, fmt, args...); };
+  template <typename... Args>
+  static void error(const char* tag, const char* fmt, Args... args) { log<LogLevel::Error>(tag, fmt, args...); };
 
-class Logger {
 public:
-  static void verbose(const std::string& tag, const char* fmt, ...);
-  static void debug(const std::string& tag, const char* fmt, ...);
-  static void info(const std::string& tag, const char* fmt, ...);
-  static void warn(const std::string& tag, const char* fmt, ...);
-  static void error(const std::string& tag, const char* fmt, ...);
-};
\ No newline at end of file
+  /**
+   * Linux 등 logcat 이 없는 플랫폼의 출력 대상 설정 (nullptr 이면 stdout). 파일은 이어쓰기 모드로 연다.
+   * @return 파일을 열지 못했으면 false (기존 출력 대상 유지)
+   */
+  static bool setLogFile(const char* path);
+  // 지금까지 기록 요청된 로그가 모두 출력될 때까지 대기 (종료 직전 / 크래시 리포트 전 등)
+  static void flush();
+  // 링 버퍼가 가득 차서 버려진 로그 수
+  static size_t droppedCount();
+
+private:
+  template <LogLevel Level, typename... Args>
+  static void log([[maybe_unused]] const char* tag, [[maybe_unused]] const char* fmt, [[maybe_unused]] Args... args) {
+    if constexpr ((int)Level >= LOGGER_MIN_LEVEL) {
+      write(Level, tag, fmt, args...);
+    }
+  };
+
+  static void write(LogLevel level, const char* tag, const char* fmt, ...);
+};
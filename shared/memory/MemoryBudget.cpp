@@ -0,0 +1,156 @@
+#include "MemoryBudget.h"
+#include "../logger/Logger.h"
+#include <algorithm>
+
+MemoryBudget::Registration& MemoryBudget::Registration::operator=(Registration&& other) noexcept {
+  if (this != &other) {
+    reset();
+    m_owner = std::move(other.m_owner);
+    m_id = other.m_id;
+    other.m_owner.reset();
+    other.m_id = -1;
+  }
+  return *this;
+};
+
+void MemoryBudget::Registration::reset() {
+  if (m_id >= 0) {
+    if (auto owner = m_owner.lock()) {
+      owner->removeSource(m_id);
+    }
+  }
+  m_owner.reset();
+  m_id = -1;
+};
+
+std::shared_ptr<MemoryBudget> MemoryBudget::create(size_t budgetBytes) {
+  // 생성자가 private 이므로 make_shared 대신 직접 생성
+  return std::shared_ptr<MemoryBudget>(new MemoryBudget(budgetBytes));
+};
+
+MemoryBudget::Registration MemoryBudget::addSource(const std::string& name, MemoryCategory category, UsageFn usage, TrimFn trim, int evictionOrder) {
+  if (!usage || category == MemoryCategory::Count) {
+    Logger::error(k_logTag, "Invalid memory source: %s", name.c_str());
+    return Registration();
+  }
+
+  std::lock_guard<std::mutex> lock(m_mtx);
+  Source source;
+  source.id = m_nextId++;
+  source.name = name;
+  source.category = category;
+  source.usage = std::move(usage);
+  source.trim = std::move(trim);
+  source.evictionOrder = evictionOrder;
+
+  // evictionOrder 오름차순 유지 (같은 순서끼리는 등록 순)
+  auto pos = std::upper_bound(m_sources.begin(), m_sources.end(), evictionOrder,
+                              [](int order, const Source& s) { return order < s.evictionOrder; });
+  const int id = source.id;
+  m_sources.insert(pos, std::move(source));
+  return Registration(weak_from_this(), id);
+};
+
+void MemoryBudget::removeSource(int id) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_sources.erase(std::remove_if(m_sources.begin(), m_sources.end(), [id](const Source& s) { return s.id == id; }),
+                  m_sources.end());
+};
+
+MemoryStats MemoryBudget::stats() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  MemoryStats stats;
+  for (const auto& s : m_sources) {
+    const size_t bytes = s.usage();
+    stats.bytes[(size_t)s.category] += bytes;
+    stats.totalBytes += bytes;
+  }
+  stats.budgetBytes = m_budgetBytes;
+  return stats;
+};
+
+size_t MemoryBudget::totalLocked() const {
+  size_t total = 0;
+  for (const auto& s : m_sources) {
+    total += s.usage();
+  }
+  return total;
+};
+
+size_t MemoryBudget::trimMemory(TrimLevel level) {
+  if (level == TrimLevel::None) return 0;
+
+  std::lock_guard<std::mutex> lock(m_mtx);
+
+  // level 별 목표치: Light 는 예산의 75%, Moderate 는 50%, Critical 은 전부 회수
+  size_t target = 0;
+  if (level == TrimLevel::Light) {
+    target = m_budgetBytes / 4 * 3;
+  } else if (level == TrimLevel::Moderate) {
+    target = m_budgetBytes / 2;
+  }
+
+  const size_t before = totalLocked();
+  size_t total = before;
+  for (const auto& s : m_sources) {
+    if (level != TrimLevel::Critical && total <= target) break;
+    if (!s.trim) continue;
+
+    const size_t usage = s.usage();
+    if (usage == 0) continue;
+    s.trim(level);
+
+    // GPU 리소스처럼 다른 스레드에서 비동기로 해제되는 source 는 여기서 줄어들지 않을 수 있음 (다음 조회 시 반영)
+    const size_t after = s.usage();
+    if (after < usage) {
+      total -= (usage - after);
+    }
+  }
+
+  const size_t freed = before - total;
+  Logger::info(k_logTag, "trimMemory(level=%d) %zu -> %zu bytes (budget %zu)", (int)level, before, total, m_budgetBytes);
+  return freed;
+};
+
+size_t MemoryBudget::enforceBudget() {
+  size_t freed = 0;
+  for (TrimLevel level : { TrimLevel::Light, TrimLevel::Moderate }) {
+    if (stats().totalBytes <= budgetBytes()) break;
+    freed += trimMemory(level);
+  }
+  return freed;
+};
+
+void MemoryBudget::setBudgetBytes(size_t budgetBytes) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_budgetBytes = budgetBytes;
+};
+
+size_t MemoryBudget::budgetBytes() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_budgetBytes;
+};
+
+TrimLevel MemoryBudget::levelFromAndroid(int androidLevel) {
+  /**
+   * ComponentCallbacks2.TRIM_MEMORY_*
+   * - RUNNING_MODERATE(5), RUNNING_LOW(10)        -> Light
+   * - RUNNING_CRITICAL(15), UI_HIDDEN(20)         -> Moderate (UI 가 숨겨졌으면 Preview 캐시는 당장 필요 없음)
+   * - BACKGROUND(40)                              -> Moderate
+   * - MODERATE(60), COMPLETE(80)                  -> Critical (LRU 목록에서 곧 종료될 수 있음)
+   */
+  if (androidLevel >= 60) return TrimLevel::Critical;
+  if (androidLevel >= 15) return TrimLevel::Moderate;
+  if (androidLevel >= 5) return TrimLevel::Light;
+  return TrimLevel::None;
+};
+
+const char* MemoryBudget::categoryName(MemoryCategory category) {
+  switch (category) {
+    case MemoryCategory::Encoded: return "encoded";
+    case MemoryCategory::Decoded: return "decoded";
+    case MemoryCategory::RenderTargets: return "renderTargets";
+    case MemoryCategory::Caches: return "caches";
+    default: return "unknown";
+  }
+};
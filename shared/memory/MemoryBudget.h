@@ -0,0 +1,135 @@
+#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+// 메모리 사용처 분류
+enum class MemoryCategory
+{
+  Encoded,        // 압축된 원본 바이트 (SkData: jpeg/png 등)
+  Decoded,        // CPU 메모리에 디코딩된 raster 이미지 (thumbnail/proxy/디코딩 캐시)
+  RenderTargets,  // 화면/인코더 surface 및 offscreen render target
+  Caches,         // Skia 내부 캐시 (GrDirectContext 리소스 캐시, SkResourceCache)
+  Count,
+};
+
+// 메모리 회수 강도 (Android ComponentCallbacks2::onTrimMemory 레벨을 단순화)
+enum class TrimLevel
+{
+  None,           // 회수 불필요
+  Light,          // 앱 실행 중 메모리 부족 초기 신호 / UI 숨김 -> 다시 만들기 쉬운 캐시부터 일부 회수
+  Moderate,       // 메모리 부족 심화 / 백그라운드 진입 -> 캐시 대부분 회수
+  Critical,       // 곧 프로세스가 종료될 수 있는 상황 -> 회수 가능한 모든 것 회수
+};
+
+// 분류별 메모리 사용량 스냅샷
+struct MemoryStats
+{
+  std::array<size_t, (size_t)MemoryCategory::Count> bytes{};  // 분류별 사용량(byte)
+  size_t totalBytes = 0;                                       // 전체 사용량(byte)
+  size_t budgetBytes = 0;                                      // 설정된 예산(byte)
+
+  size_t of(MemoryCategory c) const { return bytes[(size_t)c]; };
+};
+
+/**
+ * 서브시스템별 메모리 사용량을 한 곳에서 집계하고, 메모리 부족 시 정해진 우선순위대로 캐시를 회수하는 관리자
+ *
+ * - 각 서브시스템(디코딩 캐시, Timeline, Renderer 등)은 addSource() 로 "현재 사용량 조회 함수"와 "회수 함수"를 등록한다.
+ *   -> 할당 지점마다 계측 코드를 심는 대신, 조회 시점에 각 소유자가 자신의 사용량을 보고하므로 이중 집계/누락이 적다.
+ * - trimMemory(level) 은 evictionOrder 가 작은 source(다시 만들기 쉬운 캐시)부터 회수 함수를 호출하며,
+ *   level 별 목표치(예산의 75% / 50% / 0%) 아래로 내려가면 멈춘다.
+ * - 조회/회수 함수는 내부 mutex 를 잡은 상태에서 호출되므로 스레드 안전해야 하며, MemoryBudget 을 다시 호출하면 안 된다.
+ *   (GPU 리소스처럼 특정 스레드에서만 해제할 수 있는 자원은 회수 요청만 해당 스레드로 전달하고 즉시 반환)
+ */
+class MemoryBudget : public std::enable_shared_from_this<MemoryBudget>
+{
+public:
+  using UsageFn = std::function<size_t()>;
+  using TrimFn = std::function<void(TrimLevel)>;
+
+  /**
+   * addSource() 가 반환하는 등록 핸들 (소멸 시 자동으로 등록 해제)
+   * - source 를 소유한 객체의 멤버로 두면 해당 객체가 먼저 사라져도 dangling 콜백이 남지 않는다.
+   * - MemoryBudget 이 먼저 사라진 경우에는 아무것도 하지 않는다.
+   */
+  class Registration
+  {
+  public:
+    Registration() = default;
+    Registration(std::weak_ptr<MemoryBudget> owner, int id) : m_owner(std::move(owner)), m_id(id) {};
+    ~Registration() { reset(); };
+    Registration(Registration&& other) noexcept { *this = std::move(other); };
+    Registration& operator=(Registration&& other) noexcept;
+    Registration(const Registration&) = delete;
+    Registration& operator=(const Registration&) = delete;
+
+    void reset();
+
+  private:
+    std::weak_ptr<MemoryBudget> m_owner;
+    int m_id = -1;
+  };
+
+public:
+  // Registration 이 weak_ptr 로 참조하므로 반드시 shared_ptr 로 생성
+  static std::shared_ptr<MemoryBudget> create(size_t budgetBytes = k_defaultBudgetBytes);
+
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+public:
+  /**
+   * 메모리 source 등록
+   * @param name           통계/로그용 이름
+   * @param category       사용량을 집계할 분류
+   * @param usage          현재 사용량(byte) 조회 함수
+   * @param trim           회수 함수 (nullptr 이면 집계만 하고 회수하지 않음)
+   * @param evictionOrder  회수 순서 (작을수록 먼저 회수 = 다시 만들기 쉬운 캐시)
+   */
+  Registration addSource(const std::string& name, MemoryCategory category, UsageFn usage, TrimFn trim = nullptr, int evictionOrder = 0);
+
+  // 분류별 현재 사용량 집계
+  MemoryStats stats() const;
+
+  // 주어진 강도로 메모리 회수 (evictionOrder 순). 회수된 양(추정치, byte) 반환
+  size_t trimMemory(TrimLevel level);
+  // 사용량이 예산을 넘었을 때만 강도를 높여가며 예산 안으로 들어올 때까지 회수
+  size_t enforceBudget();
+
+  void setBudgetBytes(size_t budgetBytes);
+  size_t budgetBytes() const;
+
+  // Android ComponentCallbacks2 의 TRIM_MEMORY_* 값을 TrimLevel 로 변환
+  static TrimLevel levelFromAndroid(int androidLevel);
+  static const char* categoryName(MemoryCategory category);
+
+private:
+  explicit MemoryBudget(size_t budgetBytes) : m_budgetBytes(budgetBytes) {};
+
+  void removeSource(int id);
+  size_t totalLocked() const;
+
+private:
+  struct Source
+  {
+    int id = 0;
+    std::string name;
+    MemoryCategory category = MemoryCategory::Caches;
+    UsageFn usage;
+    TrimFn trim;
+    int evictionOrder = 0;
+  };
+
+  mutable std::mutex m_mtx;               // m_sources / m_budgetBytes 보호 (조회/회수 함수 호출 중에도 유지)
+  std::vector<Source> m_sources;          // evictionOrder 오름차순으로 유지
+  size_t m_budgetBytes;                   // 메모리 예산(byte)
+  int m_nextId = 1;                       // 다음에 발급할 source ID
+
+private:
+  static constexpr size_t k_defaultBudgetBytes = 384 * 1024 * 1024; // 기본 예산 384MB
+  static constexpr const char* k_logTag = "MemoryBudget";
+};
@@ -1,15 +1,18 @@
 #include "../preview/PreviewController.h"
 #include "../render/Renderer.h"
 #include "../video/Timeline.h"
+#include "../video/ClipLoader.h"
+#include "../project/ProjectFile.h"
 #include "../logger/Logger.h"
-#include <core/SkData.h>
-#include <core/SkImage.h>
-#include <core/SkRect.h>
+#include "../trace/Trace.h"
+#include <algorithm> // std::min
 
 PreviewController::PreviewController(std::shared_ptr<Renderer> renderer)
   : m_pRenderer(std::move(renderer)) {};
 
 bool PreviewController::setImageSequence(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec) {
+  TRACE_SCOPE("import", "setImageSequence");
+
   // 1) 필수 체크: Renderer 준비 여부 확인
   if (!m_pRenderer) {
     Logger::error(k_logTag, "Renderer not set");
@@ -17,55 +20,202 @@ bool PreviewController::setImageSequence(const std::vector<std::string>& paths,
   }
 
   // 2) 파일 경로 배열을 돌면서 이미지를 메모리로 읽어옴.
-  //    - SkData::MakeFromFileName: 파일을 바이트로 읽음
-  //    - SkImage::MakeFromEncoded: 바이트(압축)를 SkImage로 디코드(필요 시 지연 디코드)
-  std::vector<sk_sp<SkImage>> images;
-  images.reserve(paths.size());
-  for (const auto& p : paths) {
-    sk_sp<SkData> data = SkData::MakeFromFileName(p.c_str());
-    if (!data) {
-      Logger::warn(k_logTag, "Read failed: %s", p.c_str());
-      continue; // 바이트 읽기 실패한 파일은 건너뜀.
-    }
-    sk_sp<SkImage> img = SkImages::DeferredFromEncodedData(std::move(data));
-    if (img) {
-      images.push_back(std::move(img));
-    }
-  }
+  //    - Preview 화면 크기에 맞춘 proxy 와 seek/scrub 용 thumbnail 을 import 시점에 미리 축소 생성 (원본은 인코딩(export) 시에만 사용)
+  //    - 그릴 영역(dst)은 Preview 의 가로 크기에 맞추고 세로는 가운데 정렬 (ClipLoader::fitWidthRect)
+  ClipLoadOptions opts;
+  opts.width = m_pRenderer->surfaceWidth();
+  opts.height = m_pRenderer->surfaceHeight();
+  opts.makeThumbnail = true;
+  opts.makeProxy = true;
+  //    - Ken Burns 애니메이션으로 확대되는 만큼 proxy 를 크게 만들어 확대 중에도 원본 대신 proxy 를 그리도록 함
+  opts.proxyScale = m_kenBurns ? ClipMotion::k_maxScale : 1.0f;
+  opts.onProgress = m_importProgress;
+  std::vector<Timeline::ClipRenderData> renderDataList = ClipLoader::load(paths, opts);
 
   // SkImage 를 하나도 생성하지 못했다면 Timeline 생성 중단
-  if (images.empty()) {
+  if (renderDataList.empty()) {
     Logger::warn(k_logTag, "No images loaded");
     return false;
   }
 
-  std::vector<Timeline::ClipRenderData> renderDataList;
-  for (auto& img : images) {
-    // 3) 그릴 영역(dst) 설정
-    //    - Preview 의 가로/세로 크기만큼 꽉 채우도록 사각형을 만듦.
-    //    - 나중에 contain/cover 같은 맞춤 모드가 필요하면 여기서 계산을 바꾸면 됩니다.
-    //    - 모든 클립 이미지는 가운데 정렬 + 모든 클립의 width 를 dstW 에 맞추고, height 는 비율에 맞게 조정 + height 가 dstH 보다 커지면 crop 처리
-    float width = static_cast<float>(m_pRenderer->surfaceWidth());
-    float height = width * (static_cast<float>(img->height()) / static_cast<float>(img->width()));
-    float x = 0.0f;
-    float y = (static_cast<float>(m_pRenderer->surfaceHeight()) - height) / 2.0f;
-    renderDataList.emplace_back(img, SkRect::MakeXYWH(x, y, width, height));
-  }
-
-  // 4) 타임라인 생성
+  // 3) 타임라인 생성
   //    - 각 이미지당 clipDurSec초 보여주고
   //    - 장면 끝부분에서 xfadeSec초 동안 다음 이미지와 겹치게(부드러운 전환)
-  //    - dst 위치/크기로 렌더되도록 설정
-  auto timeline = Timeline::FromClipRenderData(renderDataList, clipDurSec, xfadeSec);
+  //    - dst 위치/크기로 렌더되도록 설정 (Ken Burns 가 켜져 있으면 클립마다 프리셋 애니메이션을 번갈아 적용)
+  static const std::vector<std::shared_ptr<const ClipMotion>> s_noMotion;
+  const auto& motions = m_kenBurns ? ClipMotion::kenBurnsPresets() : s_noMotion;
+  auto timeline = Timeline::FromClipRenderData(renderDataList, clipDurSec, xfadeSec, m_transitions, motions);
   if (!timeline) {
     Logger::warn(k_logTag, "Timeline creation failed");
     return false;
   }
 
+  // 4) export 시 함께 기록할 오디오 설정 (Preview 재생에는 사용하지 않음)
+  //    - 이전 시퀀스(loadProject 로 복원한 프로젝트 등)의 클립별 오디오는 새 클립과 맞지 않으므로 버리고 배경 음악만 유지
+  m_audio.clipAudioPaths.clear();
+  m_audio.fixedClips.clear();
+  m_audio.applyTo(*timeline);
+
   // 5) 총 길이를 기록해 두고, Renderer에 새 타임라인을 적용.
   m_lastDurationSec = timeline->totalDuration();
+  m_canvasWidth = opts.width;
+  m_canvasHeight = opts.height;
+  m_clipDurSec = clipDurSec;
+  m_xfadeSec = xfadeSec;
+  m_sequence = ClipSequence::fromSegments(timeline->segments(0));
+  m_pRenderer->setTimeline(std::move(timeline));
+
+  return true;
+};
+
+void PreviewController::setTransitions(std::vector<TransitionType> transitions) {
+  m_transitions = std::move(transitions);
+};
+
+void PreviewController::setKenBurnsEnabled(bool enabled) {
+  m_kenBurns = enabled;
+};
+
+void PreviewController::setBackgroundMusic(const std::string& path, float gain) {
+  m_audio.musicPath = path;
+  m_audio.musicGain = gain;
+};
+
+void PreviewController::setImportProgressListener(std::function<void(int done, int total)> listener) {
+  m_importProgress = std::move(listener);
+};
+
+bool PreviewController::saveProject(const std::string& path) const {
+  std::shared_ptr<Timeline> timeline = m_pRenderer ? m_pRenderer->timelineSnapshot() : nullptr;
+  if (!timeline) {
+    Logger::warn(k_logTag, "No timeline to save");
+    return false;
+  }
+  return ProjectFile::save(path, *timeline, m_canvasWidth, m_canvasHeight);
+};
+
+bool PreviewController::loadProject(const std::string& path) {
+  TRACE_SCOPE("import", "loadProject");
+  if (!m_pRenderer) {
+    Logger::error(k_logTag, "Renderer not set");
+    return false;
+  }
+
+  ProjectFile project;
+  if (!project.open(path)) return false;
+
+  // setImageSequence 와 같은 Preview 용 이미지(thumbnail/proxy) 생성. 배치(dst)는 파일에 저장된 값을 현재 surface 크기로 변환해 사용
+  ClipLoadOptions opts;
+  opts.width = m_pRenderer->surfaceWidth();
+  opts.height = m_pRenderer->surfaceHeight();
+  opts.makeThumbnail = true;
+  opts.makeProxy = true;
+  opts.onProgress = m_importProgress;
+  std::shared_ptr<Timeline> timeline = project.buildTimeline(opts);
+  if (!timeline) {
+    Logger::warn(k_logTag, "Project has no loadable clips: %s", path.c_str());
+    return false;
+  }
+
+  // 이후 편집(applyEdit)에서 오디오가 사라지지 않도록 저장된 오디오 클립을 편집용 설정으로 되돌리고,
+  // 새로 추가하는 클립은 프로젝트의 첫 클립과 같은 길이/전환으로 맞춤
+  const std::vector<Timeline::Segment>& segs = timeline->segments(0);
+  m_audio = TimelineAudio::fromTimeline(*timeline);
+  m_clipDurSec = segs.front().duration;
+  m_xfadeSec = segs.front().xfade;
+
+  m_lastDurationSec = timeline->totalDuration();
+  m_canvasWidth = opts.width;
+  m_canvasHeight = opts.height;
+  m_sequence = ClipSequence::fromSegments(segs);
   m_pRenderer->setTimeline(std::move(timeline));
+  return true;
+};
+
+bool PreviewController::insertClip(int index, const std::string& path) {
+  if (m_sequence.empty() || index < 0) return false;
+  Timeline::Segment seg;
+  if (!loadClip(path, seg.clip)) return false;
+
+  // 새 클립은 setImageSequence 와 같은 규칙으로 길이/전환/애니메이션 지정
+  seg.duration = m_clipDurSec;
+  seg.xfade = m_xfadeSec;
+  if (!m_transitions.empty()) {
+    seg.transition = m_transitions[index % m_transitions.size()];
+  }
+  if (m_kenBurns) {
+    const auto& presets = ClipMotion::kenBurnsPresets();
+    seg.motion = presets[index % presets.size()];
+  }
+  TimelineAudio audio = m_audio;
+  audio.insertClip((size_t)index);
+  return applyEdit(m_sequence.insert((size_t)index, std::move(seg)), std::move(audio));
+};
+
+bool PreviewController::removeClip(int index) {
+  // 기본 트랙이 비면 Timeline 을 그릴 수 없으므로 마지막 클립은 지우지 않음
+  if (index < 0 || (size_t)index >= m_sequence.size() || m_sequence.size() <= 1) return false;
+  TimelineAudio audio = m_audio;
+  audio.eraseClip((size_t)index);
+  return applyEdit(m_sequence.erase((size_t)index), std::move(audio));
+};
+
+bool PreviewController::moveClip(int from, int to) {
+  if (from < 0 || to < 0 || (size_t)from >= m_sequence.size()) return false;
+  // 범위를 넘는 to 는 맨 뒤로 옮기는 것으로 처리 (ClipSequence::move 와 같은 규칙)
+  to = std::min(to, (int)m_sequence.size() - 1);
+  if (from == to) return true;
+  TimelineAudio audio = m_audio;
+  audio.moveClip((size_t)from, (size_t)to);
+  return applyEdit(m_sequence.move((size_t)from, (size_t)to), std::move(audio));
+};
+
+bool PreviewController::retimeClip(int index, double durationSec, double xfadeSec) {
+  if (index < 0 || (size_t)index >= m_sequence.size() || durationSec <= 0.0) return false;
+  return applyEdit(m_sequence.retime((size_t)index, durationSec, xfadeSec), m_audio);
+};
 
+bool PreviewController::replaceClip(int index, const std::string& path) {
+  if (index < 0 || (size_t)index >= m_sequence.size()) return false;
+  // 길이/전환/애니메이션은 유지하고 이미지만 교체
+  Timeline::Segment seg = m_sequence.at((size_t)index);
+  if (!loadClip(path, seg.clip)) return false;
+  return applyEdit(m_sequence.replace((size_t)index, std::move(seg)), m_audio);
+};
+
+bool PreviewController::loadClip(const std::string& path, Timeline::ClipRenderData& out) const {
+  ClipLoadOptions opts;
+  opts.width = m_canvasWidth;
+  opts.height = m_canvasHeight;
+  opts.makeThumbnail = true;
+  opts.makeProxy = true;
+  opts.proxyScale = m_kenBurns ? ClipMotion::k_maxScale : 1.0f;
+  std::vector<Timeline::ClipRenderData> loaded = ClipLoader::load({ path }, opts);
+  if (loaded.empty()) {
+    Logger::warn(k_logTag, "Cannot load clip: %s", path.c_str());
+    return false;
+  }
+  out = std::move(loaded.front());
+  return true;
+};
+
+bool PreviewController::applyEdit(ClipSequence sequence, TimelineAudio audio) {
+  TRACE_SCOPE_ARG("edit", "applyEdit", "clips", sequence.size());
+  std::shared_ptr<Timeline> current = m_pRenderer ? m_pRenderer->timelineSnapshot() : nullptr;
+  if (!current) {
+    Logger::warn(k_logTag, "No timeline to edit");
+    return false;
+  }
+
+  // 기본 트랙은 편집된 ClipSequence 를 그대로 공유(펼치지 않음)하고 overlay 트랙은 현재 Timeline 과 공유.
+  // 클립 오디오/배경 음악은 바뀐 클립 배치/길이에 맞춰 다시 배치
+  std::shared_ptr<Timeline> timeline = current->withSequence(0, sequence);
+  audio.applyTo(*timeline);
+
+  m_sequence = std::move(sequence);
+  m_audio = std::move(audio);
+  m_lastDurationSec = timeline->totalDuration();
+  m_pRenderer->setTimeline(std::move(timeline), true);
   return true;
 };
 
@@ -87,6 +237,12 @@ void PreviewController::previewStop() {
   }
 };
 
+void PreviewController::previewSeek(double tSec) {
+  if (m_pRenderer) {
+    m_pRenderer->previewSeek(tSec);
+  }
+};
+
 double PreviewController::durationSec() const {
   return m_lastDurationSec;
 };
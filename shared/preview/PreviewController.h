@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include "../render/Renderer.h"
+#include "../video/TimelineAudio.h"
+#include "../video/ClipSequence.h"
 
 class PreviewController
 {
@@ -13,14 +15,56 @@ public:
   /** Preview 제어 함수 */
   // 파일 경로 배열을 받아 SkImage 로드 -> Timeline 생성하여 Renderer 객체에 적용
   bool setImageSequence(const std::vector<std::string>& paths, double clipDurSec, double xfadeSec);
+  // 다음 setImageSequence 부터 적용할 클립 사이 전환 방식 (클립 수보다 적으면 반복 적용, 비어있으면 crossfade)
+  void setTransitions(std::vector<TransitionType> transitions);
+  // 다음 setImageSequence 부터 클립마다 Ken Burns(pan/zoom) 애니메이션 적용 여부
+  void setKenBurnsEnabled(bool enabled);
+  // 다음 setImageSequence 부터 export 시 함께 기록할 배경 음악 (빈 경로면 없음, Preview 재생 중에는 소리를 내지 않음)
+  void setBackgroundMusic(const std::string& path, float gain);
+  // setImageSequence 의 이미지 로드 진행 알림 (setImageSequence 를 호출한 스레드에서 호출되므로 import 전에 설정)
+  void setImportProgressListener(std::function<void(int done, int total)> listener);
+  // 현재 Timeline 을 바이너리 프로젝트 파일로 저장 (ProjectFile 참고)
+  bool saveProject(const std::string& path) const;
+  // 프로젝트 파일로 Timeline 을 복원해 Renderer 에 적용 (현재 surface 크기에 맞춰 dst 변환)
+  bool loadProject(const std::string& path);
+
+  /**
+   * 기본 사진 트랙 편집 (setImageSequence/loadProject 로 만든 Timeline 기준, 실패하면 false)
+   * - 편집은 ClipSequence 에 O(log n) 으로 반영되고, 나머지 클립/트랙/디코딩된 이미지는 그대로 공유한 새 Timeline 으로 교체된다.
+   *   (새로 읽는 파일은 insert/replace 로 추가되는 이미지 하나뿐, 재생 위치는 유지)
+   * - 교체 전 Timeline 은 불변이므로 이미 시작한 export 작업은 편집 전 스냅샷으로 계속 진행된다.
+   */
+  bool insertClip(int index, const std::string& path);
+  bool removeClip(int index);
+  bool moveClip(int from, int to);
+  bool retimeClip(int index, double durationSec, double xfadeSec);
+  bool replaceClip(int index, const std::string& path);
+  int clipCount() const { return (int)m_sequence.size(); };
+
   void previewPlay();
   void previewPause();
   void previewStop();
+  void previewSeek(double tSec);
   double durationSec() const;
 
+private:
+  // 기본 트랙 클립 하나 로드 (setImageSequence 와 같은 Preview 용 옵션, 기존 클립과 같은 캔버스 크기 기준)
+  bool loadClip(const std::string& path, Timeline::ClipRenderData& out) const;
+  // 편집된 시퀀스로 기본 트랙만 교체한 Timeline 을 만들어 Renderer 에 적용 (audio 는 편집에 맞춰 클립 오디오 순서를 옮긴 설정)
+  bool applyEdit(ClipSequence sequence, TimelineAudio audio);
+
 private:
   std::shared_ptr<Renderer> m_pRenderer;
   double m_lastDurationSec = 0.0;
+  int m_canvasWidth = 0;                        // 가장 최근 Timeline 을 만든 캔버스(surface) 크기 (프로젝트 저장용)
+  int m_canvasHeight = 0;
+  double m_clipDurSec = 3.0;                    // 새로 추가하는 클립 길이(초) (가장 최근 setImageSequence 값)
+  double m_xfadeSec = 0.5;                      // 새로 추가하는 클립 전환 길이(초)
+  ClipSequence m_sequence;                      // 현재 Timeline 의 기본 트랙 클립 순서 (편집용, JS 스레드에서만 접근)
+  std::vector<TransitionType> m_transitions;    // 클립 사이 전환 방식 (JS 스레드에서만 접근)
+  bool m_kenBurns = false;                      // 클립 Ken Burns 애니메이션 적용 여부 (JS 스레드에서만 접근)
+  TimelineAudio m_audio;                        // Timeline 에 설정할 오디오 (JS 스레드에서만 접근)
+  std::function<void(int, int)> m_importProgress; // 이미지 로드 진행 listener
 
 private:
   static constexpr const char* k_logTag = "PreviewController";
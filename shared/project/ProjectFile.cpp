@@ -0,0 +1,460 @@
+#include "ProjectFile.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <algorithm> // std::max, std::min, std::clamp, std::all_of
+#include <cmath>     // std::ceil, std::isfinite
+#include <cstdio>    // std::fopen, std::rename
+#include <cstring>   // std::memcpy, std::memcmp
+#include <iterator>  // std::begin, std::end
+#include <map>
+#include <tuple>
+#include <fcntl.h>    // ::open
+#include <sys/mman.h> // ::mmap, ::munmap
+#include <sys/stat.h> // ::fstat
+#include <unistd.h>   // ::close, ::pread
+
+static constexpr char k_magic[4] = { 'S', 'K', 'P', 'J' };
+
+// 8 byte 정렬 (모든 section 은 8 byte 경계에서 시작)
+static uint64_t align8(uint64_t v) {
+  return (v + 7) & ~uint64_t(7);
+}
+
+// 시간/길이/gain 처럼 0 이상의 유한한 값이어야 하는 필드 검사 (NaN 은 비교가 항상 false 이므로 isfinite 로 먼저 거름)
+static bool nonNegative(double v) {
+  return std::isfinite(v) && v >= 0.0;
+}
+
+ProjectFile::~ProjectFile() {
+  close();
+};
+
+bool ProjectFile::save(const std::string& path, const Timeline& timeline, int canvasWidth, int canvasHeight) {
+  TRACE_SCOPE("project", "save");
+
+  std::vector<AssetRecord> assets;
+  std::vector<MotionRecord> motions;
+  std::vector<KeyframeRecord> keyframes;
+  std::vector<TrackRecord> tracks;
+  std::vector<ClipRecord> clips;
+  std::vector<AudioRecord> audioClips;
+  std::string strings;
+
+  // 문자열은 NUL 종료로 이어 붙임 -> mmap 영역에서 바로 C 문자열로 읽을 수 있음
+  auto addString = [&strings](const std::string& s, uint32_t& offset, uint32_t& length) {
+    offset = (uint32_t)strings.size();
+    length = (uint32_t)s.size();
+    strings.append(s);
+    strings.push_back('\0');
+  };
+
+  std::map<std::string, uint32_t> assetIndex;           // 경로 -> asset 번호 (같은 이미지를 쓰는 클립은 asset 하나를 공유)
+  std::map<const ClipMotion*, int32_t> motionIndex;      // 애니메이션 -> motion 번호 (프리셋처럼 공유되는 애니메이션은 한 번만 저장)
+  size_t skipped = 0;
+
+  for (int t = 0; t < timeline.trackCount(); t++) {
+    TrackRecord track{ (uint32_t)clips.size(), 0 };
+    for (const Timeline::Segment& seg : timeline.segments(t)) {
+      if (seg.clip.path.empty() || !seg.clip.image) {
+        skipped++;
+        continue;
+      }
+
+      auto assetIt = assetIndex.find(seg.clip.path);
+      if (assetIt == assetIndex.end()) {
+        AssetRecord asset{};
+        addString(seg.clip.path, asset.pathOffset, asset.pathLength);
+        if (!quickHash(seg.clip.path, asset.contentHash, asset.fileSize)) {
+          Logger::warn(k_logTag, "Cannot hash asset: %s", seg.clip.path.c_str());
+        }
+        asset.width = seg.clip.image->width();
+        asset.height = seg.clip.image->height();
+        assetIt = assetIndex.emplace(seg.clip.path, (uint32_t)assets.size()).first;
+        assets.push_back(asset);
+      }
+
+      int32_t motion = -1;
+      if (seg.motion) {
+        auto motionIt = motionIndex.find(seg.motion.get());
+        if (motionIt == motionIndex.end()) {
+          const auto& keys = seg.motion->keyframes();
+          motions.push_back(MotionRecord{ (uint32_t)keyframes.size(), (uint32_t)keys.size() });
+          for (const MotionKeyframe& k : keys) {
+            keyframes.push_back(KeyframeRecord{ k.time, k.scale, k.panX, k.panY, k.rotationDeg });
+          }
+          motionIt = motionIndex.emplace(seg.motion.get(), (int32_t)motions.size() - 1).first;
+        }
+        motion = motionIt->second;
+      }
+
+      ClipRecord clip{};
+      clip.start = seg.start;
+      clip.duration = seg.duration;
+      clip.xfade = seg.xfade;
+      clip.dst[0] = seg.clip.dst.left();
+      clip.dst[1] = seg.clip.dst.top();
+      clip.dst[2] = seg.clip.dst.right();
+      clip.dst[3] = seg.clip.dst.bottom();
+      clip.asset = assetIt->second;
+      clip.motion = motion;
+      clip.transition = (uint32_t)seg.transition;
+      clips.push_back(clip);
+      track.clipCount++;
+    }
+    tracks.push_back(track);
+  }
+  if (skipped > 0) {
+    Logger::warn(k_logTag, "%zu clips without a source file were not saved", skipped);
+  }
+
+  for (const AudioClip& a : timeline.audioClips()) {
+    AudioRecord rec{};
+    addString(a.path, rec.pathOffset, rec.pathLength);
+    rec.start = a.startSec;
+    rec.duration = a.durationSec;
+    rec.fadeIn = a.fadeInSec;
+    rec.fadeOut = a.fadeOutSec;
+    rec.gain = a.gain;
+    rec.flags = a.loop ? k_audioLoop : 0;
+    audioClips.push_back(rec);
+  }
+
+  // 헤더 뒤에 section 들을 8 byte 정렬로 배치
+  Header header{};
+  std::memcpy(header.magic, k_magic, sizeof(k_magic));
+  header.byteOrder = k_byteOrderMark;
+  header.version = k_version;
+  header.headerSize = (uint16_t)sizeof(Header);
+  header.canvasWidth = canvasWidth;
+  header.canvasHeight = canvasHeight;
+  header.totalDuration = timeline.totalDuration();
+
+  uint64_t cursor = align8(sizeof(Header));
+  auto place = [&cursor](Section& s, size_t count, size_t stride) {
+    s.offset = cursor;
+    s.count = (uint32_t)count;
+    s.stride = (uint32_t)stride;
+    cursor = align8(cursor + (uint64_t)count * stride);
+  };
+  place(header.assets, assets.size(), sizeof(AssetRecord));
+  place(header.motions, motions.size(), sizeof(MotionRecord));
+  place(header.keyframes, keyframes.size(), sizeof(KeyframeRecord));
+  place(header.tracks, tracks.size(), sizeof(TrackRecord));
+  place(header.clips, clips.size(), sizeof(ClipRecord));
+  place(header.audioClips, audioClips.size(), sizeof(AudioRecord));
+  place(header.strings, strings.size(), 1);
+  header.fileSize = cursor;
+
+  std::vector<uint8_t> buffer(cursor, 0);
+  std::memcpy(buffer.data(), &header, sizeof(Header));
+  auto copySection = [&buffer](const Section& s, const void* src) {
+    if (s.count > 0) {
+      std::memcpy(buffer.data() + s.offset, src, (size_t)s.count * s.stride);
+    }
+  };
+  copySection(header.assets, assets.data());
+  copySection(header.motions, motions.data());
+  copySection(header.keyframes, keyframes.data());
+  copySection(header.tracks, tracks.data());
+  copySection(header.clips, clips.data());
+  copySection(header.audioClips, audioClips.data());
+  copySection(header.strings, strings.data());
+
+  // 임시 파일에 모두 쓴 뒤 rename -> 저장 도중 실패해도 기존 프로젝트 파일이 깨지지 않음
+  const std::string tmpPath = path + ".tmp";
+  FILE* f = std::fopen(tmpPath.c_str(), "wb");
+  if (!f) {
+    Logger::error(k_logTag, "Cannot open %s for writing", tmpPath.c_str());
+    return false;
+  }
+  const bool written = std::fwrite(buffer.data(), 1, buffer.size(), f) == buffer.size();
+  const bool closed = std::fclose(f) == 0;
+  if (!written || !closed || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    Logger::error(k_logTag, "Failed to write %s", path.c_str());
+    std::remove(tmpPath.c_str());
+    return false;
+  }
+
+  Logger::info(k_logTag, "Saved %s (%zu clips, %zu assets, %zu bytes)", path.c_str(), clips.size(), assets.size(), buffer.size());
+  return true;
+};
+
+bool ProjectFile::open(const std::string& path) {
+  TRACE_SCOPE("project", "open");
+  close();
+
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    Logger::error(k_logTag, "Cannot open %s", path.c_str());
+    return false;
+  }
+  struct stat st{};
+  if (::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header)) {
+    Logger::error(k_logTag, "Not a project file: %s", path.c_str());
+    ::close(fd);
+    return false;
+  }
+
+  // 파일 전체를 읽기 전용으로 mmap (실제 읽기는 레코드에 접근할 때 페이지 단위로 일어남)
+  void* p = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) {
+    Logger::error(k_logTag, "mmap failed: %s", path.c_str());
+    return false;
+  }
+  m_pData = static_cast<const uint8_t*>(p);
+  m_size = (size_t)st.st_size;
+  m_pHeader = reinterpret_cast<const Header*>(m_pData);
+
+  if (!validate()) {
+    Logger::error(k_logTag, "Corrupt or unsupported project file: %s", path.c_str());
+    close();
+    return false;
+  }
+
+  const size_t slash = path.find_last_of('/');
+  m_baseDir = (slash == std::string::npos) ? std::string() : path.substr(0, slash);
+  return true;
+};
+
+void ProjectFile::close() {
+  if (m_pData) {
+    ::munmap(const_cast<uint8_t*>(m_pData), m_size);
+  }
+  m_pData = nullptr;
+  m_size = 0;
+  m_pHeader = nullptr;
+  m_baseDir.clear();
+};
+
+bool ProjectFile::validate() const {
+  const Header& h = *m_pHeader;
+  if (std::memcmp(h.magic, k_magic, sizeof(k_magic)) != 0) return false;
+  if (h.byteOrder != k_byteOrderMark) return false;
+  if (h.version != k_version || h.headerSize < sizeof(Header)) return false;
+  if (h.fileSize != m_size) return false;
+  if (h.canvasWidth < 0 || h.canvasHeight < 0 || !nonNegative(h.totalDuration)) return false;
+
+  // section 이 파일 범위 안에 있고 레코드가 이 reader 의 레코드 크기 이상인지 검사
+  auto sectionOk = [this](const Section& s, size_t minStride) {
+    if (s.count == 0) return true;
+    if (s.offset % 8 != 0 || s.stride < minStride) return false;
+    return s.offset <= m_size && (uint64_t)s.count * s.stride <= m_size - s.offset;
+  };
+  if (!sectionOk(h.assets, sizeof(AssetRecord)) || !sectionOk(h.motions, sizeof(MotionRecord)) ||
+      !sectionOk(h.keyframes, sizeof(KeyframeRecord)) || !sectionOk(h.tracks, sizeof(TrackRecord)) ||
+      !sectionOk(h.clips, sizeof(ClipRecord)) || !sectionOk(h.audioClips, sizeof(AudioRecord)) ||
+      !sectionOk(h.strings, 1)) {
+    return false;
+  }
+  if (h.strings.count > 0 && m_pData[h.strings.offset + h.strings.count - 1] != '\0') return false;
+  if (h.tracks.count == 0) return false;
+
+  // 레코드 사이 참조 범위 검사 (레코드 수에 비례하지만 파싱 없이 정수 비교만 하므로 1만 개도 수십 us)
+  auto stringOk = [&h](uint32_t offset, uint32_t length) {
+    return (uint64_t)offset + length < h.strings.count;
+  };
+  for (uint32_t i = 0; i < h.assets.count; i++) {
+    const AssetRecord& a = record<AssetRecord>(h.assets, i);
+    if (!stringOk(a.pathOffset, a.pathLength)) return false;
+  }
+  for (uint32_t i = 0; i < h.audioClips.count; i++) {
+    const AudioRecord& a = record<AudioRecord>(h.audioClips, i);
+    if (!stringOk(a.pathOffset, a.pathLength)) return false;
+    if (!nonNegative(a.start) || !nonNegative(a.duration) || !nonNegative(a.fadeIn) || !nonNegative(a.fadeOut) || !nonNegative(a.gain)) return false;
+  }
+  for (uint32_t i = 0; i < h.keyframes.count; i++) {
+    const KeyframeRecord& k = record<KeyframeRecord>(h.keyframes, i);
+    if (!std::isfinite(k.time) || !std::isfinite(k.scale) || !std::isfinite(k.panX) || !std::isfinite(k.panY) || !std::isfinite(k.rotationDeg)) return false;
+    // 배율은 proxy 크기에 곱해지므로 0 이하/비정상적으로 큰 값은 거부 (거대한 proxy 할당, float -> int 변환 범위 초과 방지)
+    if (k.scale <= 0.0f || k.scale > k_maxKeyframeScale) return false;
+  }
+  for (uint32_t i = 0; i < h.motions.count; i++) {
+    const MotionRecord& m = record<MotionRecord>(h.motions, i);
+    if ((uint64_t)m.firstKeyframe + m.keyframeCount > h.keyframes.count) return false;
+  }
+  for (uint32_t i = 0; i < h.tracks.count; i++) {
+    const TrackRecord& t = record<TrackRecord>(h.tracks, i);
+    if ((uint64_t)t.firstClip + t.clipCount > h.clips.count) return false;
+  }
+  for (uint32_t i = 0; i < h.clips.count; i++) {
+    const ClipRecord& c = record<ClipRecord>(h.clips, i);
+    if (c.asset >= h.assets.count) return false;
+    if (c.motion < -1 || (c.motion >= 0 && (uint32_t)c.motion >= h.motions.count)) return false;
+    // 시간 값이 NaN/음수/무한대면 Timeline 의 시간 순 정렬과 구간 탐색이 깨지므로 거부
+    if (!nonNegative(c.start) || !nonNegative(c.duration) || !nonNegative(c.xfade)) return false;
+    if (!std::all_of(std::begin(c.dst), std::end(c.dst), [](float v) { return std::isfinite(v); })) return false;
+  }
+  return true;
+};
+
+std::string ProjectFile::assetPath(size_t i) const {
+  const AssetRecord& a = asset(i);
+  std::string p(string(a.pathOffset), a.pathLength);
+  if (!p.empty() && p.front() != '/' && !m_baseDir.empty()) {
+    p = m_baseDir + "/" + p;
+  }
+  return p;
+};
+
+const ProjectFile::ClipRecord& ProjectFile::clip(int track, size_t i) const {
+  const TrackRecord& t = record<TrackRecord>(m_pHeader->tracks, track);
+  return record<ClipRecord>(m_pHeader->clips, t.firstClip + i);
+};
+
+std::shared_ptr<Timeline> ProjectFile::buildTimeline(const ClipLoadOptions& opts) const {
+  if (!isOpen()) return nullptr;
+  TRACE_SCOPE_ARG("project", "buildTimeline", "clips", m_pHeader->clips.count);
+
+  // 애니메이션은 motion 레코드마다 한 번만 bake 해서 클립들이 공유
+  std::vector<std::shared_ptr<const ClipMotion>> motions(m_pHeader->motions.count);
+  for (size_t i = 0; i < motions.size(); i++) {
+    const MotionRecord& m = record<MotionRecord>(m_pHeader->motions, i);
+    std::vector<MotionKeyframe> keys;
+    keys.reserve(m.keyframeCount);
+    for (uint32_t k = 0; k < m.keyframeCount; k++) {
+      const KeyframeRecord& r = record<KeyframeRecord>(m_pHeader->keyframes, m.firstKeyframe + k);
+      keys.push_back(MotionKeyframe{ r.time, r.scale, r.panX, r.panY, r.rotationDeg });
+    }
+    motions[i] = ClipMotion::bake(std::move(keys));
+  }
+
+  // 저장 당시 캔버스와 크기가 다르면 dst 를 비율대로 변환
+  const float sx = (canvasWidth() > 0 && opts.width > 0) ? (float)opts.width / (float)canvasWidth() : 1.0f;
+  const float sy = (canvasHeight() > 0 && opts.height > 0) ? (float)opts.height / (float)canvasHeight() : 1.0f;
+
+  // 같은 asset 을 같은 크기로 그리는 클립은 이미지(원본/proxy/thumbnail)를 한 번만 읽어 공유
+  using LoadKey = std::tuple<uint32_t, int, int>;
+  std::map<LoadKey, Timeline::ClipRenderData> loaded;
+  std::vector<bool> failed(assetCount(), false);
+
+  const int total = (int)m_pHeader->clips.count;
+  int done = 0;
+  auto timeline = std::make_shared<Timeline>();
+  for (int t = 0; t < trackCount(); t++) {
+    std::vector<Timeline::Segment> segs;
+    segs.reserve(clipCount(t));
+    for (size_t i = 0; i < clipCount(t); i++, done++) {
+      if (opts.onProgress) {
+        opts.onProgress(done, total);
+      }
+      const ClipRecord& c = clip(t, i);
+      if (failed[c.asset]) continue;
+
+      const SkRect dst = SkRect::MakeLTRB(c.dst[0] * sx, c.dst[1] * sy, c.dst[2] * sx, c.dst[3] * sy);
+      const std::shared_ptr<const ClipMotion> motion = (c.motion >= 0) ? motions[c.motion] : nullptr;
+
+      ClipLoadOptions clipOpts = opts;
+      clipOpts.onProgress = nullptr;
+      clipOpts.proxyScale = std::clamp(std::max(opts.proxyScale, motion ? motion->maxScale() : 1.0f), 1.0f, k_maxKeyframeScale);
+      const LoadKey key{ c.asset, (int)std::ceil(dst.width() * clipOpts.proxyScale), (int)std::ceil(dst.height() * clipOpts.proxyScale) };
+
+      auto it = loaded.find(key);
+      if (it == loaded.end()) {
+        Timeline::ClipRenderData data;
+        if (!ClipLoader::loadPlaced(assetPath(c.asset), dst, clipOpts, data)) {
+          Logger::warn(k_logTag, "Missing asset: %s", assetPath(c.asset).c_str());
+          failed[c.asset] = true;
+          continue;
+        }
+        it = loaded.emplace(key, std::move(data)).first;
+      }
+
+      Timeline::Segment seg(it->second, c.duration, c.start, c.xfade);
+      seg.clip.dst = dst;
+      seg.transition = (c.transition < (uint32_t)TransitionType::Count) ? (TransitionType)c.transition : TransitionType::Crossfade;
+      seg.motion = motion;
+      segs.push_back(std::move(seg));
+    }
+
+    if (t == 0) {
+      if (segs.empty()) {
+        Logger::warn(k_logTag, "No images loaded");
+        return nullptr;
+      }
+      timeline->setSegments(segs);
+    } else if (!segs.empty()) {
+      timeline->addTrack(segs);
+    }
+  }
+
+  std::vector<AudioClip> audioClips;
+  audioClips.reserve(m_pHeader->audioClips.count);
+  for (uint32_t i = 0; i < m_pHeader->audioClips.count; i++) {
+    const AudioRecord& r = record<AudioRecord>(m_pHeader->audioClips, i);
+    AudioClip a;
+    a.path.assign(string(r.pathOffset), r.pathLength);
+    if (!a.path.empty() && a.path.front() != '/' && !m_baseDir.empty()) {
+      a.path = m_baseDir + "/" + a.path;
+    }
+    a.startSec = r.start;
+    a.durationSec = r.duration;
+    a.fadeInSec = r.fadeIn;
+    a.fadeOutSec = r.fadeOut;
+    a.gain = r.gain;
+    a.loop = (r.flags & k_audioLoop) != 0;
+    audioClips.push_back(std::move(a));
+  }
+  timeline->setAudioClips(std::move(audioClips));
+
+  if (opts.onProgress) {
+    opts.onProgress(total, total);
+  }
+  return timeline;
+};
+
+size_t ProjectFile::verifyAssets(std::vector<size_t>* changed) const {
+  if (!isOpen()) return 0;
+  size_t count = 0;
+  for (size_t i = 0; i < assetCount(); i++) {
+    uint64_t hash = 0, size = 0;
+    const AssetRecord& a = asset(i);
+    if (!quickHash(assetPath(i), hash, size) || hash != a.contentHash || size != a.fileSize) {
+      count++;
+      if (changed) {
+        changed->push_back(i);
+      }
+    }
+  }
+  return count;
+};
+
+bool ProjectFile::quickHash(const std::string& path, uint64_t& hash, uint64_t& fileSize) {
+  hash = 0;
+  fileSize = 0;
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return false;
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+  fileSize = (uint64_t)st.st_size;
+
+  // FNV-1a 64
+  uint64_t h = 0xcbf29ce484222325ull;
+  auto mix = [&h](const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      h = (h ^ p[i]) * 0x100000001b3ull;
+    }
+  };
+  mix(reinterpret_cast<const uint8_t*>(&fileSize), sizeof(fileSize));
+
+  // 앞부분 + (앞부분과 겹치지 않는) 뒷부분만 읽음
+  std::vector<uint8_t> buf(k_hashSampleBytes);
+  const uint64_t headBytes = std::min<uint64_t>(fileSize, k_hashSampleBytes);
+  const uint64_t tailBytes = std::min<uint64_t>(fileSize - headBytes, k_hashSampleBytes);
+  bool ok = true;
+  if (headBytes > 0) {
+    ok = ::pread(fd, buf.data(), (size_t)headBytes, 0) == (ssize_t)headBytes;
+    mix(buf.data(), (size_t)headBytes);
+  }
+  if (ok && tailBytes > 0) {
+    ok = ::pread(fd, buf.data(), (size_t)tailBytes, (off_t)(fileSize - tailBytes)) == (ssize_t)tailBytes;
+    mix(buf.data(), (size_t)tailBytes);
+  }
+  ::close(fd);
+
+  hash = h;
+  return ok;
+};
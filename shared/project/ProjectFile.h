@@ -0,0 +1,189 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../video/Timeline.h"
+#include "../video/ClipLoader.h"
+
+/**
+ * Timeline 을 저장/복원하는 바이너리 프로젝트 파일 (*.skproj)
+ *
+ * - 파일 전체가 "헤더 + 고정 크기 레코드 배열(section) + 문자열 blob" 으로 구성되고 모든 section 은 8 byte 정렬된다.
+ *   -> open() 은 파일을 mmap 한 뒤 헤더/section 범위만 검사하므로 클립이 1만 개여도 수 ms 안에 열리며,
+ *      레코드는 복사/파싱 없이 mmap 영역을 그대로 읽는다. (little-endian 전용, 다른 byte order 의 파일은 거부)
+ * - 이미지마다 경로, 원본 크기, 파일 크기, 내용 hash 를 asset 레코드로 한 번만 저장하고 클립은 asset 번호로 참조한다.
+ *   -> 복원 시 배치(dst)를 다시 계산하지 않고(fitWidthRect 생략), 같은 asset/크기의 이미지는 한 번만 읽는다.
+ * - 버전 호환: 헤더의 version 이 다르면 거부하고, 같은 버전 안에서 레코드 뒤에 필드를 추가할 때는
+ *   section 의 stride 가 커지므로 이전 reader 도 앞쪽 필드만 읽어 그대로 열 수 있다.
+ */
+class ProjectFile
+{
+public:
+  // 파일 안의 레코드 배열 위치
+  struct Section
+  {
+    uint64_t offset = 0;              // 파일 시작 기준 byte offset
+    uint32_t count = 0;               // 레코드 수 (문자열 blob 은 byte 수)
+    uint32_t stride = 0;              // 레코드 하나의 byte 크기 (이 reader 의 레코드보다 크면 뒤쪽 필드는 무시)
+  };
+
+  struct Header
+  {
+    char magic[4];                    // "SKPJ"
+    uint32_t byteOrder;               // k_byteOrderMark (다른 byte order 로 쓰인 파일 감지)
+    uint16_t version;                 // 포맷 버전 (k_version 과 다르면 거부)
+    uint16_t headerSize;              // sizeof(Header)
+    uint32_t flags;                   // 예약
+    int32_t canvasWidth;              // dst 좌표계 너비 (Timeline 을 만든 캔버스 크기)
+    int32_t canvasHeight;             // dst 좌표계 높이
+    uint32_t reserved[2];             // 예약 (totalDuration 을 8 byte 경계에 맞춤)
+    double totalDuration;             // Timeline 전체 길이(초)
+    Section assets;                   // AssetRecord
+    Section motions;                  // MotionRecord
+    Section keyframes;                // KeyframeRecord
+    Section tracks;                   // TrackRecord
+    Section clips;                    // ClipRecord (트랙 순서대로, 트랙 안에서는 시작 시간 순)
+    Section audioClips;               // AudioRecord
+    Section strings;                  // UTF-8 문자열 blob (각 문자열은 NUL 종료)
+    uint64_t fileSize;                // 파일 전체 크기 (잘린 파일 감지)
+  };
+
+  // 이미지 파일 하나
+  struct AssetRecord
+  {
+    uint32_t pathOffset;              // strings 안의 경로 offset
+    uint32_t pathLength;              // 경로 길이 (NUL 제외)
+    uint64_t contentHash;             // quickHash 결과 (파일이 바뀌었는지 verifyAssets 로 확인)
+    uint64_t fileSize;                // 파일 크기(byte)
+    int32_t width;                    // 원본 이미지 너비
+    int32_t height;                   // 원본 이미지 높이
+  };
+
+  // 클립 애니메이션 하나 (keyframes section 의 연속 구간)
+  struct MotionRecord
+  {
+    uint32_t firstKeyframe;
+    uint32_t keyframeCount;
+  };
+
+  struct KeyframeRecord
+  {
+    float time;
+    float scale;
+    float panX;
+    float panY;
+    float rotationDeg;
+  };
+
+  // 트랙 하나 (clips section 의 연속 구간)
+  struct TrackRecord
+  {
+    uint32_t firstClip;
+    uint32_t clipCount;
+  };
+
+  struct ClipRecord
+  {
+    double start;                     // 시작 시간(초)
+    double duration;                  // 길이(초)
+    double xfade;                     // 다음 클립으로 넘어가는 전환 길이(초)
+    float dst[4];                     // left, top, right, bottom (캔버스 좌표)
+    uint32_t asset;                   // AssetRecord 번호
+    int32_t motion;                   // MotionRecord 번호 (-1 이면 애니메이션 없음)
+    uint32_t transition;              // TransitionType
+    uint32_t flags;                   // 예약
+  };
+
+  struct AudioRecord
+  {
+    uint32_t pathOffset;
+    uint32_t pathLength;
+    double start;
+    double duration;
+    double fadeIn;
+    double fadeOut;
+    float gain;
+    uint32_t flags;                   // k_audioLoop
+  };
+
+public:
+  ProjectFile() = default;
+  ~ProjectFile();
+
+  ProjectFile(const ProjectFile&) = delete;
+  ProjectFile& operator=(const ProjectFile&) = delete;
+
+public:
+  /**
+   * timeline 을 path 에 저장 (임시 파일에 쓴 뒤 rename 하므로 실패해도 기존 파일은 그대로 남음)
+   * - canvasWidth/Height: timeline 의 dst 좌표계 크기 (복원 시 다른 크기로 열면 dst 를 비율대로 변환)
+   * - 파일 경로가 없는 클립(파일에서 읽지 않은 이미지)은 저장하지 않는다.
+   */
+  static bool save(const std::string& path, const Timeline& timeline, int canvasWidth, int canvasHeight);
+
+  // 파일을 mmap 하고 헤더/section 범위 검사 (실패 시 false, 이전에 열려 있던 파일은 닫힘)
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const { return m_pHeader != nullptr; };
+
+  int canvasWidth() const { return m_pHeader->canvasWidth; };
+  int canvasHeight() const { return m_pHeader->canvasHeight; };
+  double totalDuration() const { return m_pHeader->totalDuration; };
+
+  // asset / 트랙별 클립 조회 (mmap 영역을 그대로 참조하므로 close() 전까지만 유효)
+  size_t assetCount() const { return m_pHeader->assets.count; };
+  const AssetRecord& asset(size_t i) const { return record<AssetRecord>(m_pHeader->assets, i); };
+  // asset 경로 (상대 경로면 프로젝트 파일 위치 기준으로 변환한 경로)
+  std::string assetPath(size_t i) const;
+  int trackCount() const { return (int)m_pHeader->tracks.count; };
+  size_t clipCount(int track) const { return record<TrackRecord>(m_pHeader->tracks, track).clipCount; };
+  const ClipRecord& clip(int track, size_t i) const;
+
+  /**
+   * 저장된 내용으로 Timeline 생성
+   * - opts.width/height 가 저장 당시 캔버스 크기와 다르면 dst 를 비율대로 변환한다.
+   * - opts.proxyScale 은 애니메이션이 있는 클립이면 그 클립의 최대 확대 배율 이상으로 올려서 사용한다.
+   * - opts.onProgress 는 클립 단위로 호출된다.
+   * @return 생성된 Timeline, 기본 트랙 이미지를 하나도 읽지 못했으면 nullptr
+   */
+  std::shared_ptr<Timeline> buildTimeline(const ClipLoadOptions& opts) const;
+
+  /**
+   * asset 파일들이 저장 이후 바뀌었는지 검사 (파일마다 quickHash 를 다시 계산하므로 필요할 때만 호출)
+   * @param changed 바뀌었거나 읽을 수 없는 asset 번호 (nullptr 가능)
+   * @return 바뀐 asset 수
+   */
+  size_t verifyAssets(std::vector<size_t>* changed = nullptr) const;
+
+  /**
+   * 파일 내용 hash (FNV-1a 64, 파일 크기 + 앞/뒤 k_hashSampleBytes 만 읽음)
+   * -> 큰 사진 수천 장도 빠르게 hash 할 수 있으며, 편집/교체된 파일은 대부분 크기나 앞/뒤(헤더/EXIF/끝부분)가 달라진다.
+   */
+  static bool quickHash(const std::string& path, uint64_t& hash, uint64_t& fileSize);
+
+private:
+  template <typename T>
+  const T& record(const Section& s, size_t i) const {
+    return *reinterpret_cast<const T*>(m_pData + s.offset + i * s.stride);
+  };
+  const char* string(uint32_t offset) const { return reinterpret_cast<const char*>(m_pData + m_pHeader->strings.offset + offset); };
+
+  bool validate() const;
+
+private:
+  const uint8_t* m_pData = nullptr;   // mmap 영역
+  size_t m_size = 0;                  // mmap 크기
+  const Header* m_pHeader = nullptr;  // m_pData 의 헤더 (열려 있지 않으면 nullptr)
+  std::string m_baseDir;              // 프로젝트 파일이 있는 디렉터리 (상대 경로 asset 기준)
+
+public:
+  static constexpr uint16_t k_version = 1;
+  static constexpr uint32_t k_byteOrderMark = 0x01020304;
+  static constexpr uint32_t k_audioLoop = 1u << 0;
+
+private:
+  static constexpr size_t k_hashSampleBytes = 64 * 1024;
+  static constexpr float k_maxKeyframeScale = 4.0f * ClipMotion::k_maxScale; // 키프레임 확대 배율 상한 (프리셋 최대 배율의 4배)
+  static constexpr const char* k_logTag = "ProjectFile";
+};
@@ -1,6 +1,10 @@
 #include "EglContext.h"
 #include "../logger/Logger.h"
 
+// eglPresentationTimeANDROID 는 EGL 확장 함수이므로 기기/드라이버가 지원할 때만 런타임에 주소를 얻어와 호출한다.
+typedef void (EGLAPIENTRY* PFNEGLPRESENTATIONTIMEANDROIDPROC)(EGLDisplay, EGLSurface, khronos_stime_nanoseconds_t);
+static PFNEGLPRESENTATIONTIMEANDROIDPROC s_eglPresentationTimeANDROID = nullptr;
+
 bool EglContext::init(ANativeWindow* window) {
   // EGLDisplay 생성
   m_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
@@ -31,6 +35,7 @@ bool EglContext::init(ANativeWindow* window) {
     Logger::error(k_logTag, "Failed to choose EGL config");
     return false;
   }
+  m_config = eglConfig;
 
   // EGLContext 생성
   EGLint contextAttribs[] = {
@@ -82,5 +87,42 @@ void EglContext::destroy() {
     // EGLDisplay 메모리 해제
     eglTerminate(m_display);
     m_display = EGL_NO_DISPLAY;
+    m_config = nullptr;
+  }
+};
+
+EGLSurface EglContext::createWindowSurface(ANativeWindow* window) {
+  if (m_display == EGL_NO_DISPLAY || !m_config || !window) return EGL_NO_SURFACE;
+
+  // init() 에서 선택한 EGLConfig 로 생성해야 기존 EGLContext 와 함께 eglMakeCurrent 할 수 있다.
+  EGLSurface surface = eglCreateWindowSurface(m_display, m_config, window, nullptr);
+  if (surface == EGL_NO_SURFACE) {
+    Logger::error(k_logTag, "Failed to create additional EGL surface");
+  }
+  return surface;
+};
+
+bool EglContext::makeCurrent(EGLSurface surface) {
+  return eglMakeCurrent(m_display, surface, surface, m_context) == EGL_TRUE;
+};
+
+bool EglContext::swapBuffer(EGLSurface surface) {
+  return eglSwapBuffers(m_display, surface) == EGL_TRUE;
+};
+
+void EglContext::destroySurface(EGLSurface surface) {
+  if (m_display != EGL_NO_DISPLAY && surface != EGL_NO_SURFACE) {
+    eglDestroySurface(m_display, surface);
+  }
+};
+
+void EglContext::setPresentationTimeNs(EGLSurface surface, int64_t ptsNs) {
+  if (!s_eglPresentationTimeANDROID) {
+    s_eglPresentationTimeANDROID = (PFNEGLPRESENTATIONTIMEANDROIDPROC)eglGetProcAddress("eglPresentationTimeANDROID");
+  }
+  if (s_eglPresentationTimeANDROID &&   // eglPresentationTimeANDROID 함수 포인터 로드되었는지 검사
+      m_display != EGL_NO_DISPLAY &&    // EGLDisplay 및 EGLSurface 생성 여부 확인
+      surface != EGL_NO_SURFACE) {
+    s_eglPresentationTimeANDROID(m_display, surface, ptsNs);
   }
 };
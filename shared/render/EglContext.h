@@ -1,5 +1,6 @@
 #pragma once
 #include <EGL/egl.h>
+#include <cstdint>
 #include <android/native_window.h> // ANativeWindow
 
 class EglContext
@@ -12,6 +13,19 @@ public:
   // egl 리소스 해제
   void destroy();
 
+public:
+  /**
+   * 같은 EGLContext 를 공유하는 추가 window surface 관리 함수
+   * -> 한 번 렌더링한 프레임을 여러 인코더 입력 surface 로 나눠 그릴 때(multi rendition) 사용
+   */
+  EGLSurface createWindowSurface(ANativeWindow* window);
+  bool makeCurrent(EGLSurface surface);
+  bool swapBuffer(EGLSurface surface);
+  void destroySurface(EGLSurface surface);
+
+  // eglPresentationTimeANDROID 확장을 통해 surface 에 다음 프레임의 PTS(ns) 지정 (확장 미지원 시 무시)
+  void setPresentationTimeNs(EGLSurface surface, int64_t ptsNs);
+
 public:
   EGLDisplay display() const { return m_display; };
   EGLContext context() const { return m_context; };
@@ -22,6 +36,7 @@ private:
   EGLDisplay m_display = EGL_NO_DISPLAY;
   EGLContext m_context = EGL_NO_CONTEXT;
   EGLSurface m_surface = EGL_NO_SURFACE;
+  EGLConfig m_config = nullptr;
 
 private:
   static constexpr const char* k_logTag = "EglContext";
@@ -0,0 +1,73 @@
+#include "FrameBufferPool.h"
+#include <iterator> // std::next
+
+std::shared_ptr<FrameBufferPool> FrameBufferPool::create(size_t maxIdle) {
+  return std::shared_ptr<FrameBufferPool>(new FrameBufferPool(maxIdle));
+};
+
+std::shared_ptr<FrameBuffer> FrameBufferPool::acquire(size_t size) {
+  if (size == 0) return nullptr;
+
+  FrameBuffer* buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    // 가장 최근에 반환된 같은 크기 버퍼부터 재사용 (캐시에 남아있을 가능성이 높음)
+    for (auto it = m_idle.rbegin(); it != m_idle.rend(); ++it) {
+      if ((*it)->size() == size) {
+        buffer = it->release();
+        m_idle.erase(std::next(it).base());
+        break;
+      }
+    }
+    m_inUseBytes += size;
+  }
+  if (!buffer) {
+    buffer = new FrameBuffer(size);
+  }
+
+  // 마지막 참조가 사라지면 풀로 반환 (풀이 이미 사라졌으면 해제)
+  std::weak_ptr<FrameBufferPool> weakPool = weak_from_this();
+  return std::shared_ptr<FrameBuffer>(buffer, [weakPool](FrameBuffer* b) {
+    if (auto pool = weakPool.lock()) {
+      pool->release(b);
+    } else {
+      delete b;
+    }
+  });
+};
+
+void FrameBufferPool::trim() {
+  std::vector<std::unique_ptr<FrameBuffer>> idle;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    idle.swap(m_idle);
+  }
+  // 잠금 밖에서 해제
+};
+
+size_t FrameBufferPool::idleBytes() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  size_t bytes = 0;
+  for (const auto& b : m_idle) {
+    bytes += b->size();
+  }
+  return bytes;
+};
+
+size_t FrameBufferPool::inUseBytes() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_inUseBytes;
+};
+
+void FrameBufferPool::release(FrameBuffer* buffer) {
+  std::unique_ptr<FrameBuffer> owned(buffer);
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_inUseBytes -= owned->size();
+  if (m_maxIdle == 0) return;
+
+  // 보관 한도를 넘으면 가장 오래 전에 반환된 버퍼부터 해제
+  if (m_idle.size() >= m_maxIdle) {
+    m_idle.erase(m_idle.begin());
+  }
+  m_idle.push_back(std::move(owned));
+};
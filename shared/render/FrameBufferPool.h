@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * 풀에서 빌려온 픽셀 버퍼
+ * - 마지막 shared_ptr 가 사라지면 풀로 돌아간다. (풀이 먼저 사라졌거나 풀이 가득 차 있으면 해제)
+ */
+class FrameBuffer
+{
+public:
+  uint8_t* data() { return m_pixels.get(); };
+  const uint8_t* data() const { return m_pixels.get(); };
+  size_t size() const { return m_size; };
+
+private:
+  friend class FrameBufferPool;
+  explicit FrameBuffer(size_t size) : m_pixels(new uint8_t[size]), m_size(size) {};
+
+  std::unique_ptr<uint8_t[]> m_pixels;
+  size_t m_size = 0;
+};
+
+/**
+ * 렌더링 결과를 CPU 에서 꺼내 쓰기 위한 픽셀 버퍼 재사용 풀
+ *
+ * - 같은 크기의 프레임을 반복해서 요청하는 경우(JS 분석 루프 등) 매번 할당하지 않도록, 반환된 버퍼를 최대 maxIdle 개까지 보관한다.
+ * - 크기가 정확히 같은 버퍼만 재사용한다. (크기가 바뀌면 새로 할당하고, 오래된 크기의 버퍼는 보관 한도를 넘을 때 밀려남)
+ * - 버퍼는 풀을 weak_ptr 로 참조하므로, 풀을 반드시 shared_ptr 로 생성해야 한다.
+ */
+class FrameBufferPool : public std::enable_shared_from_this<FrameBufferPool>
+{
+public:
+  static std::shared_ptr<FrameBufferPool> create(size_t maxIdle = k_defaultMaxIdle);
+
+  FrameBufferPool(const FrameBufferPool&) = delete;
+  FrameBufferPool& operator=(const FrameBufferPool&) = delete;
+
+public:
+  // size byte 버퍼 대여 (보관 중인 같은 크기 버퍼가 있으면 재사용)
+  std::shared_ptr<FrameBuffer> acquire(size_t size);
+
+  // 보관 중인 버퍼 전부 해제 (메모리 회수용, 빌려준 버퍼는 그대로)
+  void trim();
+
+  // 보관 중인 버퍼 / 빌려준 버퍼의 총 바이트 수 (메모리 통계용)
+  size_t idleBytes() const;
+  size_t inUseBytes() const;
+
+private:
+  explicit FrameBufferPool(size_t maxIdle) : m_maxIdle(maxIdle) {};
+
+  void release(FrameBuffer* buffer);
+
+private:
+  mutable std::mutex m_mtx;                             // 아래 상태 보호용 mutex
+  std::vector<std::unique_ptr<FrameBuffer>> m_idle;     // 반환되어 재사용을 기다리는 버퍼 (뒤쪽일수록 최근 반환)
+  size_t m_maxIdle;                                     // 보관할 최대 버퍼 수
+  size_t m_inUseBytes = 0;                              // 빌려준 버퍼의 총 바이트 수
+
+private:
+  static constexpr size_t k_defaultMaxIdle = 3;
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <utility>
+
+/**
+ * 다중 생산자 / 단일 소비자(MPSC) lock-free 큐 (Dmitry Vyukov 의 non-intrusive MPSC 큐 방식)
+ *
+ * - push(): 여러 스레드(JS 스레드, UI 스레드 등)에서 동시에 호출 가능. atomic exchange 한 번으로 끝나므로 절대 대기하지 않는다.
+ * - tryPop(): 반드시 하나의 소비자 스레드(렌더링 스레드)에서만 호출해야 한다.
+ * - 생산자가 exchange 직후 next 를 연결하기 전의 아주 짧은 순간에는 tryPop() 이 false 를 반환할 수 있으며,
+ *   이 경우 해당 항목은 다음 drain 시점(다음 프레임)에 꺼내진다.
+ * - T 는 기본 생성 및 이동이 가능해야 한다.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+  MpscQueue() {
+    // 항상 하나의 더미(stub) 노드를 두어 빈 큐에서도 head/tail 이 유효하도록 함
+    Node* stub = new Node();
+    m_head.store(stub, std::memory_order_relaxed);
+    m_tail = stub;
+  };
+
+  ~MpscQueue() {
+    T discard;
+    while (tryPop(discard)) {}
+    delete m_tail;
+  };
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+public:
+  // 큐 뒤쪽에 항목 추가 (생산자 스레드, wait-free)
+  void push(T value) {
+    Node* node = new Node();
+    node->value = std::move(value);
+    Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  };
+
+  // 큐 앞쪽에서 항목 하나를 꺼냄 (소비자 스레드 전용). 꺼낼 항목이 없으면 false
+  bool tryPop(T& out) {
+    Node* tail = m_tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (!next) return false;
+
+    // next 가 새로운 더미 노드가 되고, 기존 더미 노드는 해제
+    out = std::move(next->value);
+    next->value = T();
+    m_tail = next;
+    delete tail;
+    return true;
+  };
+
+private:
+  struct Node
+  {
+    std::atomic<Node*> next{ nullptr };
+    T value{};
+  };
+
+  std::atomic<Node*> m_head;  // 생산자들이 노드를 붙이는 쪽
+  Node* m_tail;               // 소비자가 노드를 꺼내는 쪽 (소비자 스레드 전용)
+};
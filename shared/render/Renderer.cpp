@@ -1,6 +1,8 @@
 #include "Renderer.h"
 #include "../logger/Logger.h"
+#include "../trace/Trace.h"
 #include <chrono>
+#include <algorithm> // std::clamp, std::min
 
 void Renderer::start(ANativeWindow* pWindow) {
   m_pNativeWindow = pWindow;
@@ -14,17 +16,16 @@ void Renderer::start(ANativeWindow* pWindow) {
 };
 
 void Renderer::resize(int width, int height) {
-  // skia 내부 framebuffer 에 적용할 이미지 크기 업데이트
+  // surfaceWidth()/surfaceHeight() 조회용 크기는 즉시 갱신
   m_width = width;
   m_height = height;
 
-  if (m_pNativeWindow) {
-    // android surface 설정(해상도, pixel format)
-    ANativeWindow_setBuffersGeometry(m_pNativeWindow, m_width, m_height, WINDOW_FORMAT_RGBA_8888);
-
-    // android surface 크기 변경 시 렌더링 루프에서 감지하여 SkSurface 재생성하도록 리사이징 요청
-    m_resizeRequested = true;
-  }
+  // android surface 설정 및 SkSurface 재생성은 렌더링 스레드의 다음 프레임 시작 시점에 수행
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::Resize;
+  cmd.width = width;
+  cmd.height = height;
+  m_commands.push(std::move(cmd));
 };
 
 void Renderer::stop() {
@@ -51,35 +52,187 @@ void Renderer::clearDrawables() {
   m_drawables.clear();
 };
 
-void Renderer::setTimeline(std::shared_ptr<Timeline> tl) {
-  // mutex lock 으로 임계영역을 잠근 후 m_timeline 업데이트
-  std::lock_guard<std::mutex> lock(m_timelineMtx);
-  m_timeline = std::move(tl);
-  m_previewTimeSec = 0.0;
-  m_previewDurationSec = (m_timeline ? m_timeline->totalDuration() : 0.0); // 업데이트한 Timeline 내에 계산되어 있는 총 영상 길이로 업데이트
+void Renderer::setTimeline(std::shared_ptr<Timeline> tl, bool keepPosition) {
+  // 인코더가 timelineSnapshot() 으로 가져갈 최신 Timeline 은 즉시 교체 (포인터 교체 동안만 잠금)
+  {
+    std::lock_guard<std::mutex> lock(m_latestTimelineMtx);
+    m_latestTimeline = tl;
+  }
+
+  // 렌더링 스레드가 그리는 Timeline 은 다음 프레임 시작 시점에 교체
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::SetTimeline;
+  cmd.timeline = std::move(tl);
+  cmd.keepPosition = keepPosition;
+  m_commands.push(std::move(cmd));
 };
 
 std::shared_ptr<Timeline> Renderer::timelineSnapshot() {
-  // mutex lock 으로 임계영역을 잠근 후 m_timeline 얕은 복사본 반환
+  // mutex lock 으로 임계영역을 잠근 후 m_latestTimeline 얕은 복사본 반환
   // -> IEncoder 모듈에서 Renderer 가 hosting 하고 있는 동일한 Timeline 을 공유하여 인코딩에 사용하기 위함
-  std::lock_guard<std::mutex> lock(m_timelineMtx);
-  return m_timeline;
+  std::lock_guard<std::mutex> lock(m_latestTimelineMtx);
+  return m_latestTimeline;
 };
 
 void Renderer::previewPlay() {
-  m_previewPlaying = true;
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::Play;
+  m_commands.push(std::move(cmd));
 };
 
 void Renderer::previewPause() {
-  m_previewPlaying = false;
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::Pause;
+  m_commands.push(std::move(cmd));
 };
 
 void Renderer::previewStop() {
-  m_previewPlaying = false;
-  m_previewTimeSec = 0.0; // "종료" 는 "일시정지" 와 다르게 타임라인 시간을 맨 처음으로 rollback
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::Stop;
+  m_commands.push(std::move(cmd));
+};
+
+void Renderer::previewSeek(double tSec) {
+  // scrub 제스처로 seek 요청이 연달아 들어와도 drainCommands() 에서 마지막 요청만 반영되므로 자연스럽게 병합(coalescing)된다.
+  RenderCommand cmd;
+  cmd.type = RenderCommand::Type::Seek;
+  cmd.timeSec = tSec;
+  m_commands.push(std::move(cmd));
+};
+
+void Renderer::attachMemoryBudget(const std::shared_ptr<MemoryBudget>& budget) {
+  m_memorySources.clear();
+  if (!budget) return;
+
+  // 1) seek 용 디코딩 캐시 : 다시 디코딩하면 되므로 가장 먼저 회수
+  m_memorySources.push_back(budget->addSource("preview.decodeCache", MemoryCategory::Decoded,
+    [this]() { return m_decodeCache.usedBytes(); },
+    [this](TrimLevel) { m_decodeCache.clear(); },
+    0));
+
+  // 2) GPU 리소스 캐시 (텍스처 업로드 결과, scratch render target 등) : 회수 요청만 렌더링 스레드로 전달
+  m_memorySources.push_back(budget->addSource("preview.gpuResources", MemoryCategory::Caches,
+    [this]() { return m_gpuCacheBytes.load(); },
+    [this](TrimLevel level) {
+      RenderCommand cmd;
+      cmd.type = RenderCommand::Type::TrimMemory;
+      cmd.trimLevel = level;
+      m_commands.push(std::move(cmd));
+    },
+    30));
+
+  // 3) 화면 render target : window surface (RGBA8888, triple buffering 가정) -> 집계만 함
+  m_memorySources.push_back(budget->addSource("preview.window", MemoryCategory::RenderTargets,
+    [this]() -> size_t {
+      if (!m_bIsRendering) return 0;
+      return (size_t)std::max(0, m_width.load()) * (size_t)std::max(0, m_height.load()) * 4 * 3;
+    }));
+
+  // 4) Preview 중인 Timeline 의 이미지 (압축 원본/raster) -> Timeline 이 살아있는 동안은 회수할 수 없으므로 집계만 함
+  m_memorySources.push_back(budget->addSource("preview.timeline.encoded", MemoryCategory::Encoded,
+    [this]() {
+      size_t encoded = 0, decoded = 0;
+      if (auto tl = timelineSnapshot()) tl->memoryUsage(encoded, decoded);
+      return encoded;
+    }));
+  m_memorySources.push_back(budget->addSource("preview.timeline.decoded", MemoryCategory::Decoded,
+    [this]() {
+      size_t encoded = 0, decoded = 0;
+      if (auto tl = timelineSnapshot()) tl->memoryUsage(encoded, decoded);
+      return decoded;
+    }));
+};
+
+void Renderer::trimGpuResources(TrimLevel level) {
+  GrDirectContext* ctx = m_skia.directContext();
+  if (!ctx) return;
+
+  // 사용 중이지 않은(unlocked) 리소스부터 회수하고, Critical 이면 GPU 리소스를 전부 해제 (다음 프레임에 필요한 것만 다시 생성됨)
+  if (level == TrimLevel::Light) {
+    ctx->performDeferredCleanup(std::chrono::seconds(1));
+  } else if (level == TrimLevel::Moderate) {
+    ctx->purgeUnlockedResources(GrPurgeResourceOptions::kAllResources);
+  } else if (level == TrimLevel::Critical) {
+    ctx->freeGpuResources();
+  }
+
+  int count = 0;
+  size_t bytes = 0;
+  ctx->getResourceCacheUsage(&count, &bytes);
+  m_gpuCacheBytes.store(bytes);
+};
+
+void Renderer::drainCommands() {
+  bool seekRequested = false;
+  double seekSec = 0.0;
+
+  RenderCommand cmd;
+  while (m_commands.tryPop(cmd)) {
+    switch (cmd.type) {
+      case RenderCommand::Type::Play:
+        m_previewPlaying = true;
+        break;
+      case RenderCommand::Type::Pause:
+        m_previewPlaying = false;
+        break;
+      case RenderCommand::Type::Stop:
+        m_previewPlaying = false;
+        m_previewTimeSec = 0.0; // "종료" 는 "일시정지" 와 다르게 타임라인 시간을 맨 처음으로 rollback
+        seekRequested = false;  // 앞서 쌓인 seek 요청은 무효화
+        break;
+      case RenderCommand::Type::Seek:
+        // 같은 프레임에 여러 seek 요청이 쌓였다면 마지막 요청만 남김
+        seekRequested = true;
+        seekSec = cmd.timeSec;
+        break;
+      case RenderCommand::Type::Resize:
+        // android surface 설정(해상도, pixel format) 후 SkSurface 재생성 (크기가 같으면 SkSurface 는 그대로 재사용됨)
+        if (m_pNativeWindow) {
+          ANativeWindow_setBuffersGeometry(m_pNativeWindow, cmd.width, cmd.height, WINDOW_FORMAT_RGBA_8888);
+        }
+        if (m_skia.setupSkiaSurface(cmd.width, cmd.height)) {
+          m_renderWidth = cmd.width;
+          m_renderHeight = cmd.height;
+        } else {
+          Logger::error(k_logTag, "Failed to recreate Skia surface in rendering loop");
+        }
+        break;
+      case RenderCommand::Type::SetTimeline:
+        m_timeline = std::move(cmd.timeline);
+        m_previewDurationSec = (m_timeline ? m_timeline->totalDuration() : 0.0); // 교체한 Timeline 내에 계산되어 있는 총 영상 길이로 업데이트
+        if (cmd.keepPosition) {
+          // 편집 결과 교체: 재생 위치/재생 상태 유지 (길이가 줄었으면 끝으로), 편집 전 클립 이미지를 그대로 공유하므로 디코딩 결과도 유지
+          m_previewTimeSec = std::min(m_previewTimeSec, m_previewDurationSec);
+          break;
+        }
+        m_previewTimeSec = 0.0;
+        m_refinePending = false;
+        seekRequested = false;
+        m_decodeCache.clear(); // 이전 Timeline 의 이미지로 디코딩해둔 결과는 더 이상 필요 없음
+        break;
+      case RenderCommand::Type::TrimMemory:
+        trimGpuResources(cmd.trimLevel);
+        break;
+    }
+    cmd = RenderCommand();
+  }
+
+  if (seekRequested && m_timeline) {
+    m_previewTimeSec = std::clamp(seekSec, 0.0, std::max(0.0, m_previewDurationSec));
+
+    // seek 대상 시간에 필요한 원본 이미지를 백그라운드에서 디코딩 요청하고, 디코딩이 끝나기 전까지는 thumbnail 로 그림
+    RenderContext seekCtx{ m_skia.canvas(), m_renderWidth, m_renderHeight, m_previewTimeSec };
+    m_decodeCache.requestAsync(m_timeline->imagesAt(seekCtx));
+    m_refinePending = true;
+  } else if (m_refinePending && !m_decodeCache.isPending()) {
+    // 원본 디코딩이 끝났으면 이번 프레임부터 원본 화질로 갱신
+    m_refinePending = false;
+  }
 };
 
 void Renderer::process() {
+  TRACE_THREAD_NAME("RenderThread");
+
   // 렌더링 루프 진입 직전 EGL 초기화 수행
   if (!m_egl.init(m_pNativeWindow)) {
     Logger::error(k_logTag, "EGL initialization failed");
@@ -87,26 +240,26 @@ void Renderer::process() {
   }
 
   // ganesh gpu 백엔드 기반 SkSurface 생성
-  const int width = m_width.load();
-  const int height = m_height.load();
-  if (!m_skia.setupSkiaSurface(width, height)) {
+  m_renderWidth = m_width.load();
+  m_renderHeight = m_height.load();
+  if (!m_skia.setupSkiaSurface(m_renderWidth, m_renderHeight)) {
     Logger::error(k_logTag, "Failed to setup Skia surface");
     return;
   }
 
+  // 전환 효과 셰이더 컴파일은 프로세스당 한 번 (이미 컴파일되어 있으면 즉시 반환)
+  Transition::warmUp();
+
   auto prev = std::chrono::steady_clock::now();
 
   while (m_bIsRendering)
   {
-    // 렌더링 루프 시작 시 매 프레임마다 SkSurface 재생성이 필요한지 체크
-    if (m_resizeRequested.exchange(false)) {
-      // SkSurface 재생성 요청 소비
-      const int width = m_width.load();
-      const int height = m_height.load();
-      if (!m_skia.setupSkiaSurface(width, height)) {
-        Logger::error(k_logTag, "Failed to recreate Skia surface in rendering loop");
-        continue;  // 혹은 break; 로 종료
-      }
+    TRACE_SCOPE("preview", "frame");
+
+    // 프레임 시작 시점에 JS/UI 스레드에서 쌓아둔 제어 명령(play/pause/stop/seek/resize/timeline 교체)을 모두 적용
+    {
+      TRACE_SCOPE("preview", "drainCommands");
+      drainCommands();
     }
 
     // 현재 프레임의 delta time 계산
@@ -115,19 +268,15 @@ void Renderer::process() {
     prev = curr;
 
     if (auto* canvas = m_skia.canvas()) {
-      // 렌더링 스레드에서 타임라인 객체(공유 자원) 접근 시 스냅샷 캡쳐하여 얕은 복사 수행
-      std::shared_ptr<Timeline> tl;
-      {
-        std::lock_guard<std::mutex> lock(m_timelineMtx);
-        tl = m_timeline;
-      }
+      // 타임라인 객체는 drainCommands() 를 통해서만 교체되므로 렌더링 스레드에서 잠금 없이 접근
+      const std::shared_ptr<Timeline>& tl = m_timeline;
 
       if (tl) {
         /** 초기화된 타임라인 객체가 존재할 경우, 타임라인으로 렌더링 */
 
         // 현재 타임라인 재생 중(m_previewPlaying) 상태에 따라 타임라인 재생 시간(m_previewTimeSec) 업데이트
         // 만약 "m_previewPlaying == false" 인 경우, 타임라인 재생 시간을 그대로 둠으로써 동일한 클립만 계속 렌더링 -> Preview 가 정지되어 보임.
-        if (m_previewPlaying.load()) {
+        if (m_previewPlaying) {
           m_previewTimeSec += static_cast<double>(dt);
           const double dur = m_previewDurationSec;
 
@@ -139,13 +288,24 @@ void Renderer::process() {
         }
 
         // 현재 타임라인 재생 시간(m_previewTimeSec)을 기준으로 이미지 시퀀스 렌더링
-        const int w = m_width.load();
-        const int h = m_height.load();
-        RenderContext ctx{ canvas, w, h, m_previewTimeSec };
-        tl->render(ctx);
+        RenderContext ctx{ canvas, m_renderWidth, m_renderHeight, m_previewTimeSec };
+        ctx.quality = m_refinePending ? RenderQuality::Draft : RenderQuality::Preview;
+        ctx.decodeCache = &m_decodeCache;
+        {
+          TRACE_SCOPE("preview", "renderTimeline");
+          tl->render(ctx);
+        }
+
+        // 재생/seek/stop 으로 재생 위치가 바뀌었을 때만 알림 (일시정지 중에는 호출하지 않음)
+        if (m_timeListener && m_previewTimeSec != m_reportedTimeSec) {
+          m_reportedTimeSec = m_previewTimeSec;
+          m_timeListener(m_previewTimeSec);
+        }
       } else {
         /** 초기화된 타임라인 객체가 없을 경우, 기존 drawables 객체들 렌더링 */
 
+        TRACE_SCOPE("preview", "renderDrawables");
+
         // 캔버스 초기화
         canvas->clear(SK_ColorLTGRAY);
         
@@ -166,11 +326,25 @@ void Renderer::process() {
       }
 
       // Skia 내부 command queue 에 쌓인 현재 프레임까지 요청된 모든 draw operation 들을 GPU 로 전송하여 실행 요청
-      m_skia.flush();
+      {
+        TRACE_SCOPE("preview", "flush");
+        m_skia.flush();
+      }
+
+      // MemoryBudget 조회용 GPU 리소스 캐시 사용량 갱신
+      if (GrDirectContext* ctx = m_skia.directContext()) {
+        int count = 0;
+        size_t bytes = 0;
+        ctx->getResourceCacheUsage(&count, &bytes);
+        m_gpuCacheBytes.store(bytes);
+      }
     }
 
     // 디스플레이 vsync 시점에 맞춰 back buffer 와 front buffer 를 교체하여 화면 업데이트
-    m_egl.swapBuffer();
+    {
+      TRACE_SCOPE("preview", "swapBuffers");
+      m_egl.swapBuffer();
+    }
 
     // 16ms 대기 (약 60FPS)
     std::this_thread::sleep_for(std::chrono::milliseconds(16));
@@ -179,4 +353,5 @@ void Renderer::process() {
   // 렌더링 루프 종료 후 각종 자원 해제
   m_egl.destroy();
   m_skia.destroy();
+  m_gpuCacheBytes.store(0);
 };
@@ -5,10 +5,41 @@
 #include <thread>
 #include <vector>
 #include <mutex>
+#include <functional>
 #include "./EglContext.h"
 #include "./SkiaGanesh.h"
+#include "./MpscQueue.h"
 #include "../drawables/IDrawable.h"
 #include "../video/Timeline.h"
+#include "../video/DecodeCache.h"
+#include "../memory/MemoryBudget.h"
+
+/**
+ * JS/UI 스레드에서 렌더링 스레드로 전달되는 Preview 제어 명령
+ * -> Renderer 의 제어 함수들은 명령을 큐에 넣기만 하고 즉시 반환하며,
+ *    렌더링 스레드가 매 프레임 시작 시점에 큐를 비우면서 순서대로 적용한다.
+ */
+struct RenderCommand
+{
+  enum class Type
+  {
+    Play,
+    Pause,
+    Stop,
+    Seek,         // timeSec 사용
+    Resize,       // width/height 사용
+    SetTimeline,  // timeline 사용
+    TrimMemory,   // trimLevel 사용 (GPU 리소스는 렌더링 스레드에서만 해제 가능)
+  };
+
+  Type type = Type::Play;
+  double timeSec = 0.0;
+  int width = 0;
+  int height = 0;
+  std::shared_ptr<Timeline> timeline;
+  bool keepPosition = false;    // SetTimeline: 재생 위치/재생 상태 유지 (편집 결과 교체)
+  TrimLevel trimLevel = TrimLevel::None;
+};
 
 class Renderer
 {
@@ -31,15 +62,31 @@ public:
   int surfaceHeight() const { return m_height.load(); };
 
 public:
-  // 타임라인 연결/제어(Preview) 관련 메서드
-  void setTimeline(std::shared_ptr<Timeline> tl);
+  // 타임라인 연결/제어(Preview) 관련 메서드 (모두 명령 큐에 적재 후 즉시 반환 -> 다음 프레임 시작 시점에 반영)
+  // keepPosition 이면 재생 위치/재생 상태를 유지한 채 교체 (같은 클립들을 편집한 결과 Timeline 을 적용할 때)
+  void setTimeline(std::shared_ptr<Timeline> tl, bool keepPosition = false);
   std::shared_ptr<Timeline> timelineSnapshot();
   void previewPlay();
   void previewPause();
   void previewStop();
+  // 타임라인 재생 위치 이동(scrub). 연속 호출 시 마지막 요청만 다음 프레임에 반영된다.
+  void previewSeek(double tSec);
+  // 재생 위치(초)가 바뀐 프레임마다 호출될 listener 설정 (렌더링 스레드에서 호출되므로 start() 전에 설정)
+  void setTimeListener(std::function<void(double)> listener) { m_timeListener = std::move(listener); };
+
+public:
+  /**
+   * Renderer 가 들고 있는 메모리(디코딩 캐시, 최신 Timeline 이미지, 화면 render target, GPU 리소스 캐시)를 budget 에 등록
+   * - GPU 리소스 사용량은 렌더링 스레드가 매 프레임 갱신한 값을 보고하고, 회수 요청은 명령 큐를 통해 렌더링 스레드에서 수행된다.
+   */
+  void attachMemoryBudget(const std::shared_ptr<MemoryBudget>& budget);
 
 private:
   void process();
+  // 렌더링 스레드에서 프레임 시작 시점에 쌓인 명령들을 모두 꺼내 적용
+  void drainCommands();
+  // 렌더링 스레드에서 GrDirectContext 리소스 캐시 회수
+  void trimGpuResources(TrimLevel level);
 
 private:
   EglContext m_egl;
@@ -47,18 +94,36 @@ private:
   ANativeWindow* m_pNativeWindow = nullptr;             // Android Surface를 저장할 전역 변수
   std::thread m_renderThread;                           // 렌더링 루프를 실행할 스레드
   std::atomic<bool> m_bIsRendering = false;             // 렌더링 루프 상태
-  std::atomic<int> m_width = 0;                         // skia 내부에서 렌더링할 이미지(framebuffer) width
-  std::atomic<int> m_height = 0;                        // skia 내부에서 렌더링할 이미지(framebuffer) height
-  std::atomic<bool> m_resizeRequested = false;          // skia surface 리사이징 요청
+  std::atomic<int> m_width = 0;                         // 가장 최근에 요청된 surface width (surfaceWidth() 조회용)
+  std::atomic<int> m_height = 0;                        // 가장 최근에 요청된 surface height (surfaceHeight() 조회용)
+  int m_renderWidth = 0;                                // skia 내부에서 렌더링 중인 이미지(framebuffer) width (렌더링 스레드 전용)
+  int m_renderHeight = 0;                               // skia 내부에서 렌더링 중인 이미지(framebuffer) height (렌더링 스레드 전용)
   std::vector<std::shared_ptr<IDrawable>> m_drawables;  // skia 내부에서 렌더링할 객체들
   std::mutex m_drawablesMtx;                            // 렌더링 객체 컨테이너 mutex
 
 private:
+  MpscQueue<RenderCommand> m_commands;                  // JS/UI 스레드 -> 렌더링 스레드 제어 명령 큐
+
+  std::shared_ptr<Timeline> m_latestTimeline = nullptr; // 가장 최근에 설정된 Timeline (timelineSnapshot() 조회용)
+  std::mutex m_latestTimelineMtx;                       // m_latestTimeline 보호용 mutex (포인터 교체/복사 동안만 잠금)
+
+  // 아래 멤버들은 drainCommands() 를 통해 렌더링 스레드에서만 읽고 쓴다.
   std::shared_ptr<Timeline> m_timeline = nullptr;       // m_timeline 초기화 여부에 따라 m_drawables 를 렌더링할 지 타임라인을 렌더링할 지 결정
-  std::mutex m_timelineMtx;                             // 각 스레드에서 m_timeline 접근 시 race condition 방지를 위한 동기화 도구
-  std::atomic<bool> m_previewPlaying = false;           // 타임라인 재생 여부
-  double m_previewTimeSec = 0.0;                        // 현재 타임라인 재생 시간(초) -> 렌더링 스레드에서 갱신
-  double m_previewDurationSec = 0.0;                    // 타임라인 전체 길이(초) -> Renderer::setTimeline() 내에서 재계산
+  bool m_previewPlaying = false;                        // 타임라인 재생 여부
+  double m_previewTimeSec = 0.0;                        // 현재 타임라인 재생 시간(초)
+  double m_previewDurationSec = 0.0;                    // 타임라인 전체 길이(초) -> SetTimeline 명령 처리 시 재계산
+  double m_reportedTimeSec = -1.0;                      // m_timeListener 에 마지막으로 전달한 재생 시간(초) (같은 값이면 다시 알리지 않음)
+  std::function<void(double)> m_timeListener;           // 재생 위치 변경 listener (렌더링 스레드에서 호출)
+
+private:
+  // seek/scrub 관련 멤버변수 (렌더링 스레드 전용)
+  bool m_refinePending = false;                         // seek 직후 thumbnail 로 그린 프레임을 원본 화질로 갱신해야 하는지 여부 (렌더링 스레드 전용)
+  DecodeCache m_decodeCache;                            // seek 대상 시간의 원본 이미지를 미리 디코딩해두는 캐시
+
+private:
+  // 메모리 집계 관련 멤버변수
+  std::atomic<size_t> m_gpuCacheBytes = 0;              // GrDirectContext 리소스 캐시 사용량 (렌더링 스레드가 매 프레임 갱신)
+  std::vector<MemoryBudget::Registration> m_memorySources; // MemoryBudget 등록 핸들 (다른 멤버보다 먼저 해제되도록 마지막에 선언)
 
 private:
   static constexpr const char* k_logTag = "Renderer";
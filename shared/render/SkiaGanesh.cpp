@@ -1,5 +1,6 @@
 #include "SkiaGanesh.h"
 #include "../logger/Logger.h"
+#include "../video/ColorManagedDecoder.h"
 
 /**
  * GrDirectContext 및 SkSurface 생성 함수.
@@ -31,32 +32,8 @@ bool SkiaGanesh::setupSkiaSurface(int width, int height) {
 
   // SkSurface (재)생성
   if (!m_pSkiaSurface) {
-    // 1. OpenGL ES 컨텍스트에 바인딩된 default framebuffer(fbo id == 0) 설정을 GrGLFramebufferInfo 로 구성.
-    GrGLFramebufferInfo fboInfo;
-    fboInfo.fFBOID = (GrGLuint)0;
-    fboInfo.fFormat = GL_RGBA8;
-
-    // 2. OpenGL ES 컨텍스트에 바인딩된 default framebuffer 를 감싸는 skia 의 render target (interface) 생성.
-    GrBackendRenderTarget backendRT = GrBackendRenderTargets::MakeGL(
-      width,         // render target width
-      height,        // render target height
-      0,             // sampleCount (멀티샘플링 안 함)
-      0,             // 스텐실 비트 수 (없다면 0)
-      fboInfo        // OpenGL 기본 FBO 정보
-    );
-
-    // 3. WrapBackendRenderTarget 을 사용하여 default framebuffer 기반 SkSurface 를 생성.
-    m_pSkiaSurface = SkSurfaces::WrapBackendRenderTarget(
-      m_pGrContext.get(),                         // 이미 생성된 GrDirectContext
-      backendRT,
-      kBottomLeft_GrSurfaceOrigin,              // OpenGL은 좌하단 기준
-      SkColorType::kRGBA_8888_SkColorType,      // SkImageInfo의 color type (예, kN32_SkColorType)
-      nullptr,                                  // 컬러 공간 (필요에 따라 지정)
-      nullptr                                   // SkSurfaceProps (필요에 따라)
-    );
-
+    m_pSkiaSurface = wrapWindowFramebuffer(width, height);
     if (!m_pSkiaSurface) {
-      Logger::error(k_logTag, "Failed to create SkSurface from backend render target");
       return false;
     }
   }
@@ -76,3 +53,57 @@ void SkiaGanesh::destroy() {
   m_pGrContext = nullptr;
   m_pSkiaSurface = nullptr;
 };
+
+sk_sp<SkSurface> SkiaGanesh::wrapWindowFramebuffer(int width, int height) {
+  if (!m_pGrContext || width <= 0 || height <= 0) return nullptr;
+
+  // 1. OpenGL ES 컨텍스트에 바인딩된 default framebuffer(fbo id == 0) 설정을 GrGLFramebufferInfo 로 구성.
+  GrGLFramebufferInfo fboInfo;
+  fboInfo.fFBOID = (GrGLuint)0;
+  fboInfo.fFormat = GL_RGBA8;
+
+  // 2. OpenGL ES 컨텍스트에 바인딩된 default framebuffer 를 감싸는 skia 의 render target (interface) 생성.
+  GrBackendRenderTarget backendRT = GrBackendRenderTargets::MakeGL(
+    width,         // render target width
+    height,        // render target height
+    0,             // sampleCount (멀티샘플링 안 함)
+    0,             // 스텐실 비트 수 (없다면 0)
+    fboInfo        // OpenGL 기본 FBO 정보
+  );
+
+  // 3. WrapBackendRenderTarget 을 사용하여 default framebuffer 기반 SkSurface 를 생성.
+  sk_sp<SkSurface> surface = SkSurfaces::WrapBackendRenderTarget(
+    m_pGrContext.get(),                         // 이미 생성된 GrDirectContext
+    backendRT,
+    kBottomLeft_GrSurfaceOrigin,              // OpenGL은 좌하단 기준
+    SkColorType::kRGBA_8888_SkColorType,      // SkImageInfo의 color type (예, kN32_SkColorType)
+    ColorManagedDecoder::outputColorSpace(),  // 컬러 공간 (디코딩된 이미지와 같은 출력 색공간 -> draw 시 색 변환 없음)
+    nullptr                                   // SkSurfaceProps (필요에 따라)
+  );
+
+  if (!surface) {
+    Logger::error(k_logTag, "Failed to create SkSurface from backend render target");
+  }
+  return surface;
+};
+
+sk_sp<SkSurface> SkiaGanesh::makeRenderTarget(int width, int height, bool mipmapped) {
+  if (!m_pGrContext || width <= 0 || height <= 0) return nullptr;
+
+  // GPU 메모리에 offscreen render target(텍스처)을 생성 -> 렌더링 결과를 snapshot 으로 떠서 다른 surface 에 다시 그릴 수 있음
+  const SkImageInfo info = ColorManagedDecoder::outputInfo(width, height);
+  sk_sp<SkSurface> surface = SkSurfaces::RenderTarget(
+    m_pGrContext.get(),
+    skgpu::Budgeted::kYes,
+    info,
+    0,                          // sampleCount (멀티샘플링 안 함)
+    kTopLeft_GrSurfaceOrigin,
+    nullptr,                    // SkSurfaceProps
+    mipmapped                   // 축소해서 다시 그릴 때 mipmap 샘플링을 사용하려면 true
+  );
+
+  if (!surface) {
+    Logger::error(k_logTag, "Failed to create offscreen render target");
+  }
+  return surface;
+};
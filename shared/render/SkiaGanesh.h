@@ -17,9 +17,15 @@ public:
   void flush();
   void destroy();
 
+  // 현재 바인딩된 EGLSurface 의 default framebuffer(FBO 0) 를 감싸는 SkSurface 생성 (setupSkiaSurface 이후 호출)
+  sk_sp<SkSurface> wrapWindowFramebuffer(int width, int height);
+  // GrDirectContext 를 공유하는 offscreen GPU render target 생성 (setupSkiaSurface 이후 호출)
+  sk_sp<SkSurface> makeRenderTarget(int width, int height, bool mipmapped = false);
+
 public:
   SkCanvas* canvas() const { return m_pSkiaSurface ? m_pSkiaSurface->getCanvas() : nullptr; };
   sk_sp<SkSurface> surface() const { return m_pSkiaSurface; };
+  GrDirectContext* directContext() const { return m_pGrContext.get(); };
 
 private:
   // ganesh gpu 백엔드 관련 전역 객체 (skia 버전 스마트 포인터(std::shared_ptr 과 유사)로 관리)
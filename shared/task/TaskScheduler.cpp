@@ -0,0 +1,224 @@
+#include "TaskScheduler.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <algorithm> // std::max
+
+namespace {
+
+// 현재 스레드가 작업 스레드면 그 번호 (아니면 -1)
+thread_local int t_workerIndex = -1;
+
+uint64_t elapsedUs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+} // namespace
+
+TaskScheduler& TaskScheduler::instance() {
+  static TaskScheduler s_instance;
+  return s_instance;
+};
+
+TaskScheduler::TaskScheduler() {
+  const int count = std::max(3, (int)std::thread::hardware_concurrency());
+  m_nonCriticalLimit = count - 1;
+  m_exportLimit = count - 2;
+
+  // 다른 스레드의 deque 를 훔쳐볼 수 있도록 모든 Worker 를 만든 뒤 스레드 시작
+  for (int i = 0; i < count; i++) {
+    m_workers.push_back(std::make_unique<Worker>());
+  }
+  for (int i = 0; i < count; i++) {
+    m_workers[i]->thread = std::thread([this, i]() { workerLoop(i); });
+  }
+  Logger::info(k_logTag, "Started %d workers", count);
+};
+
+TaskScheduler::~TaskScheduler() {
+  // 대기 중인 작업은 실행하지 않고 버림 (실행 중인 작업이 끝날 때까지만 대기)
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_quit = true;
+  }
+  m_cv.notify_all();
+  for (auto& worker : m_workers) {
+    if (worker->thread.joinable()) worker->thread.join();
+  }
+};
+
+void TaskScheduler::submit(TaskQos qos, const char* name, std::function<void()> fn, CancellationToken token) {
+  if (!fn) return;
+  const size_t q = (size_t)qos;
+
+  Task task;
+  task.fn = std::move(fn);
+  task.token = std::move(token);
+  task.name = name;
+  task.qos = qos;
+  task.enqueueTime = std::chrono::steady_clock::now();
+
+  // 작업 스레드에서 등록한 작업은 자기 deque 에 (캐시 친화적), 외부에서 등록한 작업은 돌아가며 분배
+  const int self = t_workerIndex;
+  Worker& worker = (self >= 0) ? *m_workers[self] : *m_workers[m_nextWorker.fetch_add(1) % m_workers.size()];
+  {
+    std::lock_guard<std::mutex> lock(worker.mtx);
+    worker.queues[q].push_back(std::move(task));
+    m_counters[q].queued.fetch_add(1);
+  }
+  TRACE_COUNTER("task", k_queueCounterNames[q], m_counters[q].queued.load());
+
+  // 잠들려는 스레드가 조건 확인과 wait 사이에서 알림을 놓치지 않도록 m_mtx 를 거친 뒤 깨움
+  { std::lock_guard<std::mutex> lock(m_mtx); }
+  m_cv.notify_one();
+};
+
+TaskSchedulerStats TaskScheduler::stats() const {
+  TaskSchedulerStats stats;
+  stats.workerCount = (int)m_workers.size();
+  for (size_t q = 0; q < (size_t)TaskQos::Count; q++) {
+    const Counters& c = m_counters[q];
+    TaskQosStats& out = stats.qos[q];
+    out.queued = (size_t)std::max<int64_t>(0, c.queued.load());
+    out.running = (size_t)std::max<int64_t>(0, c.running.load());
+    out.completed = c.completed.load();
+    out.cancelled = c.cancelled.load();
+    if (out.completed > 0) {
+      out.avgLatencyMs = c.latencyUsSum.load() / 1000.0 / out.completed;
+      out.avgRunMs = c.runUsSum.load() / 1000.0 / out.completed;
+    }
+    out.maxLatencyMs = c.latencyUsMax.load() / 1000.0;
+  }
+  return stats;
+};
+
+void TaskScheduler::resetStats() {
+  for (auto& c : m_counters) {
+    c.completed = 0;
+    c.cancelled = 0;
+    c.latencyUsSum = 0;
+    c.latencyUsMax = 0;
+    c.runUsSum = 0;
+  }
+};
+
+const char* TaskScheduler::qosName(TaskQos qos) {
+  switch (qos) {
+    case TaskQos::PreviewCritical: return "previewCritical";
+    case TaskQos::Export:          return "export";
+    case TaskQos::Background:      return "background";
+    default:                       return "unknown";
+  }
+};
+
+void TaskScheduler::workerLoop(int self) {
+  t_workerIndex = self;
+  TRACE_THREAD_NAME("TaskWorker");
+
+  for (;;) {
+    Task task;
+    if (takeTask(self, task)) {
+      run(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_cv.wait(lock, [this]() { return m_quit || hasRunnableLocked(); });
+    if (m_quit) return;
+  }
+};
+
+bool TaskScheduler::takeTask(int self, Task& out) {
+  const int count = (int)m_workers.size();
+  for (size_t q = 0; q < (size_t)TaskQos::Count; q++) {
+    const TaskQos qos = (TaskQos)q;
+    if (m_counters[q].queued.load() <= 0) continue;
+
+    // Export 는 Export 슬롯을 먼저 확보 (Background 용 슬롯 하나는 항상 비워둠, 다 찼으면 Background 를 찾아봄)
+    const bool isExport = (qos == TaskQos::Export);
+    if (isExport) {
+      int running = m_exportRunning.load();
+      bool reserved = false;
+      while (running < m_exportLimit && !(reserved = m_exportRunning.compare_exchange_weak(running, running + 1))) {}
+      if (!reserved) continue;
+    }
+
+    // Export / Background 는 실행 슬롯을 먼저 확보 (PreviewCritical 용 스레드 하나는 항상 비워둠)
+    const bool critical = (qos == TaskQos::PreviewCritical);
+    if (!critical) {
+      int running = m_nonCriticalRunning.load();
+      do {
+        if (running >= m_nonCriticalLimit) {
+          if (isExport) m_exportRunning.fetch_sub(1);
+          return false; // 남은 QoS 도 모두 제한 대상
+        }
+      } while (!m_nonCriticalRunning.compare_exchange_weak(running, running + 1));
+    }
+
+    bool found = popFrom(*m_workers[self], qos, false, out);
+    for (int k = 1; !found && k < count; k++) {
+      found = popFrom(*m_workers[(self + k) % count], qos, true, out);
+    }
+    if (found) return true;
+    if (!critical) m_nonCriticalRunning.fetch_sub(1);
+    if (isExport) m_exportRunning.fetch_sub(1);
+  }
+  return false;
+};
+
+bool TaskScheduler::popFrom(Worker& worker, TaskQos qos, bool steal, Task& out) {
+  std::lock_guard<std::mutex> lock(worker.mtx);
+  auto& queue = worker.queues[(size_t)qos];
+  if (queue.empty()) return false;
+
+  // 주인은 오래된 작업부터(대기 시간 최소화), 훔치는 쪽은 최근 작업부터 가져가 주인과 같은 끝을 두고 경쟁하지 않도록 함
+  if (steal) {
+    out = std::move(queue.back());
+    queue.pop_back();
+  } else {
+    out = std::move(queue.front());
+    queue.pop_front();
+  }
+  m_counters[(size_t)qos].queued.fetch_sub(1);
+  return true;
+};
+
+void TaskScheduler::run(Task& task) {
+  const size_t q = (size_t)task.qos;
+  Counters& c = m_counters[q];
+  TRACE_COUNTER("task", k_queueCounterNames[q], c.queued.load());
+
+  if (task.token.isCancelled()) {
+    c.cancelled.fetch_add(1);
+  } else {
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t latencyUs = elapsedUs(task.enqueueTime, start);
+    c.latencyUsSum.fetch_add(latencyUs);
+    uint64_t maxUs = c.latencyUsMax.load();
+    while (latencyUs > maxUs && !c.latencyUsMax.compare_exchange_weak(maxUs, latencyUs)) {}
+
+    c.running.fetch_add(1);
+    {
+      TRACE_SCOPE("task", task.name);
+      task.fn();
+    }
+    c.running.fetch_sub(1);
+    c.runUsSum.fetch_add(elapsedUs(start, std::chrono::steady_clock::now()));
+    c.completed.fetch_add(1);
+  }
+  // 캡처한 객체(shared_ptr 등)를 다음 작업을 기다리는 동안 붙들고 있지 않도록 바로 해제
+  task.fn = nullptr;
+
+  // 실행 슬롯 반환 -> 제한 때문에 기다리던 작업이 있으면 실행할 수 있도록 깨움
+  if (task.qos != TaskQos::PreviewCritical) {
+    if (task.qos == TaskQos::Export) m_exportRunning.fetch_sub(1);
+    m_nonCriticalRunning.fetch_sub(1);
+    { std::lock_guard<std::mutex> lock(m_mtx); }
+    m_cv.notify_one();
+  }
+};
+
+bool TaskScheduler::hasRunnableLocked() const {
+  if (m_counters[(size_t)TaskQos::PreviewCritical].queued.load() > 0) return true;
+  if (m_nonCriticalRunning.load() >= m_nonCriticalLimit) return false;
+  if (m_counters[(size_t)TaskQos::Background].queued.load() > 0) return true;
+  return m_counters[(size_t)TaskQos::Export].queued.load() > 0 && m_exportRunning.load() < m_exportLimit;
+};
@@ -0,0 +1,156 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 작업 우선순위(QoS) 분류 (앞쪽일수록 먼저 실행)
+enum class TaskQos
+{
+  PreviewCritical,  // Preview 화면에 바로 필요한 작업 (seek 대상 디코딩 등)
+  Export,           // export(인코딩) 작업
+  Background,       // 미리 해두면 좋은 작업 (프레임 prefetch 등)
+  Count,
+};
+
+/**
+ * 작업 취소 token (복사본끼리 같은 취소 상태를 공유)
+ * - 작업은 실행 도중 isCancelled() 를 확인해 스스로 중단한다. (강제 중단 없음)
+ * - TaskScheduler 는 실행 시작 전에 취소된 작업은 실행하지 않고 버린다.
+ */
+class CancellationToken
+{
+public:
+  CancellationToken() : m_flag(std::make_shared<std::atomic<bool>>(false)) {};
+
+  void cancel() const { m_flag->store(true); };
+  bool isCancelled() const { return m_flag->load(); };
+
+  // std::atomic<bool>& 로 취소 플래그를 받는 API(IEncoder::encodeBlocking 등)에 그대로 전달할 때 사용
+  std::atomic<bool>& flag() const { return *m_flag; };
+
+private:
+  std::shared_ptr<std::atomic<bool>> m_flag;
+};
+
+// QoS 별 작업 통계 스냅샷
+struct TaskQosStats
+{
+  size_t queued = 0;                  // 대기 중인 작업 수
+  size_t running = 0;                 // 실행 중인 작업 수
+  uint64_t completed = 0;             // 실행을 마친 작업 수
+  uint64_t cancelled = 0;             // 시작 전에 취소되어 버린 작업 수
+  double avgLatencyMs = 0.0;          // 등록 ~ 실행 시작 평균 대기 시간
+  double maxLatencyMs = 0.0;          // 등록 ~ 실행 시작 최대 대기 시간
+  double avgRunMs = 0.0;              // 평균 실행 시간
+};
+
+struct TaskSchedulerStats
+{
+  int workerCount = 0;
+  std::array<TaskQosStats, (size_t)TaskQos::Count> qos{};
+
+  const TaskQosStats& of(TaskQos q) const { return qos[(size_t)q]; };
+};
+
+/**
+ * 엔진 전체가 공유하는 work-stealing 작업 스레드 풀
+ *
+ * - 작업 스레드 수는 CPU 코어 수(최소 3)이며, 각 스레드는 QoS 별 작업 deque 를 따로 가진다.
+ *   외부 스레드에서 등록된 작업은 작업 스레드들에 돌아가며 분배되고, 작업 스레드 안에서 등록된 작업은 자기 deque 에 쌓인다.
+ * - 각 스레드는 우선순위가 높은 QoS 부터 자기 deque 앞쪽(오래된 것)을 꺼내고, 없으면 다른 스레드 deque 의 뒤쪽에서 훔쳐온다.
+ * - Export / Background 작업은 동시에 최대 (스레드 수 - 1) 개, 그 중 Export 는 최대 (스레드 수 - 2) 개만 실행한다.
+ *   -> 긴 export 작업이 풀을 모두 차지해도 PreviewCritical 작업을 바로 실행할 스레드와 Background(prefetch) 를 실행할 스레드가 항상 하나씩 남는다.
+ *      (2 코어 기기에서도 이 두 슬롯을 확보하도록 스레드는 최소 3개. export 는 대부분 Codec/GPU 를 기다리므로 코어 수보다 많아도 부담이 적음)
+ * - 작업 안에서 다른 작업의 완료를 기다리면 안 된다. (스레드가 모두 막힐 수 있음)
+ *   렌더링 스레드(EGL context 소유), 이벤트 전달/로그 스레드, Codec 출력 drain 처럼 계속 대기하며 도는 루프는 풀에서 실행하지 않는다.
+ * - QoS 별 대기 작업 수는 trace counter("task")로, 대기 시간/실행 시간은 stats() 로 확인할 수 있다.
+ */
+class TaskScheduler
+{
+public:
+  static TaskScheduler& instance();
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+public:
+  /**
+   * 작업 등록 (블로킹 없음)
+   * - name: trace 구간 이름 (문자열 리터럴)
+   * - token: 실행 전에 취소되면 fn 을 호출하지 않고 버림 (fn 은 그대로 소멸하므로 정리가 필요한 상태는 fn 이 캡처한 객체가 맡아야 함)
+   */
+  void submit(TaskQos qos, const char* name, std::function<void()> fn, CancellationToken token = CancellationToken());
+
+  int workerCount() const { return (int)m_workers.size(); };
+  // 동시에 실행할 수 있는 Export 작업 수 (ExportJobManager 의 동시 실행 제한은 이 값을 넘지 않아야 대기 없이 바로 시작됨)
+  int exportCapacity() const { return m_exportLimit; };
+
+  // 작업 통계 조회 / 누적 값 초기화 (대기/실행 중 작업 수는 유지)
+  TaskSchedulerStats stats() const;
+  void resetStats();
+
+  static const char* qosName(TaskQos qos);
+
+private:
+  TaskScheduler();
+  ~TaskScheduler();
+
+  struct Task
+  {
+    std::function<void()> fn;
+    CancellationToken token;
+    const char* name = nullptr;
+    TaskQos qos = TaskQos::Background;
+    std::chrono::steady_clock::time_point enqueueTime;  // 대기 시간 측정용
+  };
+
+  struct Worker
+  {
+    std::mutex mtx;                                     // queues 보호용 mutex
+    std::array<std::deque<Task>, (size_t)TaskQos::Count> queues; // QoS 별 작업 deque
+    std::thread thread;
+  };
+
+  struct Counters
+  {
+    std::atomic<int64_t> queued{ 0 };
+    std::atomic<int64_t> running{ 0 };
+    std::atomic<uint64_t> completed{ 0 };
+    std::atomic<uint64_t> cancelled{ 0 };
+    std::atomic<uint64_t> latencyUsSum{ 0 };
+    std::atomic<uint64_t> latencyUsMax{ 0 };
+    std::atomic<uint64_t> runUsSum{ 0 };
+  };
+
+  void workerLoop(int self);
+  // 실행할 작업 하나 꺼내기 (자기 deque -> 다른 스레드 deque 순서, QoS 우선순위 순)
+  bool takeTask(int self, Task& out);
+  bool popFrom(Worker& worker, TaskQos qos, bool steal, Task& out);
+  void run(Task& task);
+  // 대기 중인 작업 중 지금 실행할 수 있는 것이 있는지 (m_mtx 잠금 상태에서 호출)
+  bool hasRunnableLocked() const;
+
+private:
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::array<Counters, (size_t)TaskQos::Count> m_counters;
+  std::atomic<int> m_nonCriticalRunning{ 0 };           // 실행 중인 Export + Background 작업 수
+  int m_nonCriticalLimit = 1;                           // Export + Background 동시 실행 제한 (스레드 수 - 1)
+  std::atomic<int> m_exportRunning{ 0 };                // 실행 중인 Export 작업 수
+  int m_exportLimit = 1;                                // Export 동시 실행 제한 (스레드 수 - 2, Background 용 슬롯 하나를 남김)
+  std::atomic<uint32_t> m_nextWorker{ 0 };              // 외부 등록 작업을 분배할 다음 스레드
+  std::mutex m_mtx;                                     // 잠들기/깨우기용 mutex
+  std::condition_variable m_cv;                         // 새 작업 등록 / 실행 슬롯 반환을 작업 스레드에 알림
+  bool m_quit = false;
+
+private:
+  static constexpr const char* k_queueCounterNames[] = { "queue.previewCritical", "queue.export", "queue.background" };
+  static constexpr const char* k_logTag = "TaskScheduler";
+};
@@ -0,0 +1,277 @@
+#include "Trace.h"
+#include "../logger/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+constexpr const char* k_logTag = "Trace";
+constexpr size_t k_eventsPerThread = 8192;      // 스레드당 최대 이벤트 수 (약 400KB, 세션 중 처음 기록할 때 할당)
+
+struct TraceEvent
+{
+  const char* category = nullptr;
+  const char* name = nullptr;
+  const char* argName = nullptr;
+  int64_t argValue = 0;                         // 'C' 이벤트는 counter 값
+  uint64_t tsUs = 0;
+  uint64_t durUs = 0;
+  char phase = 'X';                             // 'X': complete, 'i': instant, 'C': counter
+};
+
+/**
+ * 스레드 하나가 단독으로 쓰는 이벤트 버퍼
+ * - 쓰기는 소유 스레드만 하므로 잠금이 필요 없고, 이벤트를 채운 뒤 count 를 release 로 공개한다.
+ * - 읽는 쪽(toJson)은 count 를 acquire 로 읽고 그 앞까지만 읽는다.
+ * - 가득 차면 이후 이벤트는 버린다. (ring 으로 덮어쓰면 읽는 도중 값이 바뀔 수 있음)
+ */
+struct ThreadBuffer
+{
+  int tid = 0;                                  // trace viewer 용 스레드 번호 (등록 순)
+  char threadName[32] = {};                     // 스레드 이름 (registry mutex 로 보호)
+  std::unique_ptr<TraceEvent[]> events;
+  std::atomic<size_t> count = 0;
+  std::atomic<uint32_t> generation = 0;         // 이 버퍼의 이벤트가 속한 세션 번호
+  std::atomic<bool> retired = false;            // 소유 스레드 종료 여부
+};
+
+struct Registry
+{
+  std::mutex mtx;                               // buffers 목록 / 스레드 이름 보호
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  int nextTid = 1;
+  std::atomic<bool> recording = false;
+  std::atomic<uint32_t> generation = 0;         // start() 마다 증가
+  std::atomic<size_t> dropped = 0;              // 버퍼가 가득 차서 버린 이벤트 수
+};
+
+Registry& registry() {
+  // 스레드 종료(thread_local 소멸) 시점에도 접근하므로 해제하지 않는다.
+  static Registry* s_registry = new Registry();
+  return *s_registry;
+}
+
+// 스레드 종료 시 버퍼를 retired 로 표시 (다음 start() 에서 정리됨)
+struct ThreadSlot
+{
+  std::shared_ptr<ThreadBuffer> buffer;
+  ~ThreadSlot() {
+    if (buffer) buffer->retired.store(true, std::memory_order_release);
+  };
+};
+
+thread_local ThreadSlot t_slot;
+
+ThreadBuffer& localBuffer() {
+  if (!t_slot.buffer) {
+    auto buffer = std::make_shared<ThreadBuffer>();
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    buffer->tid = reg.nextTid++;
+    reg.buffers.push_back(buffer);
+    t_slot.buffer = std::move(buffer);
+  }
+  return *t_slot.buffer;
+}
+
+void record(const TraceEvent& ev) {
+  Registry& reg = registry();
+  ThreadBuffer& buf = localBuffer();
+
+  // 새 세션이 시작되었으면 소유 스레드가 직접 버퍼를 비움 (다른 스레드는 이 버퍼에 쓰지 않음)
+  // (start() 는 registry mutex 를 잡은 채 세션 번호를 바꾸므로 toJson() 이 버퍼를 읽는 동안에는 새 세션 번호가 보이지 않음)
+  const uint32_t gen = reg.generation.load(std::memory_order_acquire);
+  if (buf.generation.load(std::memory_order_relaxed) != gen) {
+    if (!buf.events) {
+      buf.events.reset(new TraceEvent[k_eventsPerThread]);
+    }
+    buf.count.store(0, std::memory_order_relaxed);
+    buf.generation.store(gen, std::memory_order_release);
+  }
+
+  const size_t n = buf.count.load(std::memory_order_relaxed);
+  if (n >= k_eventsPerThread) {
+    reg.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buf.events[n] = ev;
+  buf.count.store(n + 1, std::memory_order_release);
+}
+
+void appendEscaped(std::string& out, const char* s) {
+  for (; s && *s; s++) {
+    const char c = *s;
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if ((unsigned char)c < 0x20) {
+      char hex[8];
+      std::snprintf(hex, sizeof(hex), "\\u%04x", c);
+      out += hex;
+    } else {
+      out.push_back(c);
+    }
+  }
+}
+
+} // namespace
+
+void Trace::start() {
+  Registry& reg = registry();
+  {
+    // 종료된 스레드의 버퍼 정리
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    std::vector<std::shared_ptr<ThreadBuffer>> alive;
+    for (auto& b : reg.buffers) {
+      if (!b->retired.load(std::memory_order_acquire)) alive.push_back(std::move(b));
+    }
+    reg.buffers = std::move(alive);
+    // 세션 번호는 toJson() 과 같은 mutex 안에서 바꿈
+    // -> 각 스레드는 바뀐 세션 번호를 본 뒤에야 자기 버퍼를 비우므로, toJson() 이 읽는 도중에는 버퍼가 초기화되지 않음
+    reg.dropped.store(0);
+    reg.generation.fetch_add(1, std::memory_order_acq_rel);
+  }
+  reg.recording.store(true, std::memory_order_release);
+#if !ENGINE_TRACE_ENABLED
+  Logger::warn(k_logTag, "Tracing started, but trace macros are compiled out (ENGINE_TRACE_ENABLED=0)");
+#endif
+};
+
+void Trace::stop() {
+  registry().recording.store(false, std::memory_order_release);
+};
+
+bool Trace::isRecording() {
+  return registry().recording.load(std::memory_order_relaxed);
+};
+
+uint64_t Trace::nowUs() {
+  static const auto s_epoch = std::chrono::steady_clock::now();
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+};
+
+void Trace::complete(const char* category, const char* name, uint64_t startUs, uint64_t endUs, const char* argName, int64_t argValue) {
+  TraceEvent ev;
+  ev.category = category;
+  ev.name = name;
+  ev.argName = argName;
+  ev.argValue = argValue;
+  ev.tsUs = startUs;
+  ev.durUs = endUs > startUs ? endUs - startUs : 0;
+  ev.phase = 'X';
+  record(ev);
+};
+
+void Trace::instant(const char* category, const char* name) {
+  if (!isRecording()) return;
+  TraceEvent ev;
+  ev.category = category;
+  ev.name = name;
+  ev.tsUs = nowUs();
+  ev.phase = 'i';
+  record(ev);
+};
+
+void Trace::counter(const char* category, const char* name, int64_t value) {
+  if (!isRecording()) return;
+  TraceEvent ev;
+  ev.category = category;
+  ev.name = name;
+  ev.argValue = value;
+  ev.tsUs = nowUs();
+  ev.phase = 'C';
+  record(ev);
+};
+
+void Trace::setThreadName(const char* name) {
+  ThreadBuffer& buf = localBuffer();
+  std::lock_guard<std::mutex> lock(registry().mtx);
+  std::snprintf(buf.threadName, sizeof(buf.threadName), "%s", name ? name : "");
+};
+
+std::string Trace::toJson() {
+  Registry& reg = registry();
+  std::string out;
+  out.reserve(64 * 1024);
+  out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  char num[96];
+
+  // 읽는 동안 start() 가 새 세션을 시작하지 못하도록 registry mutex 를 잡은 뒤 세션 번호를 읽음
+  // (기록 중에 호출해도 각 버퍼는 count 로 공개된 이벤트까지만 읽으므로 안전, 다만 그 시점까지의 이벤트만 포함됨)
+  std::lock_guard<std::mutex> lock(reg.mtx);
+  const uint32_t gen = reg.generation.load(std::memory_order_acquire);
+  for (const auto& b : reg.buffers) {
+    // 스레드 이름 메타데이터
+    if (b->threadName[0]) {
+      if (!first) out.push_back(',');
+      first = false;
+      std::snprintf(num, sizeof(num), "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"", b->tid);
+      out += num;
+      appendEscaped(out, b->threadName);
+      out += "\"}}";
+    }
+
+    if (b->generation.load(std::memory_order_acquire) != gen) continue; // 이번 세션에 기록하지 않은 스레드
+    const size_t count = b->count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+      const TraceEvent& ev = b->events[i];
+      if (!first) out.push_back(',');
+      first = false;
+
+      out += "{\"name\":\"";
+      appendEscaped(out, ev.name);
+      out += "\",\"cat\":\"";
+      appendEscaped(out, ev.category);
+      std::snprintf(num, sizeof(num), "\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%llu", ev.phase, b->tid, (unsigned long long)ev.tsUs);
+      out += num;
+
+      if (ev.phase == 'X') {
+        std::snprintf(num, sizeof(num), ",\"dur\":%llu", (unsigned long long)ev.durUs);
+        out += num;
+        if (ev.argName) {
+          out += ",\"args\":{\"";
+          appendEscaped(out, ev.argName);
+          std::snprintf(num, sizeof(num), "\":%lld}", (long long)ev.argValue);
+          out += num;
+        }
+      } else if (ev.phase == 'C') {
+        out += ",\"args\":{\"";
+        appendEscaped(out, ev.name);
+        std::snprintf(num, sizeof(num), "\":%lld}", (long long)ev.argValue);
+        out += num;
+      } else {
+        out += ",\"s\":\"t\""; // instant event 범위: 스레드
+      }
+      out.push_back('}');
+    }
+  }
+  out += "]}";
+
+  const size_t dropped = reg.dropped.load();
+  if (dropped > 0) {
+    Logger::warn(k_logTag, "%zu trace events dropped (per-thread buffer full)", dropped);
+  }
+  return out;
+};
+
+bool Trace::dumpJson(const std::string& path) {
+  const std::string json = toJson();
+  FILE* file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    Logger::error(k_logTag, "Failed to open trace output: %s", path.c_str());
+    return false;
+  }
+  const bool ok = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+  std::fclose(file);
+  if (!ok) {
+    Logger::error(k_logTag, "Failed to write trace output: %s", path.c_str());
+    return false;
+  }
+  Logger::info(k_logTag, "Trace written: %s (%zu bytes)", path.c_str(), json.size());
+  return true;
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * 스레드 간 구간 시간 측정(trace event) 계측
+ *
+ * - TRACE_SCOPE 등의 매크로로 구간을 기록하면, 각 스레드는 자신만의 버퍼에 잠금 없이 이벤트를 쌓는다.
+ * - Trace::start() ~ Trace::stop() 사이에 기록된 이벤트를 Trace::dumpJson() 으로
+ *   Chrome trace event 형식(JSON)으로 저장할 수 있다. (chrome://tracing, ui.perfetto.dev 에서 열람)
+ * - ENGINE_TRACE_ENABLED 가 0 이면 매크로는 아무 코드도 만들지 않는다. (Trace 클래스 API 는 그대로 존재하며 빈 trace 를 기록)
+ * - category / name / argName 은 문자열 리터럴처럼 프로세스가 끝날 때까지 유효한 포인터여야 한다. (복사하지 않고 포인터만 기록)
+ */
+#ifndef ENGINE_TRACE_ENABLED
+  #define ENGINE_TRACE_ENABLED 0
+#endif
+
+class Trace
+{
+public:
+  // 기록 시작 (이전 세션의 이벤트는 버림)
+  static void start();
+  // 기록 중지
+  static void stop();
+  static bool isRecording();
+
+  // 지금까지 기록된 이벤트를 Chrome trace event JSON 으로 변환 (stop() 이후 호출 권장, 변환 중에는 start() 가 새 세션을 시작하지 않고 기다림)
+  static std::string toJson();
+  static bool dumpJson(const std::string& path);
+
+  // 현재 스레드 이름 지정 (trace viewer 에 표시됨)
+  static void setThreadName(const char* name);
+
+public:
+  // 아래 함수들은 매크로에서 사용
+  static uint64_t nowUs();
+  static void complete(const char* category, const char* name, uint64_t startUs, uint64_t endUs, const char* argName = nullptr, int64_t argValue = 0);
+  static void instant(const char* category, const char* name);
+  static void counter(const char* category, const char* name, int64_t value);
+};
+
+// 생성 시점부터 소멸 시점까지를 하나의 구간(complete event)으로 기록
+class TraceScope
+{
+public:
+  TraceScope(const char* category, const char* name, const char* argName = nullptr, int64_t argValue = 0) {
+    if (!Trace::isRecording()) return;
+    m_category = category;
+    m_name = name;
+    m_argName = argName;
+    m_argValue = argValue;
+    m_startUs = Trace::nowUs();
+  };
+  ~TraceScope() {
+    if (m_name) {
+      Trace::complete(m_category, m_name, m_startUs, Trace::nowUs(), m_argName, m_argValue);
+    }
+  };
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+  const char* m_category = nullptr;
+  const char* m_name = nullptr;       // nullptr 이면 기록하지 않음 (생성 시점에 기록 중이 아니었음)
+  const char* m_argName = nullptr;
+  int64_t m_argValue = 0;
+  uint64_t m_startUs = 0;
+};
+
+#if ENGINE_TRACE_ENABLED
+  #define ENGINE_TRACE_CONCAT_INNER(a, b) a##b
+  #define ENGINE_TRACE_CONCAT(a, b) ENGINE_TRACE_CONCAT_INNER(a, b)
+  // 현재 블록이 끝날 때까지를 구간으로 기록
+  #define TRACE_SCOPE(category, name) TraceScope ENGINE_TRACE_CONCAT(traceScope_, __LINE__)(category, name)
+  // 정수 인자 하나를 함께 기록 (예: 파일 인덱스, 프레임 번호)
+  #define TRACE_SCOPE_ARG(category, name, argName, argValue) \
+    TraceScope ENGINE_TRACE_CONCAT(traceScope_, __LINE__)(category, name, argName, (int64_t)(argValue))
+  #define TRACE_INSTANT(category, name) Trace::instant(category, name)
+  #define TRACE_COUNTER(category, name, value) Trace::counter(category, name, (int64_t)(value))
+  #define TRACE_THREAD_NAME(name) Trace::setThreadName(name)
+#else
+  #define TRACE_SCOPE(category, name) ((void)0)
+  #define TRACE_SCOPE_ARG(category, name, argName, argValue) ((void)0)
+  #define TRACE_INSTANT(category, name) ((void)0)
+  #define TRACE_COUNTER(category, name, value) ((void)0)
+  #define TRACE_THREAD_NAME(name) ((void)0)
+#endif
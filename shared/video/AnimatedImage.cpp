@@ -0,0 +1,95 @@
+#include "AnimatedImage.h"
+#include "ColorManagedDecoder.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <codec/SkCodecAnimation.h>
+#include <algorithm> // std::upper_bound, std::min, std::max
+#include <cmath>     // std::fmod, std::floor
+
+std::shared_ptr<AnimatedImage> AnimatedImage::Make(sk_sp<SkData> data) {
+  if (!data) return nullptr;
+  std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+  if (!codec || codec->getFrameCount() < 2) return nullptr;
+  return std::shared_ptr<AnimatedImage>(new AnimatedImage(std::move(data), std::move(codec)));
+};
+
+AnimatedImage::AnimatedImage(sk_sp<SkData> data, std::unique_ptr<SkCodec> codec)
+  : m_data(std::move(data)), m_codec(std::move(codec)) {
+  // 프레임마다 합성 결과를 그대로 다음 프레임의 바탕으로 쓰므로 항상 premul + 출력 색공간 (불투명 여부는 프레임마다 다를 수 있음)
+  m_info = ColorManagedDecoder::outputInfo(m_codec->dimensions().width(), m_codec->dimensions().height());
+  m_frames = m_codec->getFrameInfo();
+  m_repetitionCount = m_codec->getRepetitionCount();
+
+  m_frameEnd.reserve(m_frames.size());
+  double cursor = 0.0;
+  for (const auto& frame : m_frames) {
+    const int durationMs = frame.fDuration < k_minFrameDurationMs ? k_defaultFrameDurationMs : frame.fDuration;
+    cursor += durationMs / 1000.0;
+    m_frameEnd.push_back(cursor);
+  }
+  m_loopDurationSec = cursor;
+};
+
+int AnimatedImage::frameIndexAt(double localSec) const {
+  if (m_frames.empty() || m_loopDurationSec <= 0.0 || localSec <= 0.0) return 0;
+
+  // 반복이 끝났으면 마지막 프레임 유지 (repetitionCount 는 첫 재생 이후 추가 반복 횟수)
+  const double loop = std::floor(localSec / m_loopDurationSec);
+  if (m_repetitionCount != SkCodec::kRepetitionCountInfinite && loop > (double)m_repetitionCount) {
+    return (int)m_frames.size() - 1;
+  }
+  const double t = std::fmod(localSec, m_loopDurationSec);
+  const int index = (int)(std::upper_bound(m_frameEnd.begin(), m_frameEnd.end(), t) - m_frameEnd.begin());
+  return std::min(index, (int)m_frames.size() - 1);
+};
+
+int AnimatedImage::nextFrameIndex(int index) const {
+  // 무한 반복이면 마지막 다음에 처음 프레임을 미리 준비 (횟수가 정해진 반복은 마지막 루프 여부를 알 수 없으므로 역시 처음으로)
+  return index + 1 < (int)m_frames.size() ? index + 1 : 0;
+};
+
+sk_sp<SkImage> AnimatedImage::decodeFrame(int index) {
+  TRACE_SCOPE_ARG("decode", "AnimatedImage::decodeFrame", "frame", index);
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(m_info)) return nullptr;
+
+  SkCodec::Options options;
+  options.fFrameIndex = index;
+
+  // 바탕 프레임이 있으면 복사해서 fPriorFrame 으로 지정 (없으면 codec 이 필요한 프레임부터 직접 디코딩)
+  int priorIndex = SkCodec::kNoFrame;
+  SkPixmap priorPixels;
+  sk_sp<SkImage> keepAlive;
+  if (findPrior(index, priorIndex, priorPixels, keepAlive) && priorPixels.readPixels(bitmap.pixmap())) {
+    options.fPriorFrame = priorIndex;
+  }
+
+  const SkCodec::Result result = m_codec->getPixels(bitmap.pixmap(), &options);
+  if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput) {
+    Logger::warn(k_logTag, "Frame %d decode failed: %d", index, (int)result);
+    return nullptr;
+  }
+  bitmap.setImmutable();
+
+  m_lastIndex = index;
+  m_last = SkImages::RasterFromBitmap(bitmap);
+  return m_last;
+};
+
+bool AnimatedImage::findPrior(int index, int& priorIndex, SkPixmap& priorPixels, sk_sp<SkImage>& keepAlive) const {
+  const int required = m_frames[index].fRequiredFrame;
+  if (required == SkCodec::kNoFrame) return false;
+
+  // 가장 최근 프레임부터 거꾸로 검색 (순서대로 재생/prefetch 중이면 바로 앞 프레임이 m_last 에 있음)
+  const int lowest = std::max(required, index - k_maxPriorSearch);
+  for (int k = index - 1; k >= lowest; k--) {
+    if (m_frames[k].fDisposalMethod == SkCodecAnimation::DisposalMethod::kRestorePrevious) continue;
+    sk_sp<SkImage> candidate = (k == m_lastIndex) ? m_last : cachedFrame(k);
+    if (candidate && candidate->peekPixels(&priorPixels)) {
+      priorIndex = k;
+      keepAlive = std::move(candidate);
+      return true;
+    }
+  }
+  return false;
+};
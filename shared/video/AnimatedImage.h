@@ -0,0 +1,69 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <core/SkBitmap.h>
+#include <core/SkData.h>
+#include <core/SkImage.h>
+#include <codec/SkCodec.h>
+#include "PrefetchFrameSource.h"
+
+/**
+ * 애니메이션 이미지(GIF / animated WebP / APNG) 클립의 프레임 단위 스트리밍 디코더
+ *
+ * - 인코딩된 원본(SkData)과 SkCodec 하나만 들고, 요청된 시간의 프레임을 그때그때 디코딩한다.
+ *   디코딩된 프레임은 prefetch ring(PrefetchFrameSource)에만 보관하므로 메모리는 애니메이션 길이와 무관하게 제한된다.
+ * - 이전 프레임에 덧그려지는 프레임(FrameInfo::fRequiredFrame)은 마지막으로 합성한 프레임이나 ring 에 있는 의존 프레임을 복사한 뒤
+ *   fPriorFrame 으로 지정해 변경된 영역만 디코딩한다. prefetch 는 재생 순서대로 디코딩하므로 보통 바로 앞 프레임이 바탕이 된다.
+ * - 클립 시작 기준 경과 시간은 애니메이션 자체의 프레임 길이/반복 횟수에 맞춰 프레임 번호로 변환된다.
+ *   (반복이 끝나면 마지막 프레임 유지)
+ * - 프레임은 출력 색공간/픽셀 형식으로 디코딩된다. (ColorManagedDecoder 참고)
+ */
+class AnimatedImage : public PrefetchFrameSource
+{
+public:
+  /**
+   * 인코딩된 이미지로부터 생성
+   * @return 프레임이 2개 이상인 애니메이션이 아니면 nullptr (정지 이미지는 일반 클립으로 처리)
+   */
+  static std::shared_ptr<AnimatedImage> Make(sk_sp<SkData> data);
+
+  AnimatedImage(const AnimatedImage&) = delete;
+  AnimatedImage& operator=(const AnimatedImage&) = delete;
+
+public:
+  int width() const override { return m_info.width(); };
+  int height() const override { return m_info.height(); };
+  int frameCount() const override { return (int)m_frames.size(); };
+  int frameIndexAt(double localSec) const override;
+
+  // 한 번 재생하는 길이(초)
+  double loopDuration() const { return m_loopDurationSec; };
+
+protected:
+  int nextFrameIndex(int index) const override;
+  sk_sp<SkImage> decodeFrame(int index) override;
+
+private:
+  AnimatedImage(sk_sp<SkData> data, std::unique_ptr<SkCodec> codec);
+
+  // index 프레임의 바탕으로 쓸 수 있는 합성 완료 프레임 ([fRequiredFrame, index) 중 RestorePrevious 가 아닌 가장 최근 프레임)
+  bool findPrior(int index, int& priorIndex, SkPixmap& priorPixels, sk_sp<SkImage>& keepAlive) const;
+
+private:
+  sk_sp<SkData> m_data;                         // 인코딩된 원본
+  std::unique_ptr<SkCodec> m_codec;             // 프레임 디코더 (decodeFrame 에서만 사용)
+  SkImageInfo m_info;                           // 디코딩 픽셀 형식 (출력 색공간)
+  std::vector<SkCodec::FrameInfo> m_frames;     // 프레임별 길이/의존 관계
+  std::vector<double> m_frameEnd;               // 프레임별 한 루프 안에서의 종료 시각(초, 누적)
+  double m_loopDurationSec = 0.0;               // 한 루프 길이(초)
+  int m_repetitionCount = 0;                    // 추가 반복 횟수 (SkCodec::kRepetitionCountInfinite 면 무한)
+
+  int m_lastIndex = -1;                         // 마지막으로 합성한 프레임 번호 (ring 에서 밀려나도 다음 프레임의 바탕으로 사용)
+  sk_sp<SkImage> m_last;                        // 마지막으로 합성한 프레임
+
+private:
+  static constexpr int k_maxPriorSearch = 16;     // 바탕 프레임을 ring 에서 찾을 최대 거리 (없으면 codec 이 의존 프레임부터 직접 디코딩)
+  static constexpr int k_minFrameDurationMs = 11; // 이보다 짧은 프레임 길이(0 포함)는 브라우저와 같이 k_defaultFrameDurationMs 로 처리
+  static constexpr int k_defaultFrameDurationMs = 100;
+  static constexpr const char* k_logTag = "AnimatedImage";
+};
@@ -0,0 +1,150 @@
+#include "ClipLoader.h"
+#include "ImageResampler.h"
+#include "ColorManagedDecoder.h"
+#include "AnimatedImage.h"
+#include "Y4mFrameSource.h"
+#include "SharedImageCache.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <core/SkData.h>
+#include <core/SkImage.h>
+#include <core/SkRect.h>
+#include <algorithm> // std::max, std::transform
+#include <cctype>    // std::tolower
+#include <cmath>     // std::ceil
+#include <limits>    // std::numeric_limits
+
+std::vector<Timeline::ClipRenderData> ClipLoader::load(const std::vector<std::string>& paths, const ClipLoadOptions& opts) {
+  std::vector<Timeline::ClipRenderData> renderDataList;
+  renderDataList.reserve(paths.size());
+
+  for (size_t i = 0; i < paths.size(); i++) {
+    TRACE_SCOPE_ARG("import", "loadClip", "index", i);
+    if (opts.onProgress) {
+      opts.onProgress((int)i, (int)paths.size());
+    }
+
+    Timeline::ClipRenderData clip;
+    if (loadClip(paths[i], nullptr, opts, clip)) {
+      renderDataList.push_back(std::move(clip));
+    }
+  }
+
+  if (opts.onProgress) {
+    opts.onProgress((int)paths.size(), (int)paths.size());
+  }
+  return renderDataList;
+};
+
+bool ClipLoader::loadPlaced(const std::string& path, const SkRect& dst, const ClipLoadOptions& opts, Timeline::ClipRenderData& out) {
+  return loadClip(path, &dst, opts, out);
+};
+
+bool ClipLoader::loadClip(const std::string& p, const SkRect* placedDst, const ClipLoadOptions& opts, Timeline::ClipRenderData& out) {
+  // 비디오(y4m) 클립은 파일 전체를 읽지 않고 프레임 입력이 필요한 프레임만 읽음 (공유 캐시/proxy 대상 아님)
+  if (extensionOf(p) == "y4m") {
+    std::shared_ptr<Y4mFrameSource> video = Y4mFrameSource::open(p);
+    if (!video) return false;
+    const SkRect dst = placedDst ? *placedDst : fitWidthRect(video->width(), video->height(), opts.width, opts.height);
+    out = Timeline::ClipRenderData(video->frameAt(0.0), dst);
+    out.source = std::move(video);
+    out.path = p;
+    return out.image != nullptr;
+  }
+
+  // 공유 캐시가 있으면 그릴 영역 너비에 맞춰 축소 디코딩한 raster 이미지를 작업 간 공유
+  // (높이는 제한하지 않음: fitWidthRect 가 너비 기준으로 배치하고 넘치는 높이는 crop 하기 때문)
+  if (opts.sharedCache) {
+    // 애니메이션 이미지는 프레임마다 디코딩해야 하므로 공유 캐시(정지 이미지) 대신 프레임 디코더 사용
+    // (애니메이션인지 보려고 읽은 파일 내용은 정지 이미지면 공유 캐시 디코딩에 그대로 넘겨 다시 읽지 않음)
+    sk_sp<SkData> data;
+    if (mayBeAnimated(p)) {
+      data = SkData::MakeFromFileName(p.c_str());
+      if (std::shared_ptr<AnimatedImage> animation = AnimatedImage::Make(data)) {
+        const SkRect dst = placedDst ? *placedDst : fitWidthRect(animation->width(), animation->height(), opts.width, opts.height);
+        out = Timeline::ClipRenderData(ColorManagedDecoder::makeDeferred(data), dst);
+        out.source = std::move(animation);
+        out.path = p;
+        return true;
+      }
+    }
+    const float areaW = placedDst ? placedDst->width() : (float)opts.width;
+    const int targetW = (int)std::ceil(areaW * std::max(1.0f, opts.proxyScale));
+    sk_sp<SkImage> img = opts.sharedCache->get(p, targetW, std::numeric_limits<int>::max(), std::move(data));
+    if (!img) return false;
+    const SkRect dst = placedDst ? *placedDst : fitWidthRect(img->width(), img->height(), opts.width, opts.height);
+    out = Timeline::ClipRenderData(std::move(img), dst);
+    out.path = p;
+    return true;
+  }
+
+  //    - SkData::MakeFromFileName: 파일을 바이트로 읽음
+  //    - ColorManagedDecoder::makeDeferred: 바이트(압축)를 SkImage로 지연 디코드 (처음 그릴 때 출력 색공간/EXIF 방향으로 한 번만 변환)
+  //    - ImageResampler::decodeToFit: preview 화면 크기에 맞춘 proxy 와 seek/scrub 용 thumbnail 을 import 시점에 미리 축소 생성
+  //      (원본은 인코딩(export) 시에만 사용, thumbnail 은 proxy 가 있으면 proxy 를 축소해서 원본을 두 번 디코딩하지 않음)
+  sk_sp<SkData> data = SkData::MakeFromFileName(p.c_str());
+  if (!data) {
+    Logger::warn(k_logTag, "Read failed: %s", p.c_str());
+    return false; // 바이트 읽기 실패한 파일은 건너뜀.
+  }
+  sk_sp<SkImage> img = ColorManagedDecoder::makeDeferred(data);
+  if (!img) return false;
+
+  const SkRect dst = placedDst ? *placedDst : fitWidthRect(img->width(), img->height(), opts.width, opts.height);
+
+  // 애니메이션 이미지(GIF/WebP/APNG)는 프레임을 재생 시간에 맞춰 스트리밍 디코딩 (image 는 첫 프레임, thumbnail 은 draft 용)
+  // proxy 는 첫 프레임만 축소할 수 있으므로 만들지 않음
+  if (std::shared_ptr<AnimatedImage> animation = mayBeAnimated(p) ? AnimatedImage::Make(data) : nullptr) {
+    sk_sp<SkImage> thumb = opts.makeThumbnail ? ImageResampler::decodeToFit(data, k_thumbnailMaxDim, k_thumbnailMaxDim) : nullptr;
+    out = Timeline::ClipRenderData(std::move(img), dst, std::move(thumb));
+    out.source = std::move(animation);
+    out.path = p;
+    return true;
+  }
+
+  // preview proxy 는 원본이 dst 보다 클 때만 생성 (원본이 더 작으면 원본을 그대로 그리는 편이 낫다)
+  // (클립이 확대 애니메이션되면 최대 배율만큼 더 크게 만들어 확대해도 원본으로 돌아가지 않도록 함)
+  sk_sp<SkImage> proxy;
+  const float proxyScale = std::max(1.0f, opts.proxyScale);
+  const int proxyW = (int)std::ceil(dst.width() * proxyScale);
+  const int proxyH = (int)std::ceil(dst.height() * proxyScale);
+  if (opts.makeProxy && proxyW > 0 && proxyH > 0 && (img->width() > proxyW || img->height() > proxyH)) {
+    proxy = ImageResampler::decodeToFit(data, proxyW, proxyH);
+  }
+
+  // thumbnail 은 proxy 가 있으면 이미 디코딩된 proxy 를 축소하고, 없을 때만 원본 바이트에서 축소 디코딩
+  sk_sp<SkImage> thumb;
+  if (opts.makeThumbnail) {
+    thumb = proxy ? ImageResampler::resizeToFit(proxy, k_thumbnailMaxDim, k_thumbnailMaxDim)
+                  : ImageResampler::decodeToFit(data, k_thumbnailMaxDim, k_thumbnailMaxDim);
+  }
+
+  out = Timeline::ClipRenderData(std::move(img), dst, std::move(thumb), std::move(proxy));
+  out.path = p;
+  return true;
+};
+
+bool ClipLoader::mayBeAnimated(const std::string& path) {
+  // 확장자로만 판단 (PNG 는 APNG 일 수 있음), 실제 애니메이션 여부는 AnimatedImage::Make 가 프레임 수로 확인
+  const std::string ext = extensionOf(path);
+  return ext == "gif" || ext == "webp" || ext == "png" || ext == "apng";
+};
+
+std::string ClipLoader::extensionOf(const std::string& path) {
+  const size_t dot = path.find_last_of('.');
+  const size_t slash = path.find_last_of('/');
+  if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return std::string();
+  std::string ext = path.substr(dot + 1);
+  std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+  return ext;
+};
+
+SkRect ClipLoader::fitWidthRect(int imageW, int imageH, int areaW, int areaH) {
+  if (imageW <= 0 || imageH <= 0) return SkRect::MakeEmpty();
+
+  float width = static_cast<float>(areaW);
+  float height = width * (static_cast<float>(imageH) / static_cast<float>(imageW));
+  float x = 0.0f;
+  float y = (static_cast<float>(areaH) - height) / 2.0f;
+  return SkRect::MakeXYWH(x, y, width, height);
+};
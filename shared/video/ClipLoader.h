@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include "Timeline.h"
+
+class SharedImageCache;
+
+// 이미지 파일 -> 클립 렌더링 데이터 생성 옵션
+struct ClipLoadOptions
+{
+  int width = 0;                              // 클립을 그릴 영역(캔버스) 너비
+  int height = 0;                             // 클립을 그릴 영역(캔버스) 높이
+  bool makeThumbnail = false;                 // seek/scrub 용 thumbnail 생성 여부 (Preview 전용)
+  bool makeProxy = false;                     // 그릴 영역 크기에 맞춘 preview proxy 생성 여부 (Preview 전용)
+  float proxyScale = 1.0f;                    // proxy/공유 캐시 이미지를 그릴 영역의 몇 배 크기로 만들지 (Ken Burns 확대 시 화질 유지용)
+  SharedImageCache* sharedCache = nullptr;    // 주어지면 원본 대신 그릴 영역 크기로 디코딩한 raster 이미지를 작업 간 공유 (배치 렌더링용, 애니메이션 이미지는 제외)
+  std::function<void(int done, int total)> onProgress; // 이미지마다 (처리한 수, 전체 수) 알림 (load 를 호출한 스레드에서 호출, 마지막은 done == total)
+};
+
+/**
+ * 이미지 파일 경로 목록으로부터 Timeline 에 넣을 클립 렌더링 데이터를 만드는 유틸리티
+ * Preview(PreviewController)와 헤드리스 배치 렌더링(EngineCore)이 같은 배치 규칙(dst 계산)을 공유하기 위해 분리
+ */
+class ClipLoader
+{
+public:
+  // 경로 목록의 이미지를 읽어 클립 렌더링 데이터 목록 생성 (읽기/디코딩에 실패한 파일은 건너뜀)
+  static std::vector<Timeline::ClipRenderData> load(const std::vector<std::string>& paths, const ClipLoadOptions& opts);
+
+  /**
+   * 배치(dst)가 이미 정해진 클립 하나 로드 (프로젝트 파일처럼 배치를 저장해 둔 경우 fitWidthRect 계산 생략)
+   * - proxy / 공유 캐시 이미지 크기는 opts.width 대신 dst 크기 기준 (opts.proxyScale 배)
+   * @return 읽기/디코딩 실패 시 false
+   */
+  static bool loadPlaced(const std::string& path, const SkRect& dst, const ClipLoadOptions& opts, Timeline::ClipRenderData& out);
+
+  /**
+   * 이미지를 그릴 영역(dst) 계산
+   * - 모든 클립 이미지는 가운데 정렬 + width 를 영역 너비에 맞추고, height 는 비율에 맞게 조정 + height 가 영역보다 커지면 crop 처리
+   * - 나중에 contain/cover 같은 맞춤 모드가 필요하면 여기서 계산을 바꾸면 됩니다.
+   */
+  static SkRect fitWidthRect(int imageW, int imageH, int areaW, int areaH);
+
+private:
+  // 클립 하나 로드 (placedDst 가 nullptr 이면 opts 영역에 fitWidthRect 로 배치)
+  static bool loadClip(const std::string& path, const SkRect* placedDst, const ClipLoadOptions& opts, Timeline::ClipRenderData& out);
+  // 애니메이션일 수 있는 형식인지 확장자로 판단 (JPEG 처럼 애니메이션일 수 없는 형식은 공유 캐시 경로에서 확인용으로 미리 읽지 않음)
+  static bool mayBeAnimated(const std::string& path);
+  // 소문자 확장자 ('.' 제외, 없으면 빈 문자열)
+  static std::string extensionOf(const std::string& path);
+
+private:
+  static constexpr int k_thumbnailMaxDim = 128;   // seek/scrub 용 thumbnail 최대 변 길이(px)
+  static constexpr const char* k_logTag = "ClipLoader";
+};
@@ -0,0 +1,79 @@
+#include "ClipMotion.h"
+#include <algorithm> // std::sort, std::clamp, std::max
+#include <cmath>     // std::floor
+
+// 키프레임 사이 보간 곡선 (ease-in-out, 시작/끝에서 속도가 0)
+static float easeInOut(float x) {
+  return x * x * (3.0f - 2.0f * x);
+}
+
+static ClipMotion::Sample lerpSample(const ClipMotion::Sample& a, const ClipMotion::Sample& b, float w) {
+  ClipMotion::Sample s;
+  s.scale = a.scale + (b.scale - a.scale) * w;
+  s.panX = a.panX + (b.panX - a.panX) * w;
+  s.panY = a.panY + (b.panY - a.panY) * w;
+  s.rotationDeg = a.rotationDeg + (b.rotationDeg - a.rotationDeg) * w;
+  return s;
+}
+
+std::shared_ptr<const ClipMotion> ClipMotion::bake(std::vector<MotionKeyframe> keys) {
+  if (keys.empty()) return nullptr;
+  std::sort(keys.begin(), keys.end(), [](const MotionKeyframe& a, const MotionKeyframe& b) { return a.time < b.time; });
+
+  auto toSample = [](const MotionKeyframe& k) { return Sample{ k.scale, k.panX, k.panY, k.rotationDeg }; };
+
+  auto motion = std::make_shared<ClipMotion>();
+  size_t seg = 0; // 현재 샘플 시점이 속한 키프레임 구간 (keys[seg] ~ keys[seg + 1])
+  for (int i = 0; i <= k_samples; i++) {
+    const float t = (float)i / (float)k_samples;
+    while (seg + 1 < keys.size() && t > keys[seg + 1].time) seg++;
+
+    Sample s;
+    if (t <= keys.front().time) {
+      s = toSample(keys.front());
+    } else if (seg + 1 >= keys.size()) {
+      s = toSample(keys.back());
+    } else {
+      const MotionKeyframe& a = keys[seg];
+      const MotionKeyframe& b = keys[seg + 1];
+      const float span = b.time - a.time;
+      const float w = span > 0.0f ? easeInOut(std::clamp((t - a.time) / span, 0.0f, 1.0f)) : 1.0f;
+      s = lerpSample(toSample(a), toSample(b), w);
+    }
+    motion->m_table[i] = s;
+    motion->m_maxScale = std::max(motion->m_maxScale, s.scale);
+  }
+  motion->m_keys = std::move(keys);
+  return motion;
+};
+
+const std::vector<std::shared_ptr<const ClipMotion>>& ClipMotion::kenBurnsPresets() {
+  // pan 량은 (scale - 1) / 2 이하로 제한 -> 확대된 이미지가 항상 dst 를 덮음
+  static const std::vector<std::shared_ptr<const ClipMotion>> s_presets = {
+    bake({ { 0.0f, 1.0f, 0.0f, 0.0f }, { 1.0f, k_maxScale, 0.0f, 0.0f } }),                 // 중심으로 천천히 확대
+    bake({ { 0.0f, k_maxScale, 0.0f, 0.0f }, { 1.0f, 1.0f, 0.0f, 0.0f } }),                 // 확대된 상태에서 천천히 축소
+    bake({ { 0.0f, 1.2f, 0.08f, 0.0f }, { 1.0f, 1.2f, -0.08f, 0.0f } }),                    // 왼쪽 -> 오른쪽 pan
+    bake({ { 0.0f, 1.1f, -0.04f, 0.03f }, { 1.0f, k_maxScale, 0.1f, -0.1f } }),             // 오른쪽 위로 pan 하며 확대
+  };
+  return s_presets;
+};
+
+ClipMotion::Sample ClipMotion::evaluate(float progress) const {
+  const float x = std::clamp(progress, 0.0f, 1.0f) * (float)k_samples;
+  const int i = std::min((int)std::floor(x), k_samples - 1);
+  return lerpSample(m_table[i], m_table[i + 1], x - (float)i);
+};
+
+SkMatrix ClipMotion::matrixAt(float progress, const SkRect& dst) const {
+  const Sample s = evaluate(progress);
+  const float cx = dst.centerX();
+  const float cy = dst.centerY();
+
+  // dst 중심 기준 확대/회전 후 pan 만큼 이동
+  SkMatrix m;
+  m.setTranslate(-cx, -cy);
+  m.postScale(s.scale, s.scale);
+  m.postRotate(s.rotationDeg);
+  m.postTranslate(cx + s.panX * dst.width(), cy + s.panY * dst.height());
+  return m;
+};
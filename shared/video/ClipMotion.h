@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <vector>
+#include <core/SkMatrix.h>
+#include <core/SkRect.h>
+
+// 클립 애니메이션 키프레임 (Ken Burns pan/zoom/rotation)
+struct MotionKeyframe
+{
+  float time = 0.0f;          // 클립 안에서의 위치 [0, 1] (0: 클립 시작, 1: 클립 끝)
+  float scale = 1.0f;         // 확대 배율 (dst 중심 기준, 1 이상이면 dst 를 항상 덮음)
+  float panX = 0.0f;          // 가로 이동량 (dst 너비 대비 비율)
+  float panY = 0.0f;          // 세로 이동량 (dst 높이 대비 비율)
+  float rotationDeg = 0.0f;   // 회전 각도 (도, dst 중심 기준)
+};
+
+/**
+ * 키프레임 곡선을 미리 샘플링해 둔 클립 애니메이션 테이블
+ *
+ * - bake() 시점에 키프레임 사이를 ease-in-out 곡선으로 보간해 고정 크기(k_samples + 1) 테이블로 저장한다.
+ *   -> 렌더링 중에는 테이블의 인접한 두 값을 선형 보간만 하므로 할당/키프레임 탐색이 없다.
+ * - 불변 객체이므로 여러 클립/Timeline, Preview 렌더링 스레드와 export 스레드가 shared_ptr 로 공유한다.
+ */
+class ClipMotion
+{
+public:
+  // 한 시점의 변환 값
+  struct Sample
+  {
+    float scale = 1.0f;
+    float panX = 0.0f;
+    float panY = 0.0f;
+    float rotationDeg = 0.0f;
+  };
+
+  // 키프레임 목록으로 테이블 생성 (time 순으로 정렬되며, 비어있으면 nullptr)
+  static std::shared_ptr<const ClipMotion> bake(std::vector<MotionKeyframe> keys);
+
+  /**
+   * 기본 Ken Burns 프리셋 목록 (천천히 확대 / 축소 / 좌->우 pan / 오른쪽 위로 pan 하며 확대)
+   * - 클립마다 번갈아 적용하면 자연스럽다. 모든 프리셋의 배율은 k_maxScale 이하이며 dst 를 벗어난 빈 영역이 보이지 않는다.
+   */
+  static const std::vector<std::shared_ptr<const ClipMotion>>& kenBurnsPresets();
+
+  // 클립 진행률 progress([0, 1]) 시점의 변환 값 (할당 없음)
+  Sample evaluate(float progress) const;
+
+  // progress 시점에 dst 에 적용할 변환 행렬 (dst 좌표계 -> 캔버스 좌표계)
+  SkMatrix matrixAt(float progress, const SkRect& dst) const;
+
+  // 테이블 전체에서 가장 큰 확대 배율 (proxy 해상도 결정용)
+  float maxScale() const { return m_maxScale; };
+
+  // bake 에 전달된 키프레임 (time 순, 프로젝트 저장용)
+  const std::vector<MotionKeyframe>& keyframes() const { return m_keys; };
+
+public:
+  static constexpr float k_maxScale = 1.3f;   // kenBurnsPresets 의 최대 확대 배율
+
+private:
+  static constexpr int k_samples = 64;        // 곡선 샘플 구간 수 (테이블 크기 k_samples + 1, 약 1KB)
+
+  std::array<Sample, k_samples + 1> m_table;  // 진행률 i / k_samples 시점의 변환 값
+  float m_maxScale = 1.0f;
+  std::vector<MotionKeyframe> m_keys;         // 테이블을 만든 키프레임 (렌더링에는 사용하지 않음)
+};
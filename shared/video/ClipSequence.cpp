@@ -0,0 +1,279 @@
+#include "ClipSequence.h"
+#include <algorithm> // std::max, std::min, std::reverse
+#include <atomic>
+
+ClipSequence ClipSequence::fromSegments(const std::vector<Timeline::Segment>& segs) {
+  // 우선순위를 무작위로 뽑은 뒤 스택으로 Cartesian tree 를 만들면 순서대로 하나씩 insert 하는 것(O(n log n))보다 빠르다. O(n)
+  // (노드는 불변이므로 먼저 자식 관계를 인덱스로 정한 뒤 아래에서부터 노드 생성)
+  const size_t n = segs.size();
+  if (n == 0) return ClipSequence();
+
+  std::vector<uint32_t> priority(n);
+  std::vector<long> left(n, -1), right(n, -1);
+  std::vector<size_t> stack;
+  stack.reserve(64);
+  for (size_t i = 0; i < n; i++) {
+    priority[i] = nextPriority();
+    long last = -1;
+    while (!stack.empty() && priority[stack.back()] < priority[i]) {
+      last = (long)stack.back();
+      stack.pop_back();
+    }
+    left[i] = last;
+    if (!stack.empty()) {
+      right[stack.back()] = (long)i;
+    }
+    stack.push_back(i);
+  }
+  const size_t root = stack.front();
+
+  // 후위 순회로 노드 생성 (명시적 스택)
+  std::vector<NodePtr> built(n);
+  std::vector<std::pair<size_t, bool>> work{ { root, false } };
+  while (!work.empty()) {
+    auto [i, childrenDone] = work.back();
+    work.pop_back();
+    if (!childrenDone) {
+      work.push_back({ i, true });
+      if (left[i] >= 0) work.push_back({ (size_t)left[i], false });
+      if (right[i] >= 0) work.push_back({ (size_t)right[i], false });
+      continue;
+    }
+    built[i] = makeNode(left[i] >= 0 ? std::move(built[left[i]]) : nullptr,
+                        std::make_shared<const Timeline::Segment>(segs[i]),
+                        priority[i],
+                        right[i] >= 0 ? std::move(built[right[i]]) : nullptr);
+  }
+  return ClipSequence(std::move(built[root]));
+};
+
+const Timeline::Segment& ClipSequence::at(size_t index) const {
+  const Node* node = m_root.get();
+  for (;;) {
+    const size_t leftCount = node->left ? node->left->count : 0;
+    if (index < leftCount) {
+      node = node->left.get();
+    } else if (index == leftCount) {
+      return *node->clip;
+    } else {
+      index -= leftCount + 1;
+      node = node->right.get();
+    }
+  }
+};
+
+double ClipSequence::startOf(size_t index) const {
+  double start = 0.0;
+  const Node* node = m_root.get();
+  while (node) {
+    const size_t leftCount = node->left ? node->left->count : 0;
+    const double leftAdvance = node->left ? node->left->advance : 0.0;
+    if (index < leftCount) {
+      node = node->left.get();
+    } else if (index == leftCount) {
+      return start + leftAdvance;
+    } else {
+      start += leftAdvance + advanceOf(*node->clip);
+      index -= leftCount + 1;
+      node = node->right.get();
+    }
+  }
+  return start;
+};
+
+size_t ClipSequence::indexAt(double tSec) const {
+  // 시작 시간이 tSec 이하인 마지막 클립 (클립은 시작 시간 순으로 이어지므로 누적 advance 로 내려감)
+  size_t index = 0;
+  size_t found = 0;
+  double start = 0.0;
+  const Node* node = m_root.get();
+  while (node) {
+    const size_t leftCount = node->left ? node->left->count : 0;
+    const double nodeStart = start + (node->left ? node->left->advance : 0.0);
+    if (nodeStart <= tSec) {
+      found = index + leftCount;
+      start = nodeStart + advanceOf(*node->clip);
+      index += leftCount + 1;
+      node = node->right.get();
+    } else {
+      node = node->left.get();
+    }
+  }
+  return found;
+};
+
+double ClipSequence::totalDuration() const {
+  if (!m_root) return 0.0;
+  // 마지막 클립 시작 시간 + 마지막 클립 길이
+  const size_t last = size() - 1;
+  return startOf(last) + at(last).duration;
+};
+
+double ClipSequence::endTime() const {
+  return m_root ? m_root->maxEnd : 0.0;
+};
+
+int ClipSequence::playingAt(double tSec, size_t* out, int maxCount) const {
+  if (maxCount <= 0) return 0;
+  int count = 0;
+  collectPlaying(m_root.get(), 0.0, 0, tSec, out, maxCount, count);
+  // 나중 클립부터 채웠으므로 순서를 되돌림
+  std::reverse(out, out + count);
+  return count;
+};
+
+void ClipSequence::collectPlaying(const Node* node, double base, size_t first, double tSec, size_t* out, int maxCount, int& count) {
+  // 서브트리의 어떤 클립도 t 를 포함할 수 없으면 통째로 건너뜀 (모든 클립이 t 이후에 시작하거나 t 이전에 끝남)
+  if (!node || count == maxCount || base + node->minStart > tSec || base + node->maxEnd <= tSec) return;
+
+  const size_t leftCount = node->left ? node->left->count : 0;
+  const double start = base + (node->left ? node->left->advance : 0.0);
+  // 넘치면 나중 클립을 남기도록 오른쪽 -> 자신 -> 왼쪽 순서로 방문
+  collectPlaying(node->right.get(), start + advanceOf(*node->clip), first + leftCount + 1, tSec, out, maxCount, count);
+  if (count < maxCount && tSec >= start && tSec < start + node->clip->duration) {
+    out[count++] = first + leftCount;
+  }
+  collectPlaying(node->left.get(), base, first, tSec, out, maxCount, count);
+};
+
+void ClipSequence::forEach(const std::function<void(const Timeline::Segment&, double)>& fn) const {
+  // 중위 순회 (명시적 스택)
+  double cursor = 0.0;
+  std::vector<const Node*> stack;
+  const Node* node = m_root.get();
+  while (node || !stack.empty()) {
+    while (node) {
+      stack.push_back(node);
+      node = node->left.get();
+    }
+    node = stack.back();
+    stack.pop_back();
+
+    fn(*node->clip, cursor);
+    cursor += advanceOf(*node->clip);
+    node = node->right.get();
+  }
+};
+
+ClipSequence ClipSequence::insert(size_t index, Timeline::Segment clip) const {
+  NodePtr left, right;
+  split(m_root, std::min(index, size()), left, right);
+  NodePtr node = makeNode(nullptr, std::make_shared<const Timeline::Segment>(std::move(clip)), nextPriority(), nullptr);
+  return ClipSequence(merge(merge(left, node), right));
+};
+
+ClipSequence ClipSequence::erase(size_t index) const {
+  if (index >= size()) return *this;
+  NodePtr left, rest, mid, right;
+  split(m_root, index, left, rest);
+  split(rest, 1, mid, right);
+  return ClipSequence(merge(left, right));
+};
+
+ClipSequence ClipSequence::move(size_t from, size_t to) const {
+  if (from >= size()) return *this;
+  NodePtr left, tail, mid, right;
+  split(m_root, from, left, tail);
+  split(tail, 1, mid, right);
+  NodePtr rest = merge(left, right);
+
+  // 꺼낸 노드(mid)를 그대로 다시 끼움 -> 클립 객체는 복사하지 않음
+  NodePtr a, b;
+  split(rest, std::min(to, rest ? rest->count : 0), a, b);
+  return ClipSequence(merge(merge(a, mid), b));
+};
+
+ClipSequence ClipSequence::replace(size_t index, Timeline::Segment clip) const {
+  if (index >= size()) return *this;
+  NodePtr left, rest, mid, right;
+  split(m_root, index, left, rest);
+  split(rest, 1, mid, right);
+  NodePtr node = makeNode(nullptr, std::make_shared<const Timeline::Segment>(std::move(clip)), mid->priority, nullptr);
+  return ClipSequence(merge(merge(left, node), right));
+};
+
+ClipSequence ClipSequence::retime(size_t index, double durationSec, double xfadeSec) const {
+  if (index >= size()) return *this;
+  Timeline::Segment clip = at(index);
+  clip.duration = std::max(0.0, durationSec);
+  clip.xfade = std::clamp(xfadeSec, 0.0, clip.duration);
+  return replace(index, std::move(clip));
+};
+
+std::vector<Timeline::Segment> ClipSequence::toSegments() const {
+  std::vector<Timeline::Segment> segs;
+  segs.reserve(size());
+  forEach([&segs](const Timeline::Segment& clip, double start) {
+    segs.push_back(clip);
+    segs.back().start = start;
+  });
+  return segs;
+};
+
+ClipSequence::NodePtr ClipSequence::makeNode(NodePtr left, ClipPtr clip, uint32_t priority, NodePtr right) {
+  auto node = std::make_shared<Node>();
+  node->count = 1 + (left ? left->count : 0) + (right ? right->count : 0);
+  node->advance = advanceOf(*clip) + (left ? left->advance : 0.0) + (right ? right->advance : 0.0);
+
+  // 구간 정보는 서브트리 첫 클립의 시작을 0 으로 둔 상대 시각 (부모로 올라가도 자식 값을 고치지 않고 재사용)
+  const double start = left ? left->advance : 0.0;
+  const double rightBase = start + advanceOf(*clip);
+  node->minStart = start;
+  node->maxEnd = start + clip->duration;
+  if (left) {
+    node->minStart = std::min(node->minStart, left->minStart);
+    node->maxEnd = std::max(node->maxEnd, left->maxEnd);
+  }
+  if (right) {
+    node->minStart = std::min(node->minStart, rightBase + right->minStart);
+    node->maxEnd = std::max(node->maxEnd, rightBase + right->maxEnd);
+  }
+  node->left = std::move(left);
+  node->right = std::move(right);
+  node->clip = std::move(clip);
+  node->priority = priority;
+  return node;
+};
+
+void ClipSequence::split(const NodePtr& node, size_t k, NodePtr& left, NodePtr& right) {
+  if (!node) {
+    left = nullptr;
+    right = nullptr;
+    return;
+  }
+  // 경로 위의 노드만 새로 만들고 나머지 서브트리는 그대로 공유
+  const size_t leftCount = node->left ? node->left->count : 0;
+  if (k <= leftCount) {
+    NodePtr l, r;
+    split(node->left, k, l, r);
+    right = makeNode(std::move(r), node->clip, node->priority, node->right);
+    left = std::move(l);
+  } else {
+    NodePtr l, r;
+    split(node->right, k - leftCount - 1, l, r);
+    left = makeNode(node->left, node->clip, node->priority, std::move(l));
+    right = std::move(r);
+  }
+};
+
+ClipSequence::NodePtr ClipSequence::merge(const NodePtr& left, const NodePtr& right) {
+  if (!left) return right;
+  if (!right) return left;
+  if (left->priority > right->priority) {
+    return makeNode(left->left, left->clip, left->priority, merge(left->right, right));
+  }
+  return makeNode(merge(left, right->left), right->clip, right->priority, right->right);
+};
+
+uint32_t ClipSequence::nextPriority() {
+  // splitmix64 로 섞은 카운터 (여러 스레드에서 불러도 안전, 실행마다 같은 순서라 디버깅이 쉬움)
+  static std::atomic<uint64_t> s_counter{ 0 };
+  uint64_t z = s_counter.fetch_add(0x9e3779b97f4a7c15ull) + 0x9e3779b97f4a7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return (uint32_t)((z ^ (z >> 31)) >> 32);
+};
+
+double ClipSequence::advanceOf(const Timeline::Segment& clip) {
+  return clip.duration - std::max(0.0, clip.xfade);
+};
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Timeline.h"
+
+/**
+ * 기본 사진 트랙의 클립 순서를 편집하기 위한 영속(persistent) 클립 시퀀스
+ *
+ * - 위치(index) 기준 treap 이며, 편집 함수는 자신을 바꾸지 않고 경로 복사(path copying)로 만든 새 시퀀스를 반환한다.
+ *   -> insert/erase/move/replace/retime 은 평균 O(log n) 이고, 바뀌지 않은 노드/클립(디코딩된 이미지 포함)은 이전 버전과 공유된다.
+ *   -> 시퀀스 복사는 루트 포인터 복사뿐이므로 undo 용 이전 버전 보관이나 다른 스레드로 넘기는 스냅샷이 사실상 공짜다.
+ * - 클립은 앞 클립이 끝나기 xfade 초 전에 시작하도록 이어 붙인다. (Timeline::FromClipRenderData 와 같은 배치 규칙)
+ *   노드마다 서브트리의 "다음 클립 시작까지의 길이(duration - xfade)" 합을 들고 있어 시작 시간/시간 -> 클립 조회도 O(log n).
+ * - 노드마다 서브트리 클립들의 (서브트리 첫 클립 기준) 가장 이른 시작/가장 늦은 끝 시각도 들고 있어(augmented interval tree),
+ *   시간 t 에 재생 중인 클립 k 개를 O((k + 1) log n) 에 찾는다. -> Timeline 이 편집된 시퀀스를 펼치지 않고 그대로 트랙으로 쓴다. (Timeline::withSequence)
+ * - 노드는 불변이므로 여러 스레드가 같은 버전을 잠금 없이 읽을 수 있다.
+ */
+class ClipSequence
+{
+public:
+  ClipSequence() = default;
+
+  // 클립 목록으로 시퀀스 생성 (목록 순서 유지, 시작 시간은 무시하고 배치 규칙으로 다시 계산) O(n)
+  static ClipSequence fromSegments(const std::vector<Timeline::Segment>& segs);
+
+public:
+  size_t size() const { return m_root ? m_root->count : 0; };
+  bool empty() const { return !m_root; };
+
+  // index 번째 클립 (start 는 의미 없음, startOf 참고)
+  const Timeline::Segment& at(size_t index) const;
+  // index 번째 클립의 시작 시간(초)
+  double startOf(size_t index) const;
+  // 시간 tSec 에 재생 중인 (가장 나중에 시작한) 클립 번호 (비어있으면 0)
+  size_t indexAt(double tSec) const;
+  // 전체 길이(초) = 마지막 클립이 끝나는 시각
+  double totalDuration() const;
+  // 가장 늦게 끝나는 클립의 끝 시각(초) O(1) (xfade 가 길이보다 긴 클립이 있으면 totalDuration 보다 클 수 있음)
+  double endTime() const;
+
+  /**
+   * 시간 tSec 에 재생 중인([start, start + duration)) 클립 번호를 순서대로 out 에 기록 (최대 maxCount 개, 넘치면 나중 클립 우선)
+   * - 할당 없음 (렌더링 스레드에서 매 프레임 호출)
+   * @return 기록한 개수
+   */
+  int playingAt(double tSec, size_t* out, int maxCount) const;
+
+  // 모든 클립을 순서대로 fn(clip, start) 로 방문 O(n) (클립을 복사하지 않음)
+  void forEach(const std::function<void(const Timeline::Segment&, double)>& fn) const;
+
+  // 편집 (모두 새 시퀀스 반환, 범위를 벗어난 index 는 끝으로 맞춤)
+  ClipSequence insert(size_t index, Timeline::Segment clip) const;
+  ClipSequence erase(size_t index) const;
+  ClipSequence move(size_t from, size_t to) const;
+  ClipSequence replace(size_t index, Timeline::Segment clip) const;
+  ClipSequence retime(size_t index, double durationSec, double xfadeSec) const;
+
+  // 시작 시간을 채운 클립 목록 (Timeline 트랙 생성용) O(n)
+  std::vector<Timeline::Segment> toSegments() const;
+
+private:
+  using ClipPtr = std::shared_ptr<const Timeline::Segment>;
+
+  struct Node;
+  using NodePtr = std::shared_ptr<const Node>;
+
+  struct Node
+  {
+    NodePtr left;
+    NodePtr right;
+    ClipPtr clip;                     // 클립 (노드를 경로 복사해도 클립 자체는 공유)
+    uint32_t priority = 0;            // treap heap 우선순위 (클수록 위)
+    size_t count = 0;                 // 서브트리 클립 수
+    double advance = 0.0;             // 서브트리 클립들의 (duration - xfade) 합
+    double minStart = 0.0;            // 서브트리 첫 클립 시작 기준, 서브트리에서 가장 이른 클립 시작 시각
+    double maxEnd = 0.0;              // 서브트리 첫 클립 시작 기준, 서브트리에서 가장 늦은 클립 끝 시각
+  };
+
+  explicit ClipSequence(NodePtr root) : m_root(std::move(root)) {};
+
+  static NodePtr makeNode(NodePtr left, ClipPtr clip, uint32_t priority, NodePtr right);
+  // 앞의 k 개를 left, 나머지를 right 로 분리
+  static void split(const NodePtr& node, size_t k, NodePtr& left, NodePtr& right);
+  static NodePtr merge(const NodePtr& left, const NodePtr& right);
+  static uint32_t nextPriority();
+  static double advanceOf(const Timeline::Segment& clip);
+  // playingAt 의 재귀 부분: base 는 node 서브트리 첫 클립의 시작 시각, first 는 그 클립 번호 (뒤에서부터 채움)
+  static void collectPlaying(const Node* node, double base, size_t first, double tSec, size_t* out, int maxCount, int& count);
+
+private:
+  NodePtr m_root;
+};
@@ -0,0 +1,125 @@
+#include "ColorManagedDecoder.h"
+#include "../logger/Logger.h"
+#include <core/SkImageGenerator.h>
+#include <codec/SkCodec.h>
+#include <codec/SkPixmapUtils.h>
+#include <modules/skcms/skcms.h>
+#include <memory>
+
+namespace {
+
+// 원본 크기로 처음 필요할 때 디코딩하는 generator (색 변환 + 방향 보정 후 결과를 Skia 가 캐시)
+class ColorManagedGenerator : public SkImageGenerator
+{
+public:
+  ColorManagedGenerator(const SkImageInfo& info, sk_sp<SkData> data)
+    : SkImageGenerator(info), m_data(std::move(data)) {};
+
+protected:
+  // 원본 바이트 크기 집계(Timeline::memoryUsage) 등에서 사용
+  sk_sp<SkData> onRefEncodedData() override { return m_data; };
+
+  bool onGetPixels(const SkImageInfo& info, void* pixels, size_t rowBytes, const Options&) override {
+    // 축소 요청은 지원하지 않음 (축소본은 ImageResampler::decodeToFit 사용)
+    if (info.dimensions() != getInfo().dimensions()) return false;
+
+    std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(m_data);
+    if (!codec) return false;
+    SkBitmap decoded;
+    if (!ColorManagedDecoder::decode(*codec, 1.0f, decoded)) return false;
+    if (!ColorManagedDecoder::orient(decoded, codec->getOrigin())) return false;
+    // 요청 형식이 출력 형식과 같으면 단순 복사, 다르면(드물게 다른 color type 요청) Skia 가 변환
+    return decoded.readPixels(info, pixels, rowBytes, 0, 0);
+  };
+
+private:
+  sk_sp<SkData> m_data;
+};
+
+} // namespace
+
+sk_sp<SkColorSpace> ColorManagedDecoder::outputColorSpace() {
+  static const sk_sp<SkColorSpace> s_output = SkColorSpace::MakeSRGB();
+  return s_output;
+};
+
+SkImageInfo ColorManagedDecoder::outputInfo(int width, int height, bool opaque) {
+  return SkImageInfo::Make(width, height, kRGBA_8888_SkColorType, opaque ? kOpaque_SkAlphaType : kPremul_SkAlphaType, outputColorSpace());
+};
+
+SkISize ColorManagedDecoder::orientedDimensions(const SkCodec& codec) {
+  const SkISize size = codec.dimensions();
+  return SkEncodedOriginSwapsWidthHeight(codec.getOrigin()) ? SkISize::Make(size.height(), size.width()) : size;
+};
+
+bool ColorManagedDecoder::decode(SkCodec& codec, float scale, SkBitmap& out) {
+  const SkISize size = codec.getScaledDimensions(scale);
+  const bool opaque = codec.getInfo().isOpaque();
+  const skcms_ICCProfile* srcProfile = codec.getICCProfile();
+  const skcms_ICCProfile* dstProfile = skcms_sRGB_profile();
+
+  // 변환 방식 결정
+  // - profile 이 없거나 sRGB 와 같으면 변환 없음
+  // - RGB profile 이면 색공간 없이(디코더 변환 없이) 디코딩한 뒤 skcms 로 직접 변환
+  // - 그 외(Gray/CMYK)는 디코더가 출력 색공간으로 바로 변환
+  const bool needsTransform = srcProfile && !skcms_ApproximatelyEqualProfiles(srcProfile, dstProfile);
+  const bool rgbProfile = srcProfile && srcProfile->data_color_space == skcms_Signature_RGB;
+  const bool skcmsTransform = needsTransform && rgbProfile;
+
+  // skcms 는 unpremul 입력을 받아 변환과 premultiply 를 한 번에 처리
+  const SkAlphaType decodeAlpha = opaque ? kOpaque_SkAlphaType : (skcmsTransform ? kUnpremul_SkAlphaType : kPremul_SkAlphaType);
+  const SkImageInfo decodeInfo = SkImageInfo::Make(size, kRGBA_8888_SkColorType, decodeAlpha,
+                                                   needsTransform && !rgbProfile ? outputColorSpace() : nullptr);
+  if (!out.tryAllocPixels(decodeInfo)) return false;
+  const SkCodec::Result result = codec.getPixels(out.pixmap());
+  if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput) {
+    Logger::warn(k_logTag, "SkCodec::getPixels failed: %d", (int)result);
+    return false;
+  }
+
+  if (skcmsTransform) {
+    // 같은 형식끼리는 in-place 변환 가능 (행 단위: rowBytes 에 padding 이 있을 수 있음)
+    const skcms_AlphaFormat srcAlpha = opaque ? skcms_AlphaFormat_Opaque : skcms_AlphaFormat_Unpremul;
+    const skcms_AlphaFormat dstAlpha = opaque ? skcms_AlphaFormat_Opaque : skcms_AlphaFormat_PremulAsEncoded;
+    for (int y = 0; y < size.height(); y++) {
+      void* row = out.getAddr32(0, y);
+      if (!skcms_Transform(row, skcms_PixelFormat_RGBA_8888, srcAlpha, srcProfile,
+                           row, skcms_PixelFormat_RGBA_8888, dstAlpha, dstProfile, (size_t)size.width())) {
+        Logger::warn(k_logTag, "skcms_Transform failed");
+        return false;
+      }
+    }
+  }
+
+  // 픽셀은 이제 출력 색공간/형식이므로 그에 맞게 태그
+  out.setInfo(outputInfo(size.width(), size.height(), opaque), out.rowBytes());
+  return true;
+};
+
+bool ColorManagedDecoder::orient(SkBitmap& bitmap, SkEncodedOrigin origin) {
+  if (origin == kTopLeft_SkEncodedOrigin) return true;
+
+  SkImageInfo info = bitmap.info();
+  if (SkEncodedOriginSwapsWidthHeight(origin)) {
+    info = SkPixmapUtils::SwapWidthHeight(info);
+  }
+  SkBitmap oriented;
+  if (!oriented.tryAllocPixels(info)) return false;
+  if (!SkPixmapUtils::Orient(oriented.pixmap(), bitmap.pixmap(), origin)) {
+    Logger::warn(k_logTag, "Orient failed: %d", (int)origin);
+    return false;
+  }
+  bitmap = std::move(oriented);
+  return true;
+};
+
+sk_sp<SkImage> ColorManagedDecoder::makeDeferred(sk_sp<SkData> data) {
+  if (!data) return nullptr;
+  // 헤더만 읽어 크기/알파 확인 (픽셀 디코딩은 generator 에서)
+  std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+  if (!codec) return nullptr;
+  const SkISize size = orientedDimensions(*codec);
+  if (size.isEmpty()) return nullptr;
+  const SkImageInfo info = outputInfo(size.width(), size.height(), codec->getInfo().isOpaque());
+  return SkImages::DeferredFromGenerator(std::make_unique<ColorManagedGenerator>(info, std::move(data)));
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <core/SkBitmap.h>
+#include <core/SkColorSpace.h>
+#include <core/SkData.h>
+#include <core/SkImage.h>
+#include <codec/SkEncodedOrigin.h>
+
+class SkCodec;
+
+/**
+ * 디코딩 시점에 색 관리(ICC profile -> 출력 색공간)와 EXIF 방향 보정을 한 번에 끝내는 디코더
+ *
+ * - 모든 이미지는 출력 색공간(sRGB) + 출력 픽셀 형식(RGBA_8888, premul)으로 변환된 뒤 캐시/Timeline 에 들어간다.
+ *   render target(SkiaGanesh/CpuEncoder)도 같은 색공간/형식이므로 매 프레임 draw 는 색 변환 없는 단순 복사/샘플링이 된다.
+ *   (변환 전에는 surface 색공간이 nullptr 라 P3/AdobeRGB 사진이 변환 없이 sRGB 로 잘못 표시되었고,
+ *    surface 에 색공간을 지정하면 이번에는 draw 마다 GPU 에서 변환하게 된다)
+ * - RGB ICC profile 은 skcms_Transform 으로 직접 변환하고, sRGB(또는 profile 없음)는 변환을 생략한다.
+ *   Gray/CMYK profile 은 디코더 내부의 색 변환(SkCodec 도 skcms 사용)에 맡긴다.
+ * - EXIF orientation 은 축소가 끝난 뒤(가장 작은 크기에서) 적용하며, 크기 계산은 모두 회전 후 기준이다.
+ */
+class ColorManagedDecoder
+{
+public:
+  // 모든 디코딩 결과와 render target 이 공유하는 출력 색공간
+  static sk_sp<SkColorSpace> outputColorSpace();
+  // 출력 픽셀 형식의 SkImageInfo
+  static SkImageInfo outputInfo(int width, int height, bool opaque = false);
+
+  // EXIF orientation 을 적용한 이미지 크기
+  static SkISize orientedDimensions(const SkCodec& codec);
+
+  /**
+   * codec 이 지원하는 축소 디코딩 크기(getScaledDimensions(scale))로 디코딩 후 출력 색공간/형식으로 변환
+   * - 방향 보정은 하지 않음 (codec 의 저장 방향 그대로, orient 로 따로 적용)
+   * @return 성공 여부
+   */
+  static bool decode(SkCodec& codec, float scale, SkBitmap& out);
+
+  // EXIF orientation 적용 (TopLeft 면 그대로)
+  static bool orient(SkBitmap& bitmap, SkEncodedOrigin origin);
+
+  /**
+   * 원본 크기 지연(deferred) 이미지 생성
+   * - 처음 그려지거나 raster 로 변환될 때 한 번만 출력 색공간/방향으로 디코딩되며(Skia 가 결과 캐시),
+   *   width/height 는 방향 보정 후 크기다.
+   * @return 인코딩 형식을 알 수 없으면 nullptr
+   */
+  static sk_sp<SkImage> makeDeferred(sk_sp<SkData> data);
+
+private:
+  static constexpr const char* k_logTag = "ColorManagedDecoder";
+};
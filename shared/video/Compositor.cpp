@@ -0,0 +1,142 @@
+#include "Compositor.h"
+#include "../trace/Trace.h"
+#include <core/SkImage.h>
+#include <core/SkMatrix.h>
+#include <core/SkPaint.h>
+#include <core/SkSize.h>
+
+namespace {
+
+// 레이어를 한 장씩 그림 (회전 등으로 image set 에 넣을 수 없는 레이어)
+void drawSingle(SkCanvas* canvas, const Compositor::Layer& layer, float alpha) {
+  const Transition::Layer& c = layer.content;
+  SkPaint paint;
+  paint.setAlphaf(alpha);
+  canvas->save();
+  canvas->clipRect(c.dst);
+  canvas->concat(c.transform);
+  canvas->drawImageRect(c.image, c.dst, layer.sampling, &paint);
+  canvas->restore();
+}
+
+/**
+ * 레이어를 image set 항목(src -> dst 사각형)으로 변환
+ * - 애니메이션 변환이 확대/이동뿐이면 "dst 와 변환된 dst 가 겹치는 영역" 과 그에 대응하는 원본 영역만 그리면 되므로
+ *   clip/행렬 변경 없이 사각형 하나로 표현된다.
+ * @return 변환할 수 없으면(회전/뒤집기) false, 보이는 영역이 없으면 true + visible=false
+ */
+bool toImageSetEntry(const Compositor::Layer& layer, float alpha, SkCanvas::ImageSetEntry& out, bool& visible) {
+  const Transition::Layer& c = layer.content;
+  const SkMatrix& m = c.transform;
+  if (!m.isScaleTranslate() || m.getScaleX() <= 0.0f || m.getScaleY() <= 0.0f) return false;
+
+  visible = false;
+  SkRect drawn = c.dst;
+  SkMatrix inverse;
+  if (!m.isIdentity() && (!drawn.intersect(m.mapRect(c.dst)) || !m.invert(&inverse))) return true;
+
+  const SkRect imageBounds = SkRect::Make(c.image->bounds());
+  const SkRect local = m.isIdentity() ? drawn : inverse.mapRect(drawn);
+  out.fImage = c.image;
+  out.fSrcRect = SkMatrix::RectToRect(c.dst, imageBounds).mapRect(local);
+  out.fDstRect = drawn;
+  out.fAlpha = alpha;
+  out.fAAFlags = SkCanvas::kNone_QuadAAFlags;
+  visible = out.fSrcRect.intersect(imageBounds) && !out.fDstRect.isEmpty();
+  return true;
+}
+
+// 레이어가 캔버스 전체를 불투명하게 덮는지 여부 (그 아래 레이어는 보이지 않음)
+bool coversCanvas(SkCanvas* canvas, const Compositor::Layer& layer, float alpha) {
+  const Transition::Layer& c = layer.content;
+  if (!c.image || !c.image->isOpaque() || alpha < 1.0f) return false;
+
+  // 실제로 그려지는 영역 = dst ∩ 변환된 dst (회전 등은 판정하지 않음)
+  SkRect drawn = c.dst;
+  if (!c.transform.isIdentity()) {
+    if (!c.transform.rectStaysRect() || !drawn.intersect(c.transform.mapRect(c.dst))) return false;
+  }
+  const SkMatrix& ctm = canvas->getTotalMatrix();
+  if (!ctm.rectStaysRect()) return false;
+  return ctm.mapRect(drawn).contains(SkRect::Make(canvas->getBaseLayerSize()));
+}
+
+// 모아둔 image set 항목을 한 번에 제출
+void flushBatch(SkCanvas* canvas, SkCanvas::ImageSetEntry* entries, int& count, const SkSamplingOptions& sampling) {
+  if (count == 0) return;
+  // 원본의 일부만 그리는 항목도 주변 픽셀이 실제 이미지 내용이므로 kFast 로 충분
+  canvas->experimental_DrawEdgeAAImageSet(entries, count, nullptr, nullptr, sampling, nullptr, SkCanvas::kFast_SrcRectConstraint);
+  for (int i = 0; i < count; i++) entries[i].fImage.reset();
+  count = 0;
+}
+
+} // namespace
+
+void Compositor::composite(SkCanvas* canvas, const SkRect& bounds, const Layer* layers, int count) {
+  if (!canvas) return;
+  if (count > k_maxLayers) count = k_maxLayers;
+
+  // 1) 두 레이어를 함께 그려야 하는 전환(wipe/slide/...) 짝 찾기
+  //    - paired[k] 이면 (k - 1, k) 를 Transition::draw 로 그림. 한 레이어는 한 전환에만 참여하며,
+  //      짝을 지을 수 없는 전환(아래 레이어가 이미 다른 전환의 to 인 경우)은 crossfade 로 대체한다.
+  bool paired[k_maxLayers] = {};
+  float alpha[k_maxLayers] = {};
+  for (int k = 0; k < count; k++) {
+    const Layer& l = layers[k];
+    const bool transitioning = l.enter != TransitionType::Crossfade && l.enterProgress < 1.0f;
+    paired[k] = transitioning && k > 0 && !paired[k - 1];
+    alpha[k] = (transitioning && !paired[k]) ? l.alpha * l.enterProgress : l.alpha;
+  }
+
+  // 2) 위에서부터 내려오며 캔버스를 완전히 덮는 레이어를 찾아 그 아래 레이어는 그리지 않음
+  int base = -1;
+  for (int k = count - 1; k >= 0; k--) {
+    const bool inTransition = paired[k] || (k + 1 < count && paired[k + 1]);
+    if (!inTransition && coversCanvas(canvas, layers[k], alpha[k])) {
+      base = k;
+      break;
+    }
+  }
+  TRACE_COUNTER("render", "culledLayers", base > 0 ? base : 0);
+
+  // 3) 덮이지 않는 영역이 있으면 검은색으로 초기화, 완전히 덮이면 이전 내용을 버리기만 함
+  if (base < 0) {
+    canvas->clear(SK_ColorBLACK);
+  } else {
+    canvas->discard();
+  }
+
+  // 4) 아래 -> 위 순서로 그리기 (연속된 일반 레이어는 한 번에 제출)
+  SkCanvas::ImageSetEntry batch[k_maxLayers];
+  int batchCount = 0;
+  SkSamplingOptions batchSampling;
+  for (int k = base < 0 ? 0 : base; k < count; k++) {
+    const Layer& l = layers[k];
+
+    if (k + 1 < count && paired[k + 1]) {
+      flushBatch(canvas, batch, batchCount, batchSampling);
+      const Layer& to = layers[k + 1];
+      const SkSamplingOptions& sampling = l.sampling == SkSamplingOptions() ? to.sampling : l.sampling;
+      Transition::draw(to.enter, canvas, bounds, l.content, to.content, to.enterProgress, sampling);
+      k++;
+      continue;
+    }
+
+    if (!l.content.image || alpha[k] <= 0.0f) continue;
+
+    bool visible = false;
+    SkCanvas::ImageSetEntry entry;
+    if (!toImageSetEntry(l, alpha[k], entry, visible)) {
+      flushBatch(canvas, batch, batchCount, batchSampling);
+      drawSingle(canvas, l, alpha[k]);
+      continue;
+    }
+    if (!visible) continue;
+    if (batchCount > 0 && !(batchSampling == l.sampling)) {
+      flushBatch(canvas, batch, batchCount, batchSampling);
+    }
+    batchSampling = l.sampling;
+    batch[batchCount++] = entry;
+  }
+  flushBatch(canvas, batch, batchCount, batchSampling);
+};
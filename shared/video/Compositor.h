@@ -0,0 +1,43 @@
+#pragma once
+#include <core/SkCanvas.h>
+#include <core/SkRect.h>
+#include <core/SkSamplingOptions.h>
+#include "Transition.h"
+
+/**
+ * 한 시점에 보이는 여러 클립 레이어를 합성하는 compositor
+ *
+ * - Timeline 은 시간 t 에 보이는 모든 클립을 아래(먼저 시작한 클립) -> 위 순서의 레이어 목록으로 넘기고,
+ *   compositor 는 다음 순서로 그린다.
+ *   1) 가려짐 판정 (occlusion culling)
+ *      위에서부터 내려오며 "불투명 이미지 + alpha 1 + 전환 중 아님 + 캔버스 전체를 덮음" 조건을 만족하는 첫 레이어를 찾고,
+ *      그 아래 레이어는 전부 그리지 않는다.
+ *   2) 배경 초기화
+ *      화면을 완전히 덮는 레이어가 있으면 clear 대신 discard 로 이전 내용을 버린다.
+ *      (GPU 에서는 이전 프레임 타일을 다시 읽어오지 않아도 되고, raster 에서는 전체 memset 을 생략한다.)
+ *   3) 그리기
+ *      연속된 일반 레이어들은 experimental_DrawEdgeAAImageSet 한 번으로 묶어 제출한다. (Ganesh 에서 텍스처 quad 하나의 op 로 합쳐짐)
+ *      wipe/slide 처럼 두 클립을 함께 그려야 하는 전환은 Transition::draw 로 그린다.
+ * - 레이어 배열은 호출부(스택)가 소유하며 합성 중 할당이 없다.
+ */
+class Compositor
+{
+public:
+  // 합성할 레이어 한 장
+  struct Layer
+  {
+    Transition::Layer content;        // 이미지 / 그릴 영역 / 애니메이션 변환
+    float alpha = 1.0f;               // crossfade 로 계산된 불투명도
+    TransitionType enter = TransitionType::Crossfade; // 바로 아래 레이어에서 이 레이어로 넘어오는 전환 방식
+    float enterProgress = 1.0f;       // 전환 진행률 (1 이면 전환 중이 아님)
+    SkSamplingOptions sampling;       // 이미지 샘플링 옵션
+  };
+
+  static constexpr int k_maxLayers = 8; // 한 시점에 합성할 수 있는 최대 레이어 수 (초과분은 Timeline 이 버림)
+
+  /**
+   * layers[0..count) 를 아래 -> 위 순서로 합성
+   * @param bounds  캔버스 영역 (보통 (0, 0, width, height))
+   */
+  static void composite(SkCanvas* canvas, const SkRect& bounds, const Layer* layers, int count);
+};
@@ -0,0 +1,94 @@
+#include "DecodeCache.h"
+#include "../logger/Logger.h"
+
+DecodeCache::DecodeCache(size_t capacity)
+  : m_state(std::make_shared<State>()) {
+  m_state->capacity = capacity > 0 ? capacity : 1;
+};
+
+DecodeCache::~DecodeCache() {
+  // 진행 중인 요청은 취소만 하고 기다리지 않음 (작업은 공유 상태만 참조하므로 캐시가 먼저 소멸해도 안전)
+  std::lock_guard<std::mutex> lock(m_state->requestMtx);
+  m_requestToken.cancel();
+};
+
+sk_sp<SkImage> DecodeCache::find(const SkImage* src) const {
+  if (!src) return nullptr;
+  return m_state->find(src->uniqueID());
+};
+
+void DecodeCache::requestAsync(std::vector<sk_sp<SkImage>> images) {
+  // 이전 요청은 취소 -> 아직 시작 전이면 실행되지 않고, 처리 중이면 다음 이미지로 넘어가기 전에 중단됨
+  uint64_t requestId = 0;
+  CancellationToken token;
+  {
+    std::lock_guard<std::mutex> lock(m_state->requestMtx);
+    m_requestToken.cancel();
+    m_requestToken = token;
+    requestId = ++m_state->latestRequest;
+    m_state->pending.store(true);
+  }
+
+  std::shared_ptr<State> state = m_state;
+  TaskScheduler::instance().submit(TaskQos::PreviewCritical, "DecodeCache::decode",
+    [state, images = std::move(images), requestId, token]() { decode(state, images, requestId, token); }, token);
+};
+
+void DecodeCache::clear() {
+  std::lock_guard<std::mutex> lock(m_state->entriesMtx);
+  m_state->entries.clear();
+};
+
+size_t DecodeCache::usedBytes() const {
+  std::lock_guard<std::mutex> lock(m_state->entriesMtx);
+  size_t bytes = 0;
+  for (const auto& e : m_state->entries) {
+    bytes += e.decoded->imageInfo().computeMinByteSize();
+  }
+  return bytes;
+};
+
+void DecodeCache::decode(const std::shared_ptr<State>& state, const std::vector<sk_sp<SkImage>>& images, uint64_t requestId, const CancellationToken& token) {
+  for (const auto& src : images) {
+    // 처리 도중 더 최신 요청이 들어왔다면 남은 이미지는 버림 (최신 요청은 별도 작업으로 처리됨)
+    if (token.isCancelled()) return;
+
+    if (!src || !src->isLazyGenerated() || state->find(src->uniqueID())) continue; // raster 이미지이거나 이미 디코딩된 이미지는 건너뜀
+
+    // 지연 디코딩 이미지를 CPU 메모리(raster)로 디코딩 -> 렌더링 스레드에서는 업로드만 하면 됨
+    sk_sp<SkImage> decoded = src->makeRasterImage(nullptr);
+    if (!decoded) {
+      Logger::warn(k_logTag, "makeRasterImage failed (id=%u)", src->uniqueID());
+      continue;
+    }
+    state->insert(src->uniqueID(), std::move(decoded));
+  }
+
+  // 처리 도중 새 요청이 들어오지 않았을 때에만 pending 해제
+  std::lock_guard<std::mutex> lock(state->requestMtx);
+  if (state->latestRequest == requestId) {
+    state->pending.store(false);
+  }
+};
+
+sk_sp<SkImage> DecodeCache::State::find(uint32_t srcId) {
+  std::lock_guard<std::mutex> lock(entriesMtx);
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (it->srcId == srcId) {
+      // 조회된 항목을 목록 맨 앞으로 옮겨 최근 사용 순서 갱신
+      entries.splice(entries.begin(), entries, it);
+      return entries.front().decoded;
+    }
+  }
+  return nullptr;
+};
+
+void DecodeCache::State::insert(uint32_t srcId, sk_sp<SkImage> decoded) {
+  std::lock_guard<std::mutex> lock(entriesMtx);
+  entries.push_front(Entry{ srcId, std::move(decoded) });
+
+  // 용량을 넘어서면 가장 오래 전에 사용된 항목부터 제거
+  while (entries.size() > capacity) {
+    entries.pop_back();
+  }
+};
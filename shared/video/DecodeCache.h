@@ -0,0 +1,74 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <core/SkImage.h>
+#include "../task/TaskScheduler.h"
+
+/**
+ * 지연 디코딩(DeferredFromEncodedData) 이미지를 백그라운드 스레드에서 미리 raster 로 디코딩해두는 캐시
+ *
+ * - Preview seek/scrub 시 렌더링 스레드가 원본 디코딩으로 멈추지 않도록,
+ *   seek 대상 시간에 필요한 이미지들만 TaskScheduler 작업(PreviewCritical)으로 디코딩한 뒤 LRU 로 보관한다.
+ * - requestAsync() 로 들어온 요청은 "가장 최근 요청"만 유지된다.
+ *   -> 새 요청이 들어오면 이전 요청의 token 을 취소하므로, 연속된 seek 요청(scrub 제스처)이 몰려도 마지막 요청만 처리된다.
+ * - 작업은 캐시 객체가 아닌 공유 상태(State)만 참조하므로, 캐시가 먼저 소멸해도 작업 완료를 기다리지 않는다.
+ */
+class DecodeCache
+{
+public:
+  explicit DecodeCache(size_t capacity = 8);
+  ~DecodeCache();
+
+  DecodeCache(const DecodeCache&) = delete;
+  DecodeCache& operator=(const DecodeCache&) = delete;
+
+public:
+  // 원본 이미지(src)에 대해 디코딩이 완료된 raster 이미지 조회 (아직 없으면 nullptr)
+  sk_sp<SkImage> find(const SkImage* src) const;
+
+  // 주어진 이미지들을 비동기로 디코딩 요청 (대기 중이던 이전 요청은 폐기)
+  void requestAsync(std::vector<sk_sp<SkImage>> images);
+
+  // 대기 중이거나 처리 중인 디코딩 요청이 있는지 여부
+  bool isPending() const { return m_state->pending.load(); };
+
+  // 캐시된 디코딩 결과 전부 제거 (Timeline 교체 / 메모리 회수 시 호출)
+  void clear();
+
+  // 보관 중인 raster 이미지의 총 바이트 수 (메모리 통계용)
+  size_t usedBytes() const;
+
+private:
+  struct Entry
+  {
+    uint32_t srcId = 0;               // 원본 이미지의 SkImage::uniqueID()
+    sk_sp<SkImage> decoded;           // 디코딩 완료된 raster 이미지
+  };
+
+  // 캐시와 디코딩 작업이 함께 참조하는 상태
+  struct State
+  {
+    size_t capacity = 1;                        // 최대 보관 개수
+    std::list<Entry> entries;                   // LRU 목록 (앞쪽일수록 최근 사용)
+    std::mutex entriesMtx;                      // entries 보호용 mutex
+    std::mutex requestMtx;                      // latestRequest / pending 변경 보호용 mutex
+    uint64_t latestRequest = 0;                 // 가장 최근 요청 번호
+    std::atomic<bool> pending{ false };         // 가장 최근 요청의 디코딩 대기/진행 여부
+
+    sk_sp<SkImage> find(uint32_t srcId);
+    void insert(uint32_t srcId, sk_sp<SkImage> decoded);
+  };
+
+  // 작업 스레드에서 요청 하나 처리 (token 이 취소되면 남은 이미지는 버림)
+  static void decode(const std::shared_ptr<State>& state, const std::vector<sk_sp<SkImage>>& images, uint64_t requestId, const CancellationToken& token);
+
+private:
+  std::shared_ptr<State> m_state;
+  CancellationToken m_requestToken;           // 가장 최근 요청의 취소 token (m_state->requestMtx 로 보호)
+
+private:
+  static constexpr const char* k_logTag = "DecodeCache";
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <core/SkImage.h>
+
+/**
+ * 시간에 따라 그림이 바뀌는 클립(애니메이션 이미지 / 비디오)의 프레임 입력 인터페이스
+ * - Timeline 은 클립 시작 기준 경과 시간으로 프레임을 요청하고, 시간 -> 프레임 변환(프레임 길이/반복/끝 프레임 유지)은 구현체가 담당한다.
+ * - 정지 이미지 클립은 이 인터페이스를 쓰지 않고 ClipRenderData 의 image/proxy/thumbnail 해상도 선택 경로를 그대로 사용한다.
+ * - Preview 렌더링 스레드와 export 스레드가 같은 객체를 동시에 사용할 수 있으므로 구현체는 thread-safe 해야 한다.
+ */
+class IFrameSource
+{
+public:
+  virtual ~IFrameSource() = default;
+
+  // 프레임 크기 (출력 색공간/픽셀 형식 기준)
+  virtual int width() const = 0;
+  virtual int height() const = 0;
+
+  /**
+   * 클립 시작 기준 경과 시간(초)에 보여줄 프레임 (raster)
+   * - decodeIfMissing 이 false 면 준비된 프레임이 없을 때 기다리지 않고 nullptr (draft 렌더링용)
+   * @return 디코딩 실패 시 nullptr
+   */
+  virtual sk_sp<SkImage> frameAt(double localSec, bool decodeIfMissing = true) = 0;
+
+  // 보관 중인 디코딩 프레임의 픽셀 메모리 크기(byte)
+  virtual size_t cachedBytes() const = 0;
+};
@@ -0,0 +1,94 @@
+#include "ImageResampler.h"
+#include "ColorManagedDecoder.h"
+#include "../logger/Logger.h"
+#include <core/SkSamplingOptions.h>
+#include <codec/SkCodec.h>
+#include <algorithm> // std::min, std::max
+#include <cmath>     // std::lround
+#include <memory>
+
+sk_sp<SkImage> ImageResampler::decodeToFit(const sk_sp<SkData>& data, int maxW, int maxH) {
+  if (!data || maxW <= 0 || maxH <= 0) return nullptr;
+
+  std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+  if (!codec) {
+    Logger::warn(k_logTag, "SkCodec::MakeFromData failed");
+    return nullptr;
+  }
+
+  // 원본 비율을 유지하면서 (maxW, maxH) 안에 들어가는 목표 크기 계산 (확대는 하지 않음)
+  // (maxW/maxH 는 EXIF 방향 보정 후 기준이므로 90도 회전된 사진은 가로/세로를 바꿔서 비교)
+  const SkISize full = ColorManagedDecoder::orientedDimensions(*codec);
+  if (full.isEmpty()) return nullptr;
+  const float fit = std::min(1.0f, std::min(static_cast<float>(maxW) / full.width(),
+                                            static_cast<float>(maxH) / full.height()));
+  const SkEncodedOrigin origin = codec->getOrigin();
+  SkISize target = SkISize::Make(std::max(1, (int)std::lround(full.width() * fit)),
+                                 std::max(1, (int)std::lround(full.height() * fit)));
+  if (SkEncodedOriginSwapsWidthHeight(origin)) {
+    target = SkISize::Make(target.height(), target.width());
+  }
+
+  // 1) 디코더 자체 축소 디코딩 + 출력 색공간/픽셀 형식으로 한 번 변환 (이후 축소/회전/draw 는 변환 없음)
+  SkBitmap decoded;
+  if (!ColorManagedDecoder::decode(*codec, fit, decoded)) return nullptr;
+
+  // 2) + 3) 남은 비율만큼 고화질 축소 (저장 방향 그대로 축소한 뒤 가장 작은 크기에서 방향 보정)
+  SkBitmap scaled;
+  if (decoded.dimensions() == target) {
+    scaled = std::move(decoded);
+  } else {
+    if (!scaled.tryAllocPixels(decoded.info().makeDimensions(target))) return nullptr;
+    if (!downscale(decoded.pixmap(), scaled.pixmap())) return nullptr;
+  }
+  if (!ColorManagedDecoder::orient(scaled, origin)) return nullptr;
+  scaled.setImmutable();
+  return SkImages::RasterFromBitmap(scaled);
+};
+
+sk_sp<SkImage> ImageResampler::resizeToFit(const sk_sp<SkImage>& src, int maxW, int maxH) {
+  if (!src || maxW <= 0 || maxH <= 0) return nullptr;
+
+  const float fit = std::min(1.0f, std::min(static_cast<float>(maxW) / src->width(),
+                                            static_cast<float>(maxH) / src->height()));
+  if (fit >= 1.0f) return src;
+  const SkISize target = SkISize::Make(std::max(1, (int)std::lround(src->width() * fit)),
+                                       std::max(1, (int)std::lround(src->height() * fit)));
+
+  // decodeToFit 결과는 raster 이미지이므로 픽셀을 바로 읽음 (그 외에는 한 번 raster 로 변환)
+  SkPixmap pixels;
+  sk_sp<SkImage> raster = src;
+  if (!raster->peekPixels(&pixels)) {
+    raster = src->makeRasterImage(nullptr);
+    if (!raster || !raster->peekPixels(&pixels)) {
+      Logger::warn(k_logTag, "resizeToFit: raster read failed");
+      return nullptr;
+    }
+  }
+
+  // 이미 출력 색공간/방향 보정이 끝난 픽셀이므로 축소만 함
+  SkBitmap scaled;
+  if (!scaled.tryAllocPixels(pixels.info().makeDimensions(target))) return nullptr;
+  if (!downscale(pixels, scaled.pixmap())) return nullptr;
+  scaled.setImmutable();
+  return SkImages::RasterFromBitmap(scaled);
+};
+
+bool ImageResampler::downscale(const SkPixmap& src, const SkPixmap& dst) {
+  if (src.width() <= 0 || src.height() <= 0 || dst.width() <= 0 || dst.height() <= 0) return false;
+
+  // 목표 크기의 2배 이상 남아있는 동안은 2x2 box 필터로 반씩 축소
+  // (픽셀 중심 기준 정확히 1/2 배율의 bilinear 샘플링 == 2x2 평균)
+  SkBitmap level;
+  SkPixmap cur = src;
+  while (cur.width() >= dst.width() * 2 && cur.height() >= dst.height() * 2) {
+    SkBitmap half;
+    if (!half.tryAllocPixels(cur.info().makeWH(cur.width() / 2, cur.height() / 2))) return false;
+    if (!cur.scalePixels(half.pixmap(), SkSamplingOptions(SkFilterMode::kLinear))) return false;
+    level = std::move(half);
+    cur = level.pixmap();
+  }
+
+  // 마지막 단계는 Mitchell cubic 필터로 목표 크기에 정확히 맞춤
+  return cur.scalePixels(dst, SkSamplingOptions(SkCubicResampler::Mitchell()));
+};
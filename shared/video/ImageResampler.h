@@ -0,0 +1,42 @@
+#pragma once
+#include <core/SkData.h>
+#include <core/SkImage.h>
+#include <core/SkPixmap.h>
+#include <core/SkBitmap.h>
+
+/**
+ * import 시점에 원본 이미지로부터 저해상도 raster 이미지(proxy/thumbnail)를 만드는 고화질 축소 유틸리티
+ *
+ * 축소 과정:
+ *   1) SkCodec::getScaledDimensions 로 디코더가 지원하는 축소 디코딩(ex> JPEG DCT 1/2, 1/4, 1/8)을 먼저 활용해 디코딩 비용 자체를 줄이고,
+ *   2) 목표 크기의 2배 이상이면 2x2 box 필터로 반씩 줄여가며(aliasing 방지),
+ *   3) 마지막 단계는 Mitchell cubic 필터로 목표 크기에 정확히 맞춘다.
+ * - 디코딩 직후 출력 색공간/픽셀 형식으로 변환하고 축소가 끝난 뒤 EXIF 방향을 보정한다. (ColorManagedDecoder)
+ * - 각 단계의 픽셀 연산은 Skia raster pipeline(SkPixmap::scalePixels)을 사용하므로 CPU SIMD 경로로 처리된다.
+ */
+class ImageResampler
+{
+public:
+  /**
+   * 인코딩된 이미지 바이트를 (maxW, maxH) 영역 안에 비율을 유지한 채 들어가도록 축소 디코딩
+   * - maxW/maxH 와 결과 크기는 EXIF 방향 보정 후 기준
+   * @return 축소된 raster 이미지 (원본이 이미 더 작으면 원본 크기 그대로 디코딩), 실패 시 nullptr
+   */
+  static sk_sp<SkImage> decodeToFit(const sk_sp<SkData>& data, int maxW, int maxH);
+
+  /**
+   * 이미 디코딩된 raster 이미지(ex> proxy)를 (maxW, maxH) 영역 안에 비율을 유지한 채 들어가도록 축소
+   * - 원본 바이트를 다시 디코딩하지 않고 작은 이미지에서 더 작은 이미지(thumbnail)를 만들 때 사용
+   * @return 축소된 raster 이미지 (src 가 이미 더 작으면 src 그대로), 실패 시 nullptr
+   */
+  static sk_sp<SkImage> resizeToFit(const sk_sp<SkImage>& src, int maxW, int maxH);
+
+  /**
+   * src 픽셀을 dst 크기로 고화질 축소 (dst 는 미리 할당된 픽셀 메모리여야 함)
+   * @return 성공 여부
+   */
+  static bool downscale(const SkPixmap& src, const SkPixmap& dst);
+
+private:
+  static constexpr const char* k_logTag = "ImageResampler";
+};
@@ -0,0 +1,151 @@
+#include "PrefetchFrameSource.h"
+#include "../task/TaskScheduler.h"
+#include "../trace/Trace.h"
+#include <algorithm> // std::max, std::find, std::min_element
+#include <limits>
+
+PrefetchFrameSource::PrefetchFrameSource(int capacity)
+  : m_capacity(std::max(2, capacity)) {};
+
+sk_sp<SkImage> PrefetchFrameSource::frameAt(double localSec, bool decodeIfMissing) {
+  const int index = frameIndexAt(localSec);
+  std::shared_ptr<Consumer> consumer;
+  sk_sp<SkImage> image;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    consumer = consumerLocked();
+    consumer->wanted = index;
+    if (const Slot* slot = findLocked(*consumer, index)) image = slot->image;
+  }
+  if (!image && decodeIfMissing) {
+    image = decodeAndStore(*consumer, index);
+  }
+  // 다음 프레임들을 미리 채우도록 예약 (draft 요청이면 요청한 프레임도 작업 스레드가 디코딩)
+  schedulePrefetch(consumer);
+  return image;
+};
+
+size_t PrefetchFrameSource::cachedBytes() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  // 여러 consumer 가 공유하는 이미지는 한 번만 셈
+  std::vector<const SkImage*> counted;
+  size_t bytes = 0;
+  for (const auto& consumer : m_consumers) {
+    for (const auto& slot : consumer->ring) {
+      if (!slot.image || std::find(counted.begin(), counted.end(), slot.image.get()) != counted.end()) continue;
+      counted.push_back(slot.image.get());
+      bytes += slot.image->imageInfo().computeMinByteSize();
+    }
+  }
+  return bytes;
+};
+
+sk_sp<SkImage> PrefetchFrameSource::cachedFrame(int index) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  for (const auto& consumer : m_consumers) {
+    if (const Slot* slot = findLocked(*consumer, index)) return slot->image;
+  }
+  return nullptr;
+};
+
+void PrefetchFrameSource::prefetch(Consumer& consumer) {
+  TRACE_SCOPE("decode", "FrameSource::prefetch");
+  // 채우는 도중에도 wanted 가 바뀔 수 있으므로 매번 다시 계산 (재생 위치를 따라감)
+  for (int filled = 0; filled < m_capacity; filled++) {
+    int target = -1;
+    {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      if (consumer.evicted) return;
+      int index = consumer.wanted;
+      for (int k = 0; k < m_capacity && index >= 0; k++) {
+        if (!findLocked(consumer, index)) {
+          target = index;
+          break;
+        }
+        index = nextFrameIndex(index);
+      }
+    }
+    if (target < 0 || !decodeAndStore(consumer, target)) return;
+  }
+};
+
+void PrefetchFrameSource::schedulePrefetch(const std::shared_ptr<Consumer>& consumer) {
+  if (consumer->scheduled.exchange(true)) return;
+  std::shared_ptr<PrefetchFrameSource> self = weak_from_this().lock();
+  if (!self) {
+    consumer->scheduled = false;
+    return;
+  }
+  TaskScheduler::instance().submit(TaskQos::Background, "FrameSource::prefetch", [self, consumer]() {
+    // 채우는 동안 들어온 요청이 다시 예약될 수 있도록 먼저 예약 표시 해제
+    consumer->scheduled = false;
+    self->prefetch(*consumer);
+  });
+};
+
+sk_sp<SkImage> PrefetchFrameSource::decodeAndStore(Consumer& consumer, int index) {
+  std::lock_guard<std::mutex> decodeLock(m_decodeMtx);
+  // 기다리는 동안 다른 스레드가 이미 디코딩했거나 다른 consumer 의 ring 에 있으면 디코딩 없이 공유
+  sk_sp<SkImage> image = cachedFrame(index);
+  if (!image) image = decodeFrame(index);
+  if (!image) return nullptr;
+
+  std::lock_guard<std::mutex> lock(m_mtx);
+  if (consumer.evicted || findLocked(consumer, index)) return image;
+  // 빈 칸 또는 재생 순서상 가장 먼(이미 지나간) 프레임 자리를 덮어씀 (그리는 중인 이미지는 참조 카운트로 유지)
+  Slot* victim = &consumer.ring[0];
+  int victimDistance = -1;
+  for (auto& slot : consumer.ring) {
+    const int distance = slot.index < 0 ? std::numeric_limits<int>::max() : aheadDistanceLocked(consumer, slot.index);
+    if (distance > victimDistance) {
+      victim = &slot;
+      victimDistance = distance;
+    }
+  }
+  victim->index = index;
+  victim->image = image;
+  return image;
+};
+
+std::shared_ptr<PrefetchFrameSource::Consumer> PrefetchFrameSource::consumerLocked() {
+  const std::thread::id thread = std::this_thread::get_id();
+  const uint64_t use = ++m_useClock;
+  for (const auto& consumer : m_consumers) {
+    if (consumer->thread == thread) {
+      consumer->lastUse = use;
+      return consumer;
+    }
+  }
+
+  // 끝난 export 처럼 더 이상 요청하지 않는 consumer 의 ring 을 정리 (예약된 prefetch 작업이 붙들고 있어도 evicted 면 채우지 않음)
+  if (m_consumers.size() >= k_maxConsumers) {
+    auto oldest = std::min_element(m_consumers.begin(), m_consumers.end(),
+                                   [](const auto& a, const auto& b) { return a->lastUse < b->lastUse; });
+    (*oldest)->evicted = true;
+    (*oldest)->ring.clear();
+    m_consumers.erase(oldest);
+  }
+
+  auto consumer = std::make_shared<Consumer>();
+  consumer->thread = thread;
+  consumer->ring.resize((size_t)m_capacity);
+  consumer->lastUse = use;
+  m_consumers.push_back(consumer);
+  return consumer;
+};
+
+const PrefetchFrameSource::Slot* PrefetchFrameSource::findLocked(const Consumer& consumer, int index) {
+  for (const auto& slot : consumer.ring) {
+    if (slot.index == index) return &slot;
+  }
+  return nullptr;
+};
+
+int PrefetchFrameSource::aheadDistanceLocked(const Consumer& consumer, int index) const {
+  int cursor = consumer.wanted;
+  for (int k = 0; k < m_capacity && cursor >= 0; k++) {
+    if (cursor == index) return k;
+    cursor = nextFrameIndex(cursor);
+  }
+  return m_capacity;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "IFrameSource.h"
+
+/**
+ * 디코딩한 프레임을 고정 크기 ring 에 보관하고, 다음에 재생될 프레임을 작업 스레드에서 미리 디코딩해두는 프레임 입력 기반 클래스
+ *
+ * - ring 은 "마지막으로 요청된 프레임 + 그 뒤로 재생될 프레임들"을 보관한다. (capacity 칸)
+ * - 같은 객체를 Preview 렌더링 스레드, export 스레드, renderFrameToBuffer 가 서로 다른 위치에서 동시에 읽으므로
+ *   요청 위치(cursor)와 ring 은 요청한 스레드(consumer)마다 따로 둔다. -> 한 consumer 의 요청이 다른 consumer 의 prefetch 를 덮어쓰지 않음
+ *   최근에 요청한 consumer 최대 k_maxConsumers 개만 유지하므로 메모리는 클립 길이와 무관하게 "프레임 크기 x capacity x k_maxConsumers" 로 제한된다.
+ *   (다른 consumer 의 ring 에 이미 있는 프레임은 다시 디코딩하지 않고 같은 이미지를 공유)
+ * - frameAt() 이 프레임을 요청할 때마다 TaskScheduler 에 채우기 작업(Background)을 예약하고 (consumer 당 동시에 최대 1개),
+ *   작업 스레드는 그 consumer 의 ring 빈칸을 재생 순서대로 채운다. 재생/export 처럼 순서대로 요청되면 렌더링 스레드는 디코딩을 기다리지 않는다.
+ * - ring 에 없는 프레임(seek 직후 등)은 요청한 스레드에서 바로 디코딩한다. (draft 요청이면 기다리지 않고 nullptr)
+ * - 파생 클래스의 decodeFrame() 은 항상 하나씩 직렬화되어 호출되므로 디코더/파일 상태를 따로 보호하지 않아도 된다.
+ * - 작업 스레드가 객체를 참조할 수 있도록 반드시 std::shared_ptr 로 생성해야 한다. (그렇지 않으면 prefetch 없이 동작)
+ */
+class PrefetchFrameSource : public IFrameSource, public std::enable_shared_from_this<PrefetchFrameSource>
+{
+public:
+  ~PrefetchFrameSource() override = default;
+
+  sk_sp<SkImage> frameAt(double localSec, bool decodeIfMissing = true) override final;
+  size_t cachedBytes() const override;
+
+  // 전체 프레임 수
+  virtual int frameCount() const = 0;
+  // 클립 시작 기준 경과 시간(초)에 보여줄 프레임 번호 [0, frameCount)
+  virtual int frameIndexAt(double localSec) const = 0;
+
+protected:
+  explicit PrefetchFrameSource(int capacity = k_defaultCapacity);
+
+  // index 다음에 재생될 프레임 번호 (반복 재생이면 마지막 다음은 0, 끝이면 -1)
+  virtual int nextFrameIndex(int index) const { return index + 1 < frameCount() ? index + 1 : -1; };
+  // 프레임 하나 디코딩 (직렬화되어 호출됨, 실패 시 nullptr)
+  virtual sk_sp<SkImage> decodeFrame(int index) = 0;
+
+  // 어느 consumer 의 ring 에든 있는 프레임 조회 (없으면 nullptr, decodeFrame 안에서 이전 프레임을 참조할 때 사용)
+  sk_sp<SkImage> cachedFrame(int index) const;
+
+private:
+  struct Slot
+  {
+    int index = -1;                   // 프레임 번호 (-1: 빈 칸)
+    sk_sp<SkImage> image;
+  };
+
+  // 프레임을 요청하는 스레드 하나의 재생 위치와 prefetch ring
+  struct Consumer
+  {
+    std::thread::id thread;                     // 요청한 스레드
+    std::vector<Slot> ring;                     // 디코딩된 프레임 (capacity 칸)
+    int wanted = 0;                             // 마지막으로 요청된 프레임 번호
+    uint64_t lastUse = 0;                       // 마지막 요청 순번 (오래된 consumer 부터 정리)
+    bool evicted = false;                       // 목록에서 정리됨 (예약된 prefetch 작업은 건너뜀)
+    std::atomic<bool> scheduled{ false };       // prefetch 작업이 예약되어 있는지 (중복 예약 방지)
+  };
+
+  // 작업 스레드에서 호출: consumer 의 마지막 요청 프레임부터 재생 순서대로 ring 의 빈칸 채우기
+  void prefetch(Consumer& consumer);
+  void schedulePrefetch(const std::shared_ptr<Consumer>& consumer);
+  // index 를 디코딩해 consumer 의 ring 에 보관 (이미 있거나 다른 consumer 가 갖고 있으면 그대로 반환)
+  sk_sp<SkImage> decodeAndStore(Consumer& consumer, int index);
+  // 현재 스레드의 consumer (없으면 만들고, 개수가 넘치면 가장 오래 요청이 없던 consumer 정리)
+  std::shared_ptr<Consumer> consumerLocked();
+  static const Slot* findLocked(const Consumer& consumer, int index);
+  // consumer 의 마지막 요청 프레임부터 재생 순서로 몇 번째 뒤인지 (이미 지나간 프레임이면 capacity 이상)
+  int aheadDistanceLocked(const Consumer& consumer, int index) const;
+
+private:
+  const int m_capacity;                                   // consumer 당 ring 칸 수
+  std::vector<std::shared_ptr<Consumer>> m_consumers;     // 최근 요청한 consumer 들
+  uint64_t m_useClock = 0;                                // consumer 요청 순번
+  mutable std::mutex m_mtx;                               // m_consumers 와 각 consumer 의 ring / wanted 보호용 mutex
+  std::mutex m_decodeMtx;                                 // decodeFrame 직렬화용 mutex
+
+protected:
+  static constexpr int k_defaultCapacity = 4;
+  static constexpr size_t k_maxConsumers = 4;             // 동시에 유지하는 consumer 수 (Preview + export 몇 개)
+};
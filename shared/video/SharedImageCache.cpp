@@ -0,0 +1,105 @@
+#include "SharedImageCache.h"
+#include "ImageResampler.h"
+#include "../logger/Logger.h"
+#include <core/SkData.h>
+
+SharedImageCache::SharedImageCache(size_t budgetBytes)
+  : m_budgetBytes(budgetBytes) {};
+
+sk_sp<SkImage> SharedImageCache::get(const std::string& path, int maxW, int maxH, sk_sp<SkData> data) {
+  const std::string key = path + "|" + std::to_string(maxW) + "|" + std::to_string(maxH);
+
+  std::promise<sk_sp<SkImage>> promise;
+  {
+    std::unique_lock<std::mutex> lock(m_mtx);
+
+    // 1) 이미 디코딩된 항목이면 LRU 순서만 갱신하고 반환
+    auto found = m_index.find(key);
+    if (found != m_index.end()) {
+      m_entries.splice(m_entries.begin(), m_entries, found->second);
+      m_hits++;
+      return found->second->image;
+    }
+
+    // 2) 다른 스레드가 같은 이미지를 디코딩 중이면 그 결과를 기다림
+    auto pending = m_inFlight.find(key);
+    if (pending != m_inFlight.end()) {
+      std::shared_future<sk_sp<SkImage>> future = pending->second;
+      m_hits++;
+      lock.unlock();
+      return future.get();
+    }
+
+    // 3) 처음 요청된 이미지면 이 스레드가 디코딩을 담당
+    m_inFlight.emplace(key, promise.get_future().share());
+    m_misses++;
+  }
+
+  // 디코딩은 잠금 밖에서 수행 -> 서로 다른 이미지는 여러 스레드에서 병렬로 디코딩됨
+  sk_sp<SkImage> image;
+  if (!data) {
+    data = SkData::MakeFromFileName(path.c_str());
+  }
+  if (data) {
+    image = ImageResampler::decodeToFit(data, maxW, maxH);
+  }
+  if (!image) {
+    Logger::warn(k_logTag, "Decode failed: %s", path.c_str());
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_inFlight.erase(key);
+    if (image) {
+      insertLocked(key, image);
+    }
+  }
+  promise.set_value(image);
+  return image;
+};
+
+size_t SharedImageCache::usedBytes() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_usedBytes;
+};
+
+size_t SharedImageCache::hitCount() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_hits;
+};
+
+size_t SharedImageCache::missCount() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_misses;
+};
+
+void SharedImageCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_entries.clear();
+  m_index.clear();
+  m_usedBytes = 0;
+};
+
+void SharedImageCache::trimTo(size_t maxBytes) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  evictLocked(maxBytes, 0);
+};
+
+void SharedImageCache::insertLocked(const std::string& key, sk_sp<SkImage> image) {
+  const size_t bytes = image->imageInfo().computeMinByteSize();
+  m_entries.push_front(Entry{ key, std::move(image), bytes });
+  m_index[key] = m_entries.begin();
+  m_usedBytes += bytes;
+
+  // budget 을 넘어서면 가장 오래 전에 사용된 항목부터 제거 (방금 넣은 항목은 유지)
+  evictLocked(m_budgetBytes, 1);
+};
+
+void SharedImageCache::evictLocked(size_t maxBytes, size_t keepCount) {
+  while (m_usedBytes > maxBytes && m_entries.size() > keepCount) {
+    const Entry& last = m_entries.back();
+    m_usedBytes -= last.bytes;
+    m_index.erase(last.key);
+    m_entries.pop_back();
+  }
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <string>
+#include <list>
+#include <map>
+#include <mutex>
+#include <future>
+#include <core/SkData.h>
+#include <core/SkImage.h>
+
+/**
+ * 여러 Timeline(여러 export 작업)이 함께 사용하는 "파일 경로 기준" raster 디코딩 캐시
+ *
+ * - 같은 이미지 파일을 같은 크기로 요청하면 한 번만 디코딩하고 결과 SkImage(raster)를 공유한다.
+ *   -> 배치 렌더링에서 여러 작업이 같은 사진을 사용해도 디코딩 비용/메모리가 작업 수만큼 늘어나지 않는다.
+ * - 여러 스레드가 동시에 같은 키를 요청하면 먼저 요청한 스레드만 디코딩하고 나머지는 그 결과를 기다린다(in-flight 중복 제거).
+ * - 보관 중인 raster 이미지의 총 바이트 수가 budget 을 넘으면 가장 오래 전에 사용된 항목부터 제거한다.
+ *   (제거되더라도 이미 Timeline 이 들고 있는 SkImage 는 참조 카운트로 유지되므로 안전)
+ *
+ * DecodeCache 가 "Preview 의 seek 대상 이미지"를 비동기로 미리 디코딩한다면,
+ * 이 캐시는 "작업 간 공유"가 목적이며 호출한 스레드에서 동기적으로 디코딩한다.
+ */
+class SharedImageCache
+{
+public:
+  explicit SharedImageCache(size_t budgetBytes = k_defaultBudgetBytes);
+
+  SharedImageCache(const SharedImageCache&) = delete;
+  SharedImageCache& operator=(const SharedImageCache&) = delete;
+
+public:
+  /**
+   * path 의 이미지를 (maxW, maxH) 안에 들어가도록 축소 디코딩한 raster 이미지 조회 (없으면 호출한 스레드에서 디코딩)
+   * - data: 호출한 쪽이 이미 읽어 둔 path 의 파일 내용 (있으면 디코딩할 때 파일을 다시 읽지 않음)
+   * @return 디코딩 결과, 실패 시 nullptr
+   */
+  sk_sp<SkImage> get(const std::string& path, int maxW, int maxH, sk_sp<SkData> data = nullptr);
+
+  // 현재 보관 중인 raster 이미지의 총 바이트 수
+  size_t usedBytes() const;
+  // 캐시 적중/미스 횟수 (통계용)
+  size_t hitCount() const;
+  size_t missCount() const;
+
+  // 보관 중인 항목 전부 제거
+  void clear();
+  // 보관 바이트 수가 maxBytes 이하가 될 때까지 가장 오래 전에 사용된 항목부터 제거 (메모리 회수용)
+  void trimTo(size_t maxBytes);
+
+private:
+  struct Entry
+  {
+    std::string key;                  // "path|maxW|maxH"
+    sk_sp<SkImage> image;             // 디코딩 완료된 raster 이미지
+    size_t bytes = 0;                 // image 의 픽셀 메모리 크기
+  };
+
+  void insertLocked(const std::string& key, sk_sp<SkImage> image);
+  void evictLocked(size_t maxBytes, size_t keepCount);
+
+private:
+  size_t m_budgetBytes;                                                   // 최대 보관 바이트 수
+  size_t m_usedBytes = 0;                                                 // 현재 보관 바이트 수
+  size_t m_hits = 0;                                                      // 캐시 적중 횟수
+  size_t m_misses = 0;                                                    // 캐시 미스(디코딩 수행) 횟수
+  std::list<Entry> m_entries;                                             // LRU 목록 (앞쪽일수록 최근 사용)
+  std::map<std::string, std::list<Entry>::iterator> m_index;              // key -> m_entries 위치
+  std::map<std::string, std::shared_future<sk_sp<SkImage>>> m_inFlight;   // 디코딩 진행 중인 key
+  mutable std::mutex m_mtx;                                               // 위 상태 보호용 mutex
+
+private:
+  static constexpr size_t k_defaultBudgetBytes = 256 * 1024 * 1024;       // 기본 256MB
+  static constexpr const char* k_logTag = "SharedImageCache";
+};
@@ -1,76 +1,204 @@
 #include "Timeline.h"
+#include "Compositor.h"
+#include "DecodeCache.h"
+#include "IFrameSource.h"
+#include "ClipSequence.h"
+#include "../trace/Trace.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <unordered_set>
+#include <core/SkData.h>
+
+/**
+ * 애니메이션되는 클립의 샘플링 옵션
+ * - 고정 클립은 dst 크기에 맞춘 proxy 를 거의 1:1 로 그리므로 기본 샘플링으로 충분하지만,
+ *   pan/zoom 중인 클립은 매 프레임 부분 픽셀 단위로 이동/확대되므로 bilinear 로 그려야 떨림(shimmering)이 없다.
+ * - 축소되어 그려지는 경우(원본이 proxy 를 대신하는 경우 등)에는 mipmap 을 사용해 축소 aliasing 을 막는다.
+ */
+static const SkSamplingOptions k_motionSampling(SkFilterMode::kLinear, SkMipmapMode::kLinear);
 
 void Timeline::setSegments(std::vector<Timeline::Segment>& segs) {
-  // 주어진 클립 목록의 메모리 소유권을 멤버변수로 "이동" 후 시간 순 정렬
-  m_segments = std::move(segs);
-  std::sort(m_segments.begin(), m_segments.end(), [](const Timeline::Segment& a, const Timeline::Segment& b){
-    return a.start < b.start;
-  });
+  // 주어진 클립 목록의 메모리 소유권을 기본 트랙으로 "이동" 후 시간 순 정렬 + 구간 인덱스 생성
+  auto track = std::make_shared<Track>();
+  track->build(segs);
+  m_tracks[0] = std::move(track);
 
   // 클립 목록 기준으로 전체 영상 길이 재계산
   recomputeDuration();
 };
 
+int Timeline::addTrack(std::vector<Timeline::Segment>& segs) {
+  auto track = std::make_shared<Track>();
+  track->build(segs);
+  m_tracks.push_back(std::move(track));
+  recomputeDuration();
+  return (int)m_tracks.size() - 1;
+};
+
+std::shared_ptr<Timeline> Timeline::withTrack(int track, std::vector<Segment>& segs) const {
+  // 트랙 목록은 포인터만 복사 -> 교체하지 않은 트랙(구간 인덱스 포함)과 오디오 클립은 원본과 공유
+  auto tl = std::make_shared<Timeline>(*this);
+  auto rebuilt = std::make_shared<Track>();
+  rebuilt->build(segs);
+  tl->m_tracks[track] = std::move(rebuilt);
+  tl->recomputeDuration();
+  return tl;
+};
+
+std::shared_ptr<Timeline> Timeline::withSequence(int track, const ClipSequence& sequence) const {
+  auto tl = std::make_shared<Timeline>(*this);
+  auto rebuilt = std::make_shared<Track>();
+  rebuilt->build(sequence);
+  tl->m_tracks[track] = std::move(rebuilt);
+  tl->recomputeDuration();
+  return tl;
+};
+
+const Timeline::Segment& Timeline::segmentAt(int track, size_t i, double& start) const {
+  const Track& t = *m_tracks[track];
+  start = t.startOf((int)i);
+  return t.at((int)i);
+};
+
+// 렌더링 조건에 맞는 기본 해상도 이미지 선택 (Draft/디코딩 캐시 적용 전)
+static sk_sp<SkImage> baseImage(const Timeline::ClipRenderData& clip, const RenderContext& ctx, const SkMatrix& motion) {
+  if (ctx.quality == RenderQuality::Export || !clip.proxy) {
+    return clip.image;
+  }
+
+  // 현재 캔버스 변환(+ 클립 애니메이션)을 적용했을 때 dst 가 실제로 차지하는 픽셀 크기를 proxy 가 덮을 수 있는지 검사
+  const SkMatrix total = ctx.canvas ? SkMatrix::Concat(ctx.canvas->getTotalMatrix(), motion) : motion;
+  const SkRect devDst = total.mapRect(clip.dst);
+  const bool proxyCovers = clip.proxy->width() + 1 >= devDst.width() && clip.proxy->height() + 1 >= devDst.height();
+  return proxyCovers ? clip.proxy : clip.image;
+}
+
+sk_sp<SkImage> Timeline::selectImage(const ClipRenderData& clip, const RenderContext& ctx, const SkMatrix& motion) {
+  sk_sp<SkImage> img = baseImage(clip, ctx, motion);
+  if (!img || !img->isLazyGenerated()) {
+    // raster 이미지(proxy 등)는 이미 디코딩되어 있으므로 그대로 사용
+    return img;
+  }
+
+  // 백그라운드에서 미리 디코딩된 결과가 있으면 사용
+  if (ctx.decodeCache) {
+    if (auto decoded = ctx.decodeCache->find(img.get())) {
+      return decoded;
+    }
+  }
+
+  // draft 렌더링이면 디코딩을 기다리지 않고 저해상도 thumbnail 사용
+  if (ctx.quality == RenderQuality::Draft && clip.thumbnail) {
+    return clip.thumbnail;
+  }
+  return img;
+};
+
+// 애니메이션/비디오 클립의 현재 프레임 (클립 시작 기준 경과 시간 -> 프레임 변환은 프레임 입력이 담당)
+static sk_sp<SkImage> sourceFrame(const Timeline::Segment& seg, double start, const RenderContext& ctx) {
+  const double localSec = ctx.timeSec - start;
+  // draft 렌더링이면 디코딩을 기다리지 않고 준비된 프레임, 없으면 thumbnail 사용
+  if (ctx.quality == RenderQuality::Draft) {
+    if (auto cached = seg.clip.source->frameAt(localSec, false)) return cached;
+    if (seg.clip.thumbnail) return seg.clip.thumbnail;
+  }
+  if (auto frame = seg.clip.source->frameAt(localSec)) return frame;
+  return seg.clip.image; // 디코딩 실패 시 첫 프레임
+}
+
 void Timeline::render(const RenderContext& ctx) const {
+  TRACE_SCOPE("render", "Timeline::render");
   if (!ctx.canvas) return;
-  if (m_segments.empty()) return;
+  if (m_tracks[0]->size() == 0) return;
 
-  // skia canvas 배경색 초기화
-  ctx.canvas->clear(SK_ColorBLACK);
-
-  // 현재 시간(ctx.timeSec)에 해당하는 클립 찾기
+  // 현재 시간(ctx.timeSec)에 화면에 보이는 클립들 찾기 (아래 트랙 -> 위 트랙, 트랙 안에서는 먼저 시작한 클립이 아래)
   const double t = ctx.timeSec;
-  int currIdx = -1;
-  for (int i = 0; i < (int)m_segments.size(); i++)
-  {
-    const auto& seg = m_segments[i];
-    if (t >= seg.start && t < seg.start + seg.duration) {
-      currIdx = i;
-      break;
+  ActiveRef active[Compositor::k_maxLayers];
+  const int count = activeSegmentsAt(t, active, Compositor::k_maxLayers);
+
+  // 클립마다 레이어 구성
+  //  - 앞 클립의 fade 구간으로 들어오는 클립: 앞 클립에 지정된 전환 방식/진행률 (crossfade 면 진행률만큼 불투명)
+  //  - fade 구간에서 crossfade 로 사라지는 클립: (1 - 진행률) 만큼 불투명
+  //  -> 두 클립이 겹치는 일반적인 경우 기존 crossfade 와 같은 결과이며, 셋 이상 겹쳐도 같은 규칙으로 쌓인다.
+  Compositor::Layer layers[Compositor::k_maxLayers];
+  for (int k = 0; k < count; k++) {
+    const Track& track = *m_tracks[active[k].track];
+    const int idx = active[k].index;
+    const auto& seg = track.at(idx);
+    const double start = track.startOf(idx);
+    Compositor::Layer& layer = layers[k];
+
+    const SkMatrix motion = motionAt(seg, start, t);
+    sk_sp<SkImage> img = seg.clip.source ? sourceFrame(seg, start, ctx) : selectImage(seg.clip, ctx, motion);
+    layer.content = Transition::Layer{ std::move(img), seg.clip.dst, motion };
+    layer.sampling = seg.motion ? k_motionSampling : SkSamplingOptions();
+
+    if (idx > 0 && track.inFadeAt(idx - 1, t)) {
+      layer.enter = track.at(idx - 1).transition;
+      layer.enterProgress = (float)track.fadeProgressAt(idx - 1, t);
+      if (layer.enter == TransitionType::Crossfade) layer.alpha *= layer.enterProgress;
+    }
+    if (track.inFadeAt(idx, t) && seg.transition == TransitionType::Crossfade) {
+      layer.alpha *= 1.0f - (float)track.fadeProgressAt(idx, t);
     }
   }
-  if (currIdx < 0) {
-    // 현재 시간에 해당하는 클립을 찾지 못했다면 마지막 클립으로 지정
-    currIdx = (int)m_segments.size() - 1;
-  }
-  const auto& cur = m_segments[currIdx];
-
-  // fade 구간 여부 판단
-  const double tEnd = cur.start + cur.duration;                                   // 현재 시간에 해당하는 클립의 종료 시간
-  const double fadeLen = std::max(0.0, cur.xfade);                                // 현재 시간에 해당되는 클립의 fade 길이 (0이면 페이드 없음)
-  const double fadeStart = std::max(cur.start, tEnd - fadeLen);                   // 현재 클립이 끝나기 직전, 페이드가 시작되는 시각
-  const bool hasNext = (currIdx + 1) < (int)m_segments.size();                    // 다음 클립 존재 여부
-  const bool inFade = (fadeLen > 0.0) && hasNext && (t >= fadeStart && t < tEnd); // 현재 시간이 현재 클립의 fade 구간 내에 존재하는지 여부
-
-  if (inFade) {
-    /** 현재 시간이 fade 구간에 속하는 경우 */
-    // 현재 클립과 blending 할 다음 클립 가져오가
-    const auto& next = m_segments[currIdx + 1];
-
-    // 현재 시간을 기반으로 다음 클립에 적용할 투명도 보간 (시간이 지날수록 0 -> 1 로 증가하도록 계산)
-    const double a = std::clamp((t - fadeStart) / fadeLen, 0.0, 1.0);
-
-    SkPaint pCur, pNext;
-    pCur.setAlpha((int)std::lround((1.0 - a) * 255.0)); // 현재 클립의 투명도는 (1.0 - a) * 255.0 로 지정
-    pNext.setAlpha((int)std::lround(a * 255.0));        // 다음 클립의 투명도는 a * 255.0 로 지정
-
-    // 현재 클립과 다음 클립을 보간된 투명도로 각각 그린다.
-    if (cur.clip.image) ctx.canvas->drawImageRect(cur.clip.image, cur.clip.dst, SkSamplingOptions(), &pCur);
-    if (next.clip.image) ctx.canvas->drawImageRect(next.clip.image, next.clip.dst, SkSamplingOptions(), &pNext);
-  } else {
-    /** 현재 시간이 fade 구간에 속하지 않는 경우 */
-    // 현재 클립만 투명도 100% 로 렌더링
-    SkPaint paint;
-    paint.setAlpha(255);
-    if (cur.clip.image) {
-      ctx.canvas->drawImageRect(cur.clip.image, cur.clip.dst, SkSamplingOptions(), &paint);
+
+  // 가려진 레이어 생략 / 배경 초기화 / 일괄 제출은 Compositor 가 담당 (전환 방식별 그리기는 Transition 참고)
+  Compositor::composite(ctx.canvas, SkRect::MakeIWH(ctx.width, ctx.height), layers, count);
+};
+
+std::vector<sk_sp<SkImage>> Timeline::imagesAt(const RenderContext& ctx) const {
+  std::vector<sk_sp<SkImage>> images;
+  if (m_tracks[0]->size() == 0) return images;
+
+  // render() 와 동일한 기준으로 현재 시간에 그려지는 클립(들)의 이미지 수집
+  ActiveRef active[Compositor::k_maxLayers];
+  const int count = activeSegmentsAt(ctx.timeSec, active, Compositor::k_maxLayers);
+  for (int k = 0; k < count; k++) {
+    const Track& track = *m_tracks[active[k].track];
+    const auto& seg = track.at(active[k].index);
+    // 애니메이션/비디오 클립은 프레임 입력이 직접 prefetch 하므로 미리 디코딩 대상에서 제외
+    if (seg.clip.source) continue;
+    if (auto img = baseImage(seg.clip, ctx, motionAt(seg, track.startOf(active[k].index), ctx.timeSec))) {
+      images.push_back(std::move(img));
     }
   }
+  return images;
 };
 
-std::shared_ptr<Timeline> Timeline::FromClipRenderData(const std::vector<ClipRenderData>& renderDataList, double clipDuration, double xfade) {
+void Timeline::memoryUsage(size_t& encodedBytes, size_t& decodedBytes) const {
+  encodedBytes = 0;
+  decodedBytes = 0;
+
+  std::unordered_set<uint32_t> counted; // 이미 집계한 SkImage::uniqueID()
+  auto account = [&](const sk_sp<SkImage>& img) {
+    if (!img || !counted.insert(img->uniqueID()).second) return;
+    if (img->isLazyGenerated()) {
+      if (sk_sp<SkData> encoded = img->refEncodedData()) {
+        encodedBytes += encoded->size();
+      }
+    } else {
+      decodedBytes += img->imageInfo().computeMinByteSize();
+    }
+  };
+
+  std::unordered_set<const IFrameSource*> countedSources;
+  for (const auto& track : m_tracks) {
+    track->forEach([&](const Segment& seg) {
+      account(seg.clip.image);
+      account(seg.clip.thumbnail);
+      account(seg.clip.proxy);
+      if (seg.clip.source && countedSources.insert(seg.clip.source.get()).second) {
+        decodedBytes += seg.clip.source->cachedBytes();
+      }
+    });
+  }
+};
+
+std::shared_ptr<Timeline> Timeline::FromClipRenderData(const std::vector<ClipRenderData>& renderDataList, double clipDuration, double xfade,
+                                                       const std::vector<TransitionType>& transitions,
+                                                       const std::vector<std::shared_ptr<const ClipMotion>>& motions) {
   auto tl = std::make_shared<Timeline>();
   std::vector<Timeline::Segment> segs;  // 생성된 클립들을 저장할 컨테이너
   double cursor = 0.0;                  // 다음에 생성할 클립이 시작될 시간(초)을 계산하기 위해 사용하는 누산값
@@ -78,6 +206,12 @@ std::shared_ptr<Timeline> Timeline::FromClipRenderData(const std::vector<ClipRen
   for (size_t i = 0; i < renderDataList.size(); i++) {
     // 클립 생성 후 목록에 추가
     segs.push_back(Timeline::Segment{ renderDataList[i], clipDuration, cursor, xfade });
+    if (!transitions.empty()) {
+      segs.back().transition = transitions[i % transitions.size()];
+    }
+    if (!motions.empty()) {
+      segs.back().motion = motions[i % motions.size()];
+    }
     /**
      * 다음 클립의 시작 시간은 "클립을 보여줄 시간 - 두 클립이 겹치는 시간(xfade)"만큼 앞으로 당김.
      * 이렇게 시작 시간을 계산하면 두 클립의 끝부분이 서로 겹치며 부드럽게 바뀜.
@@ -93,7 +227,179 @@ std::shared_ptr<Timeline> Timeline::FromClipRenderData(const std::vector<ClipRen
 
 void Timeline::recomputeDuration() {
   m_totalDuration = 0.0;
-  for (auto& seg : m_segments) {
-    m_totalDuration = std::max(m_totalDuration, seg.start + seg.duration);
+  for (const auto& track : m_tracks) {
+    m_totalDuration = std::max(m_totalDuration, track->endTime);
+  }
+};
+
+int Timeline::activeSegmentsAt(double tSec, ActiveRef* out, int maxCount) const {
+  int count = 0;
+  int indices[Compositor::k_maxLayers];
+  for (int ti = 0; ti < (int)m_tracks.size() && count < maxCount; ti++) {
+    // 기본 트랙만 빈 구간/끝 이후에 마지막 클립을 유지 (overlay 트랙은 클립이 없으면 그리지 않음)
+    const int n = m_tracks[ti]->activeAt(tSec, indices, std::min(maxCount - count, Compositor::k_maxLayers), ti == 0);
+    for (int k = 0; k < n; k++) {
+      out[count++] = ActiveRef{ ti, indices[k] };
+    }
+  }
+  return count;
+};
+
+void Timeline::Track::build(std::vector<Segment>& segs) {
+  segments = std::move(segs);
+  std::sort(segments.begin(), segments.end(), [](const Timeline::Segment& a, const Timeline::Segment& b){
+    return a.start < b.start;
+  });
+
+  const size_t n = segments.size();
+  visibleStart.resize(n);
+  visibleEnd.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    const auto& seg = segments[i];
+    visibleStart[i] = seg.start;
+    visibleEnd[i] = seg.start + seg.duration;
+
+    // 앞 클립의 fade 구간 동안에도 (다음 클립으로서) 보임
+    if (i > 0 && segments[i - 1].xfade > 0.0) {
+      const auto& prev = segments[i - 1];
+      const double prevEnd = prev.start + prev.duration;
+      visibleStart[i] = std::min(visibleStart[i], std::max(prev.start, prevEnd - prev.xfade));
+      visibleEnd[i] = std::max(visibleEnd[i], prevEnd);
+    }
+  }
+
+  endLeaves = 1;
+  while (endLeaves < (int)n) endLeaves *= 2;
+  endTree.assign(2 * (size_t)endLeaves, -std::numeric_limits<double>::infinity());
+  std::copy(visibleEnd.begin(), visibleEnd.end(), endTree.begin() + endLeaves);
+  for (int k = endLeaves - 1; k >= 1; k--) {
+    endTree[k] = std::max(endTree[2 * k], endTree[2 * k + 1]);
+  }
+
+  endTime = 0.0;
+  for (const auto& seg : segments) {
+    endTime = std::max(endTime, seg.start + seg.duration);
   }
 };
+
+// endTree 노드(node, 담당 구간 [lo, lo + width)) 안에서 [0, hi) 중 값이 tSec 보다 큰 마지막 잎 번호 (없으면 -1)
+// - 범위에 완전히 포함되고 최댓값이 tSec 보다 큰 노드는 반드시 찾으므로, 실패하는 재귀는 hi 경계 경로의 노드뿐이다. O(log n)
+static int lastAbove(const std::vector<double>& tree, int node, int lo, int width, int hi, double tSec) {
+  if (lo >= hi || tree[node] <= tSec) return -1;
+  if (width == 1) return lo;
+  const int half = width / 2;
+  const int right = lastAbove(tree, 2 * node + 1, lo + half, half, hi, tSec);
+  return right >= 0 ? right : lastAbove(tree, 2 * node, lo, half, hi, tSec);
+}
+
+int Timeline::Track::lastVisibleBefore(int hi, double tSec) const {
+  if (endTree.empty()) return -1;
+  return lastAbove(endTree, 1, 0, endLeaves, hi, tSec);
+};
+
+void Timeline::Track::build(const ClipSequence& seq) {
+  sequence = std::make_shared<const ClipSequence>(seq);
+  endTime = seq.endTime();
+};
+
+size_t Timeline::Track::size() const {
+  return sequence ? sequence->size() : segments.size();
+};
+
+const Timeline::Segment& Timeline::Track::at(int idx) const {
+  return sequence ? sequence->at((size_t)idx) : segments[idx];
+};
+
+double Timeline::Track::startOf(int idx) const {
+  return sequence ? sequence->startOf((size_t)idx) : segments[idx].start;
+};
+
+const std::vector<Timeline::Segment>& Timeline::Track::list() const {
+  if (!sequence) return segments;
+  // 여러 스레드(Preview 렌더링 / export 준비)가 동시에 불러도 한 번만 펼침
+  std::call_once(flattenOnce, [this]() { flattened = sequence->toSegments(); });
+  return flattened;
+};
+
+void Timeline::Track::forEach(const std::function<void(const Segment&)>& fn) const {
+  if (sequence) {
+    sequence->forEach([&fn](const Segment& seg, double) { fn(seg); });
+    return;
+  }
+  for (const auto& seg : segments) fn(seg);
+};
+
+int Timeline::Track::activeAt(double tSec, int* out, int maxCount, bool holdLast) const {
+  if (size() == 0 || maxCount <= 0) return 0;
+
+  if (sequence) {
+    /**
+     * 보이는 클립 = 재생 중인 클립 + 재생 중인 클립의 fade 구간으로 들어오는 다음 클립
+     * - 들어오는 클립은 앞 클립이 재생 중일 때만 보이므로 재생 중인 클립만 treap 에서 찾으면 된다. (O((k + 1) log n))
+     * - 결과 중 나중 maxCount 개를 남기려면 재생 중인 클립은 maxCount + 1 개까지 필요 (들어오는 클립은 앞 클립 바로 뒤)
+     */
+    size_t playing[Compositor::k_maxLayers + 1];
+    const int found = sequence->playingAt(tSec, playing, std::min(maxCount, Compositor::k_maxLayers) + 1);
+    int visible[2 * (Compositor::k_maxLayers + 1)];
+    int total = 0;
+    for (int k = 0; k < found; k++) {
+      const int i = (int)playing[k];
+      if (total == 0 || visible[total - 1] != i) visible[total++] = i;
+      if (inFadeAt(i, tSec)) visible[total++] = i + 1;
+    }
+    const int count = std::min(total, maxCount);
+    std::copy(visible + (total - count), visible + total, out);
+    if (count == 0 && holdLast) {
+      out[0] = (int)size() - 1;
+      return 1;
+    }
+    return count;
+  }
+
+  // t 이전에 보이기 시작한 클립 [0, hi) 중 아직 끝나지 않은 클립을 뒤에서부터 수집
+  const int hi = (int)(std::upper_bound(visibleStart.begin(), visibleStart.end(), tSec) - visibleStart.begin());
+  int count = 0;
+  for (int i = lastVisibleBefore(hi, tSec); i >= 0 && count < maxCount; i = lastVisibleBefore(i, tSec)) {
+    // 보이는 구간의 합집합 안에서도 실제로 "재생 중" 이거나 "앞 클립의 fade 로 들어오는 중" 인 경우만
+    // (아닌 클립은 "아직 시작 전인 hi - 1" 이거나 "바로 앞 클립이 재생 중" 인 경우뿐이라 건너뛰는 수도 보이는 클립 수 + 1 이하)
+    const auto& seg = segments[i];
+    const bool playing = tSec >= seg.start && tSec < seg.start + seg.duration;
+    const bool entering = i > 0 && inFadeAt(i - 1, tSec);
+    if (!playing && !entering) continue;
+    // 위(나중에 시작한 클립)에서부터 채우므로 넘치면 더 아래에 깔린 클립이 버려짐
+    out[count++] = i;
+  }
+  std::reverse(out, out + count);
+
+  if (count == 0 && holdLast) {
+    out[count++] = (int)segments.size() - 1;
+  }
+  return count;
+};
+
+double Timeline::Track::fadeProgressAt(int idx, double tSec) const {
+  if (!inFadeAt(idx, tSec)) return 0.0;
+  // 현재 시간을 기반으로 전환 진행률 보간 (시간이 지날수록 0 -> 1 로 증가하도록 계산)
+  const auto& cur = at(idx);
+  const double start = startOf(idx);
+  const double fadeLen = cur.xfade;
+  const double fadeStart = std::max(start, start + cur.duration - fadeLen);
+  return std::clamp((tSec - fadeStart) / fadeLen, 0.0, 1.0);
+};
+
+bool Timeline::Track::inFadeAt(int idx, double tSec) const {
+  const auto& cur = at(idx);
+  const double start = startOf(idx);
+  const double tEnd = start + cur.duration;                     // 현재 시간에 해당하는 클립의 종료 시간
+  const double fadeLen = std::max(0.0, cur.xfade);              // 현재 시간에 해당되는 클립의 fade 길이 (0이면 페이드 없음)
+  const double fadeStart = std::max(start, tEnd - fadeLen);     // 현재 클립이 끝나기 직전, 페이드가 시작되는 시각
+  const bool hasNext = (idx + 1) < (int)size();                 // 다음 클립 존재 여부
+  return (fadeLen > 0.0) && hasNext && (tSec >= fadeStart && tSec < tEnd);
+};
+
+SkMatrix Timeline::motionAt(const Segment& seg, double start, double tSec) {
+  if (!seg.motion || seg.duration <= 0.0) return SkMatrix::I();
+  // 클립 진행률: 다음 클립과 겹치는 fade 구간까지 포함해 클립이 보이는 전체 시간 동안 0 -> 1
+  const double progress = std::clamp((tSec - start) / seg.duration, 0.0, 1.0);
+  return seg.motion->matrixAt((float)progress, seg.clip.dst);
+};
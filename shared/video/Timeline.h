@@ -1,11 +1,29 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <string>
 #include <cstdint>
+#include <functional>
+#include <mutex>
 #include <core/SkCanvas.h>
 #include <core/SkImage.h>
 #include <core/SkPaint.h>
 #include <core/SkRect.h>
+#include "ClipMotion.h"
+#include "../audio/AudioClip.h"
+#include "Transition.h"
+
+class DecodeCache;
+class IFrameSource;
+class ClipSequence;
+
+// 렌더링 목적에 따라 클립의 어떤 해상도 이미지를 그릴지 결정하는 기준
+enum class RenderQuality
+{
+  Draft,    // seek/scrub 직후: 원본 디코딩을 기다리지 않고 thumbnail 로 즉시 렌더링
+  Preview,  // 일반 Preview: 화면에 그려질 크기를 충분히 덮는 가장 작은 해상도(proxy 또는 원본) 선택
+  Export,   // 인코딩(export): 항상 원본 해상도
+};
 
 // 캔버스 렌더링에 필요한 정보
 struct RenderContext
@@ -14,6 +32,8 @@ struct RenderContext
   int width = 0;                  // 캔버스 너비
   int height = 0;                 // 캔버스 높이
   double timeSec = 0.0;          // 현재 시간(초)
+  RenderQuality quality = RenderQuality::Preview; // 해상도 선택 기준 (Preview/Export/Draft)
+  const DecodeCache* decodeCache = nullptr; // 미리 디코딩된 원본 이미지 조회용 캐시 (없으면 원본을 그대로 그림)
 
   RenderContext() = default;
   RenderContext(SkCanvas* c, int w, int h, double t = 0.0)
@@ -23,6 +43,11 @@ struct RenderContext
 /**
  * 주어진 시간(RenderContext::timeSec)에 따라 어떤 장면을 렌더링할 지 결정하는 Timeline 모델
  * Preview 및 Encoder 모듈에서 모두 동일한 방식으로 이미지 시퀀스를 렌더링할 수 있도록 설계된 공통 인터페이스
+ *
+ * - 클립은 트랙 단위로 관리한다. 0번은 기본 사진 트랙이고, addTrack 으로 추가한 overlay/sticker/title 트랙은 번호 순으로 위에 그려진다.
+ * - 트랙마다 시작 시간 순으로 정렬된 구간 인덱스를 만들어 두므로, 프레임마다 트랙당 O((k + 1) log n) 탐색으로 보이는 클립 k 개를 찾는다. (할당 없음)
+ * - 생성(setSegments/addTrack)이 끝난 뒤에는 읽기 전용이므로 Preview 렌더링 스레드와 export 스레드가 잠금 없이 공유한다.
+ * - 트랙은 불변 객체로 만들어 shared_ptr 로 들고 있으므로, 편집 결과(withTrack)는 바뀌지 않은 트랙을 이전 스냅샷과 공유한다.
  */
 class Timeline
 {
@@ -32,10 +57,14 @@ public:
   {
     sk_sp<SkImage> image;             // 클립에서 보여줄 이미지
     SkRect dst = SkRect::MakeEmpty(); // 이미지를 skia canvas 내에서 "어디에, 얼마나 크게" 그릴지(위치/크기)
+    sk_sp<SkImage> thumbnail;         // seek/scrub 시 원본 디코딩 전까지 대신 보여줄 저해상도 raster 이미지 (없을 수 있음)
+    sk_sp<SkImage> proxy;             // import 시점의 preview 화면 크기(dst)에 맞춰 축소해둔 raster 이미지 (원본이 더 작으면 없음)
+    std::string path;                 // 이미지 파일 경로 (프로젝트 저장용, 파일에서 읽지 않은 이미지면 빈 문자열)
+    std::shared_ptr<IFrameSource> source; // 애니메이션 이미지/비디오 클립이면 시간별 프레임 입력 (image 는 첫 프레임, 정지 이미지면 nullptr)
 
     ClipRenderData() = default;
-    ClipRenderData(sk_sp<SkImage> img, const SkRect& dstRect)
-      : image(std::move(img)), dst(dstRect) {}
+    ClipRenderData(sk_sp<SkImage> img, const SkRect& dstRect, sk_sp<SkImage> thumb = nullptr, sk_sp<SkImage> proxyImg = nullptr)
+      : image(std::move(img)), dst(dstRect), thumbnail(std::move(thumb)), proxy(std::move(proxyImg)) {}
   };
 
   // "Clip" 을 추상화한 구조체. -> 한 장의 이미지를 언제부터, 얼마나, 어디에 그릴 지 정의하는 단위
@@ -45,6 +74,8 @@ public:
     double duration = 0.0;            // 이미지를 "얼마 동안" 보여줄 지 정의 (초 단위)
     double start = 0.0;               // 이미지를 "언제부터" 보여줄 지 정의 (초 단위)
     double xfade = 0.0;               // 클립이 끝날 때 "다음 이미지로 부드럽게 바뀌는 시간"(cross fade)
+    TransitionType transition = TransitionType::Crossfade; // xfade 구간에서 다음 클립으로 넘어가는 전환 방식
+    std::shared_ptr<const ClipMotion> motion; // 클립 재생 동안 dst 에 적용할 pan/zoom 애니메이션 (nullptr 이면 고정)
 
     Segment() = default;
     Segment(ClipRenderData c,
@@ -61,31 +92,166 @@ public:
 
   /**
    * 주어진 클립 목록을 시간 순으로 재정렬한 뒤,
-   * 전체 길이(m_totalDuration) 를 재계산하는 함수
+   * 전체 길이(m_totalDuration) 를 재계산하는 함수 (기본 사진 트랙(0번)을 교체)
    */
   void setSegments(std::vector<Segment>& segs);
 
+  /**
+   * 기본 트랙 위에 그려질 트랙(overlay/sticker/title 등) 추가
+   * - 클립이 없는 시간에는 아무것도 그리지 않는다. (기본 트랙처럼 마지막 클립을 유지하지 않음)
+   * @return 추가된 트랙 번호
+   */
+  int addTrack(std::vector<Segment>& segs);
+
+  /**
+   * track 번 트랙만 segs 로 교체한 새 Timeline 반환 (이 Timeline 은 그대로)
+   * - 나머지 트랙과 오디오 클립은 복사하지 않고 공유하므로 편집 후 새 스냅샷 생성 비용은 교체한 트랙 크기에만 비례한다.
+   */
+  std::shared_ptr<Timeline> withTrack(int track, std::vector<Segment>& segs) const;
+
+  /**
+   * track 번 트랙을 편집된 클립 시퀀스로 교체한 새 Timeline 반환 (Preview 편집용)
+   * - 시퀀스를 펼치거나 정렬하지 않고 treap 을 그대로 트랙으로 공유하므로 O(1) 이며, 이후 렌더링 조회는 트랙당 O(log n) 이다.
+   * - segments(track) 를 처음 조회할 때 한 번 펼친다. (프로젝트 저장/export 준비처럼 전체 목록이 필요한 경우, O(n))
+   */
+  std::shared_ptr<Timeline> withSequence(int track, const ClipSequence& sequence) const;
+
+  // 트랙 개수 (기본 트랙 포함)
+  int trackCount() const { return (int)m_tracks.size(); };
+
+  // 트랙(track)의 클립 목록 (시작 시간 순, withSequence 로 만든 트랙이면 처음 조회할 때 펼침)
+  const std::vector<Segment>& segments(int track = 0) const { return m_tracks[track]->list(); };
+  // 트랙(track)의 클립 수 / i 번째 클립과 그 시작 시간(start) (segments() 를 펼치지 않고 조회, withSequence 트랙이면 O(log n))
+  size_t segmentCount(int track = 0) const { return m_tracks[track]->size(); };
+  const Segment& segmentAt(int track, size_t i, double& start) const;
+
   // 현재 타임라인의 "전체 길이"(초) 반환
   double totalDuration() const { return m_totalDuration; };
 
+  /**
+   * export 시 영상과 함께 믹싱할 오디오 클립 설정 (배경음악/클립별 오디오)
+   * - Timeline 은 클립 정보만 들고 있고, 실제 디코딩/믹싱은 인코더가 AudioMixer 로 스트리밍 처리한다.
+   */
+  void setAudioClips(std::vector<AudioClip> clips) { m_audioClips = std::move(clips); };
+  const std::vector<AudioClip>& audioClips() const { return m_audioClips; };
+
   /**
    * 지금 시간(ctx.timeSec)에 맞는 클립을 렌더링하는 함수.
    * 만약 곧 다음 클립으로 넘어갈 시간이면, 두 클립의 이미지를 살짝 섞어(cross fade) 부드럽게 보여줌.
+   * - 이 시간에 보이는 모든 클립을 레이어로 모아 Compositor 로 합성 (가려진 레이어 생략, 화면을 덮으면 clear 생략)
+   * - 배경 초기화도 여기서 하므로 호출부는 캔버스를 따로 clear 하지 않아도 된다.
    */
   void render(const RenderContext& ctx) const;
 
+  /**
+   * 주어진 렌더링 조건(ctx.timeSec, ctx.canvas 크기/변환)에서 화면에 그려질 클립 이미지 목록 반환 (fade 구간이면 현재/다음 클립 2장)
+   * -> seek 직후 해당 시간에 필요한 이미지만 미리 디코딩 요청하기 위해 사용
+   */
+  std::vector<sk_sp<SkImage>> imagesAt(const RenderContext& ctx) const;
+
+  /**
+   * 렌더링 조건(ctx.quality, 캔버스에 그려질 실제 픽셀 크기)에 맞는 클립 이미지 선택
+   * - Export: 원본
+   * - Preview: proxy 가 화면에 그려질 크기를 충분히 덮으면 proxy, 아니면 원본
+   * - Draft: Preview 기준으로 고른 이미지가 아직 디코딩되지 않았다면 thumbnail
+   * - motion: 클립 애니메이션 변환 (확대된 만큼 더 큰 해상도가 필요한지 판단할 때 함께 적용)
+   * - 선택된 이미지가 ctx.decodeCache 에 미리 디코딩되어 있으면 디코딩 결과를 사용
+   * (애니메이션/비디오 클립의 현재 프레임은 render() 가 clip.source 에서 따로 가져옴)
+   */
+  static sk_sp<SkImage> selectImage(const ClipRenderData& clip, const RenderContext& ctx, const SkMatrix& motion = SkMatrix::I());
+
+  /**
+   * 클립 이미지들이 차지하는 메모리 크기(byte) 집계 (여러 클립이 같은 이미지를 공유하면 한 번만 집계)
+   * - encodedBytes: 지연 디코딩 이미지가 들고 있는 압축 원본(SkData) 크기
+   * - decodedBytes: raster 이미지(원본을 미리 디코딩한 경우 / thumbnail / proxy)의 픽셀 메모리 크기
+   * -> 지연 디코딩 이미지를 그리면서 생기는 디코딩 결과는 Skia 내부 캐시에 있으므로 여기서는 집계하지 않는다.
+   * - 애니메이션/비디오 클립은 프레임 입력이 보관 중인 디코딩 프레임을 decodedBytes 에 더한다.
+   */
+  void memoryUsage(size_t& encodedBytes, size_t& decodedBytes) const;
+
   /**
    * 여러 개의 ClipRenderData를 전달받아 간단히 타임라인 생성
    * - clipDuration: 각 이미지를 몇 초 보여줄지
    * - xfade: 이미지가 바뀔 때, 두 이미지 몇 초 동안 겹쳐서 부드럽게 바꿀지
+   * - transitions: 클립 사이 전환 방식 (클립 수보다 적으면 반복 적용, 비어있으면 모두 crossfade)
+   * - motions: 클립별 pan/zoom 애니메이션 (클립 수보다 적으면 반복 적용, 비어있으면 모두 고정)
    */
-  static std::shared_ptr<Timeline> FromClipRenderData(const std::vector<ClipRenderData>& renderDataList, double clipDuration, double xfade);
+  static std::shared_ptr<Timeline> FromClipRenderData(const std::vector<ClipRenderData>& renderDataList, double clipDuration, double xfade,
+                                                      const std::vector<TransitionType>& transitions = {},
+                                                      const std::vector<std::shared_ptr<const ClipMotion>>& motions = {});
 
 private:
+  /**
+   * 트랙 하나의 클립 목록과 구간 인덱스
+   * - 클립 i 가 보이는 구간은 "자신의 재생 구간 ∪ 앞 클립의 fade 구간" 이며, 그 시작 시각(visibleStart)은 클립 순서대로 증가한다.
+   *   -> visibleStart 를 이분 탐색해 t 이전에 보이기 시작한 클립 [0, hi) 를 찾고,
+   *      그중 visibleEnd > t 인 클립을 visibleEnd 최댓값 segment tree(endTree)로 뒤에서부터 하나씩 찾는다. (하나당 O(log n))
+   *   -> 앞쪽의 아주 긴 클립이 뒤 클립 전체와 겹쳐도 사이의 끝난 클립들을 훑지 않으므로 보이는 클립 k 개에 O((k + 1) log n).
+   * - withSequence 로 만든 트랙은 클립 목록/인덱스 대신 ClipSequence 를 그대로 들고, 조회와 구간 탐색을 treap 에서 한다.
+   *   (클립 시작 시간은 Segment::start 가 아니라 startOf 로 조회)
+   */
+  struct Track
+  {
+    std::vector<Segment> segments;      // 클립 목록 (시작 시간 순, sequence 트랙이면 비어있음)
+    std::vector<double> visibleStart;   // 클립이 화면에 보이기 시작하는 시각
+    std::vector<double> visibleEnd;     // 클립이 화면에서 사라지는 시각
+    std::vector<double> endTree;        // visibleEnd 구간 최댓값 segment tree ([1]: 루트, 노드 k 의 자식 2k / 2k + 1, 잎 endLeaves 개)
+    int endLeaves = 0;                  // endTree 잎 개수 (클립 수 이상인 2의 거듭제곱, 남는 잎은 -inf)
+    std::shared_ptr<const ClipSequence> sequence; // 편집된 클립 시퀀스 (withSequence 로 만든 트랙만)
+    double endTime = 0.0;               // 트랙의 마지막 클립이 끝나는 시각
+
+    mutable std::once_flag flattenOnce;         // sequence 를 flattened 로 한 번만 펼치기 위한 flag
+    mutable std::vector<Segment> flattened;     // list() 가 처음 불릴 때 펼친 sequence (시작 시간 채움)
+
+    // 클립 목록을 넘겨받아 시간 순 정렬 후 구간 인덱스 생성
+    void build(std::vector<Segment>& segs);
+    // 클립 [0, hi) 중 visibleEnd > tSec 인 마지막 클립 번호 (없으면 -1) O(log n)
+    int lastVisibleBefore(int hi, double tSec) const;
+    // 클립 시퀀스를 그대로 트랙으로 사용 O(1)
+    void build(const ClipSequence& seq);
+
+    size_t size() const;
+    // idx 번째 클립 (시작 시간은 startOf 로 조회)
+    const Segment& at(int idx) const;
+    double startOf(int idx) const;
+    // 전체 클립 목록 (sequence 트랙이면 처음 한 번 펼침)
+    const std::vector<Segment>& list() const;
+    // 모든 클립을 순서대로 방문 (펼치지 않음)
+    void forEach(const std::function<void(const Segment&)>& fn) const;
+
+    /**
+     * 주어진 시간(tSec)에 화면에 보이는 클립 인덱스들을 시작 시간 순(아래 -> 위)으로 out 에 기록 (최대 maxCount 개)
+     * - 재생 구간에 속하는 클립 + 앞 클립의 fade 구간으로 들어오는 중인 클립
+     * - holdLast 이면 하나도 없을 때(클립 사이 빈 구간 / 끝 이후) 마지막 클립
+     * @return 기록한 개수
+     */
+    int activeAt(double tSec, int* out, int maxCount, bool holdLast) const;
+
+    // 주어진 시간(tSec)이 클립(idx)의 fade 구간에 속하는지 여부
+    bool inFadeAt(int idx, double tSec) const;
+
+    // 클립(idx)의 fade 구간 진행률 [0, 1] (fade 구간이 아니면 0)
+    double fadeProgressAt(int idx, double tSec) const;
+  };
+
   // 재구축된 클립 목록을 보고 전체 길이를 재계산
   void recomputeDuration();
 
+  // 화면에 보이는 클립 위치 (트랙 번호, 트랙 내 클립 인덱스)
+  struct ActiveRef
+  {
+    int track = 0;
+    int index = 0;
+  };
+
+  // 주어진 시간(tSec)에 화면에 보이는 모든 트랙의 클립을 아래 -> 위 순서로 기록 (트랙 0 이 가장 아래, 최대 maxCount 개)
+  int activeSegmentsAt(double tSec, ActiveRef* out, int maxCount) const;
+
+  // 주어진 시간(tSec)에 start 에 시작한 클립(seg)의 dst 에 적용할 애니메이션 변환 (애니메이션이 없으면 단위 행렬)
+  static SkMatrix motionAt(const Segment& seg, double start, double tSec);
+
 private:
-  std::vector<Segment> m_segments;          // 클립 목록
-  double m_totalDuration;                   // 전체 길이(모든 클립을 다 보면 몇 초인지)
+  std::vector<std::shared_ptr<const Track>> m_tracks{ std::make_shared<const Track>() }; // 트랙 목록 ([0]: 기본 사진 트랙, 번호가 클수록 위에 그려짐)
+  double m_totalDuration = 0.0;             // 전체 길이(모든 클립을 다 보면 몇 초인지)
+  std::vector<AudioClip> m_audioClips;      // export 시 믹싱할 오디오 클립 목록
 };
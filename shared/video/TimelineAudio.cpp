@@ -0,0 +1,95 @@
+#include "TimelineAudio.h"
+#include <algorithm> // std::min, std::lower_bound, std::rotate
+#include <cmath>     // std::abs
+
+void TimelineAudio::applyTo(Timeline& timeline) const {
+  std::vector<AudioClip> clips;
+  if (!musicPath.empty()) {
+    AudioClip music;
+    music.path = musicPath;
+    music.gain = musicGain;
+    music.fadeOutSec = musicFadeOutSec;
+    music.loop = true;
+    clips.push_back(std::move(music));
+  }
+
+  // 소리가 지정된 클립만 번호로 찾음 -> 편집마다 기본 트랙 전체를 펼치지 않음
+  const size_t segCount = timeline.segmentCount(0);
+  const size_t count = std::min(segCount, clipAudioPaths.size());
+  for (size_t i = 0; i < count; i++) {
+    if (clipAudioPaths[i].empty()) continue;
+    double start = 0.0;
+    const Timeline::Segment& seg = timeline.segmentAt(0, i, start);
+    AudioClip clip;
+    clip.path = clipAudioPaths[i];
+    clip.startSec = start;
+    clip.durationSec = seg.duration;
+    clip.gain = clipAudioGain;
+    // 앞 클립의 fade 구간에서 fade-in, 자신의 fade 구간에서 fade-out -> 영상 crossfade 와 같은 구간에서 오디오도 겹침
+    double prevStart = 0.0;
+    clip.fadeInSec = i > 0 ? timeline.segmentAt(0, i - 1, prevStart).xfade : 0.0;
+    clip.fadeOutSec = i + 1 < segCount ? seg.xfade : 0.0;
+    clips.push_back(std::move(clip));
+  }
+  clips.insert(clips.end(), fixedClips.begin(), fixedClips.end());
+  timeline.setAudioClips(std::move(clips));
+};
+
+TimelineAudio TimelineAudio::fromTimeline(const Timeline& timeline) {
+  // 파일에 저장된 시간은 applyTo 가 계산한 값 그대로이므로 부동소수 오차 정도만 허용
+  static constexpr double k_epsilon = 1e-6;
+
+  TimelineAudio audio;
+  const std::vector<Timeline::Segment>& segs = timeline.segments(0);
+  bool clipGainSet = false;
+  for (const AudioClip& clip : timeline.audioClips()) {
+    if (clip.loop && audio.musicPath.empty() && clip.startSec <= k_epsilon && clip.durationSec <= 0.0) {
+      audio.musicPath = clip.path;
+      audio.musicGain = clip.gain;
+      audio.musicFadeOutSec = clip.fadeOutSec;
+      continue;
+    }
+
+    // 시작 시간으로 기본 트랙 클립을 찾음 (segs 는 시작 시간 순)
+    auto it = std::lower_bound(segs.begin(), segs.end(), clip.startSec - k_epsilon,
+                               [](const Timeline::Segment& seg, double t) { return seg.start < t; });
+    const size_t index = (size_t)(it - segs.begin());
+    const bool matches = !clip.loop && it != segs.end()
+        && std::abs(it->start - clip.startSec) <= k_epsilon
+        && std::abs(it->duration - clip.durationSec) <= k_epsilon
+        && (!clipGainSet || clip.gain == audio.clipAudioGain)
+        && (index >= audio.clipAudioPaths.size() || audio.clipAudioPaths[index].empty());
+    if (!matches) {
+      audio.fixedClips.push_back(clip);
+      continue;
+    }
+    if (audio.clipAudioPaths.size() <= index) audio.clipAudioPaths.resize(index + 1);
+    audio.clipAudioPaths[index] = clip.path;
+    audio.clipAudioGain = clip.gain;
+    clipGainSet = true;
+  }
+  return audio;
+};
+
+void TimelineAudio::insertClip(size_t index) {
+  if (index >= clipAudioPaths.size()) return;
+  clipAudioPaths.insert(clipAudioPaths.begin() + (std::ptrdiff_t)index, std::string());
+};
+
+void TimelineAudio::eraseClip(size_t index) {
+  if (index >= clipAudioPaths.size()) return;
+  clipAudioPaths.erase(clipAudioPaths.begin() + (std::ptrdiff_t)index);
+};
+
+void TimelineAudio::moveClip(size_t from, size_t to) {
+  if (from == to || (from >= clipAudioPaths.size() && to >= clipAudioPaths.size())) return;
+  // 오디오가 없는 뒤쪽 클립과 자리를 바꾸는 경우도 있으므로 양쪽 위치가 모두 들어가도록 늘린 뒤 회전
+  clipAudioPaths.resize(std::max(clipAudioPaths.size(), std::max(from, to) + 1));
+  if (from < to) {
+    std::rotate(clipAudioPaths.begin() + (std::ptrdiff_t)from, clipAudioPaths.begin() + (std::ptrdiff_t)from + 1,
+                clipAudioPaths.begin() + (std::ptrdiff_t)to + 1);
+  } else {
+    std::rotate(clipAudioPaths.begin() + (std::ptrdiff_t)to, clipAudioPaths.begin() + (std::ptrdiff_t)from,
+                clipAudioPaths.begin() + (std::ptrdiff_t)from + 1);
+  }
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Timeline.h"
+
+// export 시 영상과 함께 믹싱할 오디오 (배경 음악 + 기본 트랙 클립별 오디오)
+struct TimelineAudio
+{
+  std::string musicPath;              // 배경 음악 WAV 경로 (비어있으면 없음, 타임라인보다 짧으면 반복)
+  float musicGain = 1.0f;             // 배경 음악 음량 배율
+  double musicFadeOutSec = 1.0;       // 타임라인 끝에서 배경 음악을 줄이는 시간(초)
+  std::vector<std::string> clipAudioPaths; // 기본 트랙 클립 순서대로 함께 재생할 WAV 경로 (빈 문자열이면 해당 클립은 무음)
+  float clipAudioGain = 1.0f;         // 클립별 오디오 음량 배율
+  std::vector<AudioClip> fixedClips;  // 기본 트랙 클립과 묶이지 않은 오디오 (프로젝트 파일에서 복원, 편집해도 배치를 바꾸지 않음)
+
+  /**
+   * 이 설정을 timeline 의 오디오 클립으로 변환해 설정 (export 작업에 넘기기 전 / 기본 트랙을 편집할 때마다 호출)
+   * - 클립별 오디오는 기본 트랙 클립의 시작 시간/길이에 맞춰 배치되며, 클립 사이 xfade 구간에서 서로 crossfade 된다.
+   * - 오디오 파일은 여기서 읽지 않고 export 시 인코더가 스트리밍으로 디코딩/믹싱한다.
+   */
+  void applyTo(Timeline& timeline) const;
+
+  /**
+   * applyTo 의 반대: timeline 의 오디오 클립(프로젝트 파일에서 복원한 Timeline 등)을 다시 편집 가능한 설정으로 변환
+   * - 반복(loop) 클립 하나를 배경 음악으로, 기본 트랙 클립과 시작/길이가 같은 클립을 그 클립의 오디오로 되돌린다.
+   * - 그 외 클립은 fixedClips 에 그대로 보관해 이후 applyTo 에서 손실되지 않도록 한다.
+   */
+  static TimelineAudio fromTimeline(const Timeline& timeline);
+
+  // 기본 트랙 편집(insert/erase/move)에 맞춰 클립별 오디오 순서를 함께 옮김 (오디오가 없는 클립 위치면 아무것도 하지 않음)
+  void insertClip(size_t index);
+  void eraseClip(size_t index);
+  void moveClip(size_t from, size_t to);
+};
@@ -0,0 +1,227 @@
+#include "Transition.h"
+#include "../logger/Logger.h"
+#include <core/SkData.h>
+#include <core/SkMatrix.h>
+#include <core/SkPaint.h>
+#include <core/SkShader.h>
+#include <effects/SkRuntimeEffect.h>
+#include <algorithm> // std::clamp
+#include <mutex>     // std::once_flag, std::call_once
+
+namespace {
+
+constexpr const char* k_logTag = "Transition";
+
+/**
+ * Dissolve : 화면을 blockSize 크기의 블록으로 나누고 블록마다 고정된 난수(n)를 부여한 뒤,
+ * 진행률이 n 을 넘어선 블록부터 다음 클립으로 바뀐다. (softness 만큼 경계를 부드럽게 섞음)
+ * - 난수는 좌표만으로 계산하므로 같은 시간이면 Preview/export 에서 같은 결과가 나온다.
+ */
+constexpr const char* k_dissolveSkSL = R"(
+uniform shader fromImage;
+uniform shader toImage;
+uniform float progress;
+uniform float blockSize;
+uniform float softness;
+
+float hash(float2 p) {
+  return fract(sin(dot(p, float2(12.9898, 78.233))) * 43758.5453);
+}
+
+half4 main(float2 coord) {
+  float n = hash(floor(coord / blockSize));
+  float t = progress * (1.0 + 2.0 * softness) - softness;
+  half mask = half(smoothstep(n - softness, n + softness, t));
+  return mix(fromImage.eval(coord), toImage.eval(coord), mask);
+}
+)";
+
+// k_dissolveSkSL 의 uniform 배치와 같아야 함
+struct DissolveUniforms
+{
+  float progress;
+  float blockSize;
+  float softness;
+};
+
+// 전환 종류별 SkSL 소스 (native 경로로 그리는 전환은 nullptr)
+const char* effectSource(TransitionType type) {
+  switch (type) {
+    case TransitionType::Dissolve: return k_dissolveSkSL;
+    default: return nullptr;
+  }
+}
+
+/**
+ * 컴파일된 SkRuntimeEffect 캐시
+ * - 전환 종류마다 처음 사용할 때 한 번만 컴파일하고(std::call_once), 이후에는 잠금 없이 같은 객체를 반환한다.
+ * - 컴파일에 실패하면 nullptr 을 캐시하여 매 프레임 재시도하지 않는다. (호출부는 crossfade 로 대체)
+ */
+sk_sp<SkRuntimeEffect> cachedEffect(TransitionType type) {
+  struct Slot
+  {
+    std::once_flag once;
+    sk_sp<SkRuntimeEffect> effect;
+  };
+  static Slot s_slots[(size_t)TransitionType::Count];
+
+  if (type >= TransitionType::Count) return nullptr;
+  Slot& slot = s_slots[(size_t)type];
+  std::call_once(slot.once, [&]() {
+    const char* src = effectSource(type);
+    if (!src) return;
+    auto [effect, error] = SkRuntimeEffect::MakeForShader(SkString(src));
+    if (!effect) {
+      Logger::error(k_logTag, "Failed to compile %s effect: %s", Transition::name(type), error.c_str());
+      return;
+    }
+    slot.effect = std::move(effect);
+  });
+  return slot.effect;
+}
+
+void drawLayer(SkCanvas* canvas, const Transition::Layer& layer, const SkSamplingOptions& sampling, float alpha = 1.0f) {
+  if (!layer.image || alpha <= 0.0f) return;
+  SkPaint paint;
+  paint.setAlphaf(alpha);
+  if (layer.transform.isIdentity()) {
+    canvas->drawImageRect(layer.image, layer.dst, sampling, &paint);
+    return;
+  }
+  // 애니메이션된 클립은 확대/이동되어도 원래 dst 영역 밖으로 그려지지 않도록 잘라냄
+  canvas->save();
+  canvas->clipRect(layer.dst);
+  canvas->concat(layer.transform);
+  canvas->drawImageRect(layer.image, layer.dst, sampling, &paint);
+  canvas->restore();
+}
+
+// 이미지를 dst 에 맞춰 그리는 셰이더 (dst 밖은 투명)
+sk_sp<SkShader> layerShader(const Transition::Layer& layer, const SkSamplingOptions& sampling) {
+  if (!layer.image || layer.dst.isEmpty()) return SkShaders::Empty();
+  const SkMatrix m = SkMatrix::Concat(layer.transform, SkMatrix::RectToRect(SkRect::Make(layer.image->bounds()), layer.dst));
+  return layer.image->makeShader(SkTileMode::kDecal, SkTileMode::kDecal, sampling, &m);
+}
+
+void drawCrossfade(SkCanvas* canvas, const Transition::Layer& from, const Transition::Layer& to, float p, const SkSamplingOptions& sampling) {
+  drawLayer(canvas, from, sampling, 1.0f - p);
+  drawLayer(canvas, to, sampling, p);
+}
+
+void drawWipe(SkCanvas* canvas, const SkRect& bounds, const Transition::Layer& from, const Transition::Layer& to, float p,
+              bool towardLeft, const SkSamplingOptions& sampling) {
+  drawLayer(canvas, from, sampling);
+
+  // 다음 클립은 진행률만큼 드러난 영역에만 그림
+  const float revealed = bounds.width() * p;
+  const SkRect clip = towardLeft ? SkRect::MakeLTRB(bounds.right() - revealed, bounds.top(), bounds.right(), bounds.bottom())
+                                 : SkRect::MakeLTRB(bounds.left(), bounds.top(), bounds.left() + revealed, bounds.bottom());
+  canvas->save();
+  canvas->clipRect(clip);
+  drawLayer(canvas, to, sampling);
+  canvas->restore();
+}
+
+void drawSlide(SkCanvas* canvas, const SkRect& bounds, const Transition::Layer& from, const Transition::Layer& to, float p,
+               bool towardLeft, const SkSamplingOptions& sampling) {
+  const float dir = towardLeft ? -1.0f : 1.0f;
+  const float offset = bounds.width() * p * dir;
+
+  canvas->save();
+  canvas->clipRect(bounds);
+  canvas->translate(offset, 0.0f);
+  drawLayer(canvas, from, sampling);
+  canvas->translate(-dir * bounds.width(), 0.0f);
+  drawLayer(canvas, to, sampling);
+  canvas->restore();
+}
+
+void drawZoom(SkCanvas* canvas, const SkRect& bounds, const Transition::Layer& from, const Transition::Layer& to, float p,
+              const SkSamplingOptions& sampling) {
+  drawLayer(canvas, to, sampling);
+
+  // 현재 클립은 화면 중심 기준으로 최대 1.5배까지 확대되며 사라짐
+  const float scale = 1.0f + 0.5f * p;
+  canvas->save();
+  canvas->clipRect(bounds);
+  canvas->translate(bounds.centerX(), bounds.centerY());
+  canvas->scale(scale, scale);
+  canvas->translate(-bounds.centerX(), -bounds.centerY());
+  drawLayer(canvas, from, sampling, 1.0f - p);
+  canvas->restore();
+}
+
+bool drawDissolve(SkCanvas* canvas, const SkRect& bounds, const Transition::Layer& from, const Transition::Layer& to, float p,
+                  const SkSamplingOptions& sampling) {
+  sk_sp<SkRuntimeEffect> effect = cachedEffect(TransitionType::Dissolve);
+  if (!effect || effect->uniformSize() != sizeof(DissolveUniforms)) return false;
+
+  // 블록 크기는 출력 해상도에 비례시켜 Preview(작은 화면)와 export(원본 해상도)에서 같은 모양이 되도록 함
+  const DissolveUniforms uniforms{ p, std::max(2.0f, bounds.width() / 48.0f), 0.08f };
+  sk_sp<SkShader> children[] = { layerShader(from, sampling), layerShader(to, sampling) };
+  sk_sp<SkShader> shader = effect->makeShader(SkData::MakeWithCopy(&uniforms, sizeof(uniforms)), children, 2);
+  if (!shader) return false;
+
+  SkPaint paint;
+  paint.setShader(std::move(shader));
+  if (from.transform.isIdentity() && to.transform.isIdentity()) {
+    canvas->drawRect(bounds, paint);
+  } else {
+    // 애니메이션된 클립이 letterbox 영역으로 번지지 않도록 두 클립의 dst 영역 안에만 그림
+    SkRect area = from.dst;
+    area.join(to.dst);
+    if (area.intersect(bounds)) canvas->drawRect(area, paint);
+  }
+  return true;
+}
+
+} // namespace
+
+void Transition::draw(TransitionType type, SkCanvas* canvas, const SkRect& bounds,
+                      const Layer& from, const Layer& to, float progress, const SkSamplingOptions& sampling) {
+  if (!canvas) return;
+  const float p = std::clamp(progress, 0.0f, 1.0f);
+
+  switch (type) {
+    case TransitionType::WipeLeft:   drawWipe(canvas, bounds, from, to, p, true, sampling); return;
+    case TransitionType::WipeRight:  drawWipe(canvas, bounds, from, to, p, false, sampling); return;
+    case TransitionType::SlideLeft:  drawSlide(canvas, bounds, from, to, p, true, sampling); return;
+    case TransitionType::SlideRight: drawSlide(canvas, bounds, from, to, p, false, sampling); return;
+    case TransitionType::Zoom:       drawZoom(canvas, bounds, from, to, p, sampling); return;
+    case TransitionType::Dissolve:
+      if (drawDissolve(canvas, bounds, from, to, p, sampling)) return;
+      break; // 셰이더를 만들 수 없으면 crossfade 로 대체
+    default:
+      break;
+  }
+  drawCrossfade(canvas, from, to, p, sampling);
+};
+
+void Transition::warmUp() {
+  for (size_t i = 0; i < (size_t)TransitionType::Count; i++) {
+    cachedEffect((TransitionType)i);
+  }
+};
+
+bool Transition::fromName(const std::string& name, TransitionType& out) {
+  for (size_t i = 0; i < (size_t)TransitionType::Count; i++) {
+    if (name == Transition::name((TransitionType)i)) {
+      out = (TransitionType)i;
+      return true;
+    }
+  }
+  return false;
+};
+
+const char* Transition::name(TransitionType type) {
+  switch (type) {
+    case TransitionType::Crossfade: return "crossfade";
+    case TransitionType::WipeLeft: return "wipeLeft";
+    case TransitionType::WipeRight: return "wipeRight";
+    case TransitionType::SlideLeft: return "slideLeft";
+    case TransitionType::SlideRight: return "slideRight";
+    case TransitionType::Zoom: return "zoom";
+    case TransitionType::Dissolve: return "dissolve";
+    default: return "unknown";
+  }
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <string>
+#include <core/SkCanvas.h>
+#include <core/SkImage.h>
+#include <core/SkMatrix.h>
+#include <core/SkRect.h>
+#include <core/SkSamplingOptions.h>
+
+// 클립과 다음 클립 사이의 장면 전환 종류
+enum class TransitionType
+{
+  Crossfade,    // 두 클립을 투명도로 섞음 (기본)
+  WipeLeft,     // 다음 클립이 오른쪽에서 왼쪽으로 닦아내듯 드러남
+  WipeRight,    // 다음 클립이 왼쪽에서 오른쪽으로 닦아내듯 드러남
+  SlideLeft,    // 현재 클립을 왼쪽으로 밀어내며 다음 클립이 들어옴
+  SlideRight,   // 현재 클립을 오른쪽으로 밀어내며 다음 클립이 들어옴
+  Zoom,         // 현재 클립이 확대되며 사라지고 다음 클립이 드러남
+  Dissolve,     // 블록 단위 노이즈 마스크로 다음 클립이 흩어지듯 나타남 (SkRuntimeEffect)
+  Count,
+};
+
+/**
+ * 장면 전환 렌더링
+ *
+ * - 전환마다 "현재 클립(from) / 다음 클립(to) / 진행률(progress)" 만 받아 캔버스에 그린다.
+ *   -> Timeline 은 fade 구간의 진행률만 계산하고 전환 방식은 모르므로, 새 전환은 여기에만 추가하면 된다.
+ * - Crossfade/Wipe/Slide/Zoom 은 canvas 변환/clip/alpha 만 쓰는 native 경로로 그린다.
+ * - Dissolve 처럼 픽셀 단위 마스크가 필요한 전환은 SkRuntimeEffect(SkSL) 셰이더로 그린다.
+ *   SkSL 은 프로세스에서 전환 종류당 한 번만 컴파일되어 캐시되며, SkRuntimeEffect 는 불변 객체이므로
+ *   Preview 렌더링 스레드와 export 작업 스레드가 잠금 없이 공유한다. (프레임마다 컴파일하지 않음)
+ */
+class Transition
+{
+public:
+  // 전환에 참여하는 클립 한 장
+  struct Layer
+  {
+    sk_sp<SkImage> image;             // 그릴 이미지 (nullptr 이면 그리지 않음)
+    SkRect dst = SkRect::MakeEmpty(); // 캔버스 내 위치/크기
+    SkMatrix transform = SkMatrix::I(); // dst 에 추가로 적용할 변환 (클립 pan/zoom 애니메이션, 결과는 dst 영역으로 잘림)
+  };
+
+  /**
+   * from -> to 전환을 progress([0, 1]) 시점으로 그림
+   * @param bounds  전환 효과가 적용될 캔버스 영역 (보통 (0, 0, width, height))
+   */
+  static void draw(TransitionType type, SkCanvas* canvas, const SkRect& bounds,
+                   const Layer& from, const Layer& to, float progress, const SkSamplingOptions& sampling);
+
+  // 모든 SkRuntimeEffect 기반 전환을 미리 컴파일 (첫 전환 프레임에서 컴파일 지연이 생기지 않도록 렌더링 시작 시 호출)
+  static void warmUp();
+
+  // 이름 <-> 종류 변환 ("crossfade", "wipeLeft", "wipeRight", "slideLeft", "slideRight", "zoom", "dissolve")
+  static bool fromName(const std::string& name, TransitionType& out);
+  static const char* name(TransitionType type);
+};
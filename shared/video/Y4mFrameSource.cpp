@@ -0,0 +1,168 @@
+#include "Y4mFrameSource.h"
+#include "ColorManagedDecoder.h"
+#include "../logger/Logger.h"
+#include "../trace/Trace.h"
+#include <core/SkBitmap.h>
+#include <algorithm> // std::clamp, std::min
+#include <cmath>     // std::floor
+#include <cstdlib>   // std::strtol
+
+namespace {
+
+constexpr size_t k_maxHeaderBytes = 1024;
+
+// '\n' 까지 한 줄 읽기 (개행 제외, 너무 길거나 EOF 면 false)
+bool readLine(std::FILE* file, std::string& line) {
+  line.clear();
+  for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+    if (c == '\n') return true;
+    if (line.size() >= k_maxHeaderBytes) return false;
+    line.push_back((char)c);
+  }
+  return false;
+}
+
+inline uint8_t clampByte(int v) { return (uint8_t)std::clamp(v, 0, 255); }
+
+} // namespace
+
+Y4mFrameSource::~Y4mFrameSource() {
+  if (m_file) {
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+};
+
+std::shared_ptr<Y4mFrameSource> Y4mFrameSource::open(const std::string& path) {
+  std::shared_ptr<Y4mFrameSource> src(new Y4mFrameSource());
+  src->m_file = std::fopen(path.c_str(), "rb");
+  if (!src->m_file) {
+    Logger::error(k_logTag, "Cannot open %s", path.c_str());
+    return nullptr;
+  }
+  if (!src->parseHeader() || !src->indexFrames()) {
+    Logger::error(k_logTag, "Unsupported y4m file: %s", path.c_str());
+    return nullptr;
+  }
+  src->m_yuv.resize(src->m_frameBytes);
+  return src;
+};
+
+bool Y4mFrameSource::parseHeader() {
+  std::string line;
+  if (!readLine(m_file, line) || line.compare(0, 10, "YUV4MPEG2 ") != 0) return false;
+
+  // 공백으로 구분된 파라미터 (첫 글자가 종류: W 너비, H 높이, F 프레임레이트, C 색 형식, 나머지는 무시)
+  int fpsNum = 0, fpsDen = 0;
+  std::string chroma = "420";
+  size_t pos = 10;
+  while (pos < line.size()) {
+    const size_t end = std::min(line.find(' ', pos), line.size());
+    const std::string token = line.substr(pos, end - pos);
+    pos = end + 1;
+    if (token.empty()) continue;
+    const char* value = token.c_str() + 1;
+    switch (token[0]) {
+      case 'W': m_width = (int)std::strtol(value, nullptr, 10); break;
+      case 'H': m_height = (int)std::strtol(value, nullptr, 10); break;
+      case 'F': {
+        char* colon = nullptr;
+        fpsNum = (int)std::strtol(value, &colon, 10);
+        fpsDen = (colon && *colon == ':') ? (int)std::strtol(colon + 1, nullptr, 10) : 1;
+        break;
+      }
+      case 'C': chroma = value; break;
+      default: break;
+    }
+  }
+  if (m_width <= 0 || m_height <= 0 || fpsNum <= 0 || fpsDen <= 0) return false;
+  m_fps = (double)fpsNum / fpsDen;
+
+  const size_t lumaBytes = (size_t)m_width * m_height;
+  // 8 bit 샘플만 지원 -> "420p10" / "444p12" 처럼 비트 깊이가 붙은 태그(16 bit 샘플)는 크기/픽셀이 달라지므로 거부
+  const bool is420 = chroma == "420" || chroma == "420jpeg" || chroma == "420paldv" || chroma == "420mpeg2";
+  if (is420) {
+    m_chroma = Chroma::C420;
+    m_frameBytes = lumaBytes + 2 * (size_t)((m_width + 1) / 2) * ((m_height + 1) / 2);
+  } else if (chroma == "444") {
+    m_chroma = Chroma::C444;
+    m_frameBytes = lumaBytes * 3;
+  } else if (chroma == "mono") {
+    m_chroma = Chroma::Mono;
+    m_frameBytes = lumaBytes;
+  } else {
+    Logger::warn(k_logTag, "Unsupported chroma format: C%s", chroma.c_str());
+    return false;
+  }
+  return true;
+};
+
+bool Y4mFrameSource::indexFrames() {
+  // "FRAME[ 파라미터]\n" + YUV 데이터 가 반복됨 -> 헤더 위치만 훑고 데이터는 건너뜀
+  std::string line;
+  while (readLine(m_file, line)) {
+    if (line.compare(0, 5, "FRAME") != 0) return false;
+    const int64_t offset = (int64_t)ftello(m_file);
+    if (fseeko(m_file, (off_t)m_frameBytes, SEEK_CUR) != 0) break;
+    m_frameOffsets.push_back(offset);
+  }
+  // 마지막 프레임이 잘린 파일이면 제외
+  if (!m_frameOffsets.empty()) {
+    fseeko(m_file, 0, SEEK_END);
+    if ((int64_t)ftello(m_file) < m_frameOffsets.back() + (int64_t)m_frameBytes) {
+      m_frameOffsets.pop_back();
+    }
+  }
+  return !m_frameOffsets.empty();
+};
+
+int Y4mFrameSource::frameIndexAt(double localSec) const {
+  if (m_frameOffsets.empty() || localSec <= 0.0) return 0;
+  // 부동소수점 오차로 프레임 경계 시각이 앞 프레임으로 떨어지지 않도록 약간 보정
+  const int index = (int)std::floor(localSec * m_fps + 1e-6);
+  return std::min(index, (int)m_frameOffsets.size() - 1);
+};
+
+sk_sp<SkImage> Y4mFrameSource::decodeFrame(int index) {
+  TRACE_SCOPE_ARG("decode", "Y4mFrameSource::decodeFrame", "frame", index);
+  if (index < 0 || index >= (int)m_frameOffsets.size()) return nullptr;
+  if (fseeko(m_file, (off_t)m_frameOffsets[index], SEEK_SET) != 0 ||
+      std::fread(m_yuv.data(), 1, m_frameBytes, m_file) != m_frameBytes) {
+    Logger::warn(k_logTag, "Frame %d read failed", index);
+    return nullptr;
+  }
+
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(ColorManagedDecoder::outputInfo(m_width, m_height, true))) return nullptr;
+
+  /**
+   * YUV -> RGBA (BT.601 limited range, 8bit 고정소수점)
+   * - 4:2:0 은 chroma 한 칸을 2x2 픽셀이 공유 (nearest)
+   */
+  const int w = m_width;
+  const int h = m_height;
+  const uint8_t* yPlane = m_yuv.data();
+  const int chromaW = (m_chroma == Chroma::C420) ? (w + 1) / 2 : (m_chroma == Chroma::C444 ? w : 0);
+  const int chromaH = (m_chroma == Chroma::C420) ? (h + 1) / 2 : (m_chroma == Chroma::C444 ? h : 0);
+  const uint8_t* uPlane = yPlane + (size_t)w * h;
+  const uint8_t* vPlane = uPlane + (size_t)chromaW * chromaH;
+  const int shift = (m_chroma == Chroma::C420) ? 1 : 0;
+
+  for (int y = 0; y < h; y++) {
+    const uint8_t* yRow = yPlane + (size_t)y * w;
+    const uint8_t* uRow = uPlane + (size_t)(y >> shift) * chromaW;
+    const uint8_t* vRow = vPlane + (size_t)(y >> shift) * chromaW;
+    uint8_t* out = static_cast<uint8_t*>(bitmap.getAddr(0, y));
+    for (int x = 0; x < w; x++) {
+      const int c = 298 * (yRow[x] - 16);
+      const int d = (m_chroma == Chroma::Mono) ? 0 : uRow[x >> shift] - 128;
+      const int e = (m_chroma == Chroma::Mono) ? 0 : vRow[x >> shift] - 128;
+      out[4 * x + 0] = clampByte((c + 409 * e + 128) >> 8);
+      out[4 * x + 1] = clampByte((c - 100 * d - 208 * e + 128) >> 8);
+      out[4 * x + 2] = clampByte((c + 516 * d + 128) >> 8);
+      out[4 * x + 3] = 255;
+    }
+  }
+  bitmap.setImmutable();
+  return SkImages::RasterFromBitmap(bitmap);
+};
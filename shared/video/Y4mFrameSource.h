@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PrefetchFrameSource.h"
+
+/**
+ * 무압축 YUV4MPEG2(*.y4m) 비디오 클립 입력
+ *
+ * - 코덱 없이 파일에서 프레임을 바로 읽을 수 있으므로 Linux 헤드리스 환경(batch_render)에서도 비디오 클립 경로를 검증할 수 있다.
+ *   (CpuEncoder 의 출력 형식과 같으므로 export 결과를 그대로 다른 Timeline 의 클립으로 다시 사용할 수 있다)
+ * - 열 때 FRAME 헤더 위치만 색인하고, 프레임은 요청/prefetch 될 때 한 장씩 읽어 RGBA(출력 색공간)로 변환한다.
+ * - 지원 형식: 8bit 4:2:0 (C420 / C420jpeg / C420mpeg2 / C420paldv), 4:4:4 (C444), 흑백 (Cmono)
+ *   YUV -> RGB 는 BT.601 limited range 로 변환한다. (CpuEncoder 의 RGB -> YUV 변환과 같은 기준)
+ * - 클립 시작 기준 경과 시간은 헤더의 frame rate 로 프레임 번호가 되며, 끝난 뒤에는 마지막 프레임을 유지한다.
+ */
+class Y4mFrameSource : public PrefetchFrameSource
+{
+public:
+  ~Y4mFrameSource() override;
+
+  // 파일을 열고 헤더/프레임 위치를 읽음 (지원하지 않는 형식이면 nullptr)
+  static std::shared_ptr<Y4mFrameSource> open(const std::string& path);
+
+  int width() const override { return m_width; };
+  int height() const override { return m_height; };
+  int frameCount() const override { return (int)m_frameOffsets.size(); };
+  int frameIndexAt(double localSec) const override;
+
+  // 초당 프레임 수
+  double fps() const { return m_fps; };
+  // 전체 길이(초)
+  double duration() const { return m_fps > 0.0 ? frameCount() / m_fps : 0.0; };
+
+protected:
+  sk_sp<SkImage> decodeFrame(int index) override;
+
+private:
+  Y4mFrameSource() = default;
+
+  // 스트림 헤더 파싱 + FRAME 위치 색인
+  bool parseHeader();
+  bool indexFrames();
+
+private:
+  enum class Chroma
+  {
+    C420,                             // U/V 가 가로/세로 절반
+    C444,                             // U/V 가 Y 와 같은 크기
+    Mono,                             // Y 만 있음
+  };
+
+  std::FILE* m_file = nullptr;
+  int m_width = 0;
+  int m_height = 0;
+  double m_fps = 0.0;
+  Chroma m_chroma = Chroma::C420;
+  size_t m_frameBytes = 0;            // 프레임 하나의 YUV byte 크기
+  std::vector<int64_t> m_frameOffsets; // 프레임별 YUV 데이터 시작 위치 (FRAME 헤더 다음)
+  std::vector<uint8_t> m_yuv;         // 파일에서 읽은 프레임 버퍼 (decodeFrame 에서만 사용)
+
+private:
+  static constexpr const char* k_logTag = "Y4mFrameSource";
+};
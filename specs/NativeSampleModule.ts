@@ -7,9 +7,30 @@ export interface Spec extends TurboModule {
     clipDurSec: number,
     xfadeSec: number,
   ) => void;
+  // 다음 setImageSequence 부터 적용할 클립 사이 전환 방식
+  // ("crossfade" | "wipeLeft" | "wipeRight" | "slideLeft" | "slideRight" | "zoom" | "dissolve", 클립 수보다 적으면 반복 적용)
+  readonly setTransitions: (names: string[]) => void;
+  // 다음 setImageSequence 부터 클립마다 Ken Burns(천천히 확대/축소, pan) 애니메이션 적용 여부
+  readonly setKenBurnsEnabled: (enabled: boolean) => void;
+  // 다음 setImageSequence 부터 export 결과에 함께 기록할 배경 음악(WAV) 경로와 음량 (빈 문자열이면 없음, Preview 에서는 재생하지 않음)
+  readonly setBackgroundMusic: (path: string, gain: number) => void;
+  // 현재 Timeline 을 바이너리 프로젝트 파일로 저장 / 프로젝트 파일에서 복원 (setImageSequence 대신 사용, 성공 여부 반환)
+  readonly saveProject: (path: string) => boolean;
+  readonly loadProject: (path: string) => boolean;
+  // 현재 Timeline 의 사진 클립 편집 (바뀐 클립만 다시 읽고 재생 위치 유지, 성공 여부 반환)
+  // - insertClip: index 위치에 이미지 추가 (길이/전환은 가장 최근 setImageSequence 값 사용)
+  // - retimeClip: 클립 길이와 다음 클립으로 넘어가는 전환 길이(초) 변경
+  // - replaceClip: 길이/전환/애니메이션은 유지하고 이미지만 교체
+  readonly insertClip: (index: number, path: string) => boolean;
+  readonly removeClip: (index: number) => boolean;
+  readonly moveClip: (from: number, to: number) => boolean;
+  readonly retimeClip: (index: number, durationSec: number, xfadeSec: number) => boolean;
+  readonly replaceClip: (index: number, path: string) => boolean;
+  readonly getClipCount: () => number;
   readonly previewPlay: () => void;
   readonly previewPause: () => void;
   readonly previewStop: () => void;
+  readonly previewSeek: (timeSec: number) => void;
   readonly getTimelineDuration: () => number;
 
   // Timeline 기반 Encode 제어 API
@@ -21,10 +42,57 @@ export interface Spec extends TurboModule {
     mime: string,
     outputPath: string,
   ) => void;
+  readonly startEncodingRenditions: (
+    widths: number[],
+    heights: number[],
+    bitrates: number[],
+    outputPaths: string[],
+    fps: number,
+    mime: string,
+  ) => void;
   readonly cancelEncoding: () => void;
   readonly isEncoding: () => boolean;
   readonly getLastEncodedPath: () => string;
   readonly getEncodingProgress: () => number;
+
+  // Export 작업 대기열 API (작업 ID 기반, priority 가 클수록 먼저 실행)
+  readonly submitExportJob: (
+    widths: number[],
+    heights: number[],
+    bitrates: number[],
+    outputPaths: string[],
+    fps: number,
+    mime: string,
+    priority: number,
+  ) => number;
+  readonly cancelExportJob: (jobId: number) => boolean;
+  readonly getExportJobStatus: (jobId: number) => string;
+  readonly getExportJobProgress: (jobId: number) => number;
+  readonly getExportJobOutputPaths: (jobId: number) => string[];
+  readonly setMaxConcurrentExports: (maxConcurrent: number) => void;
+
+  // 현재 타임라인의 timeSec 장면을 width x height 로 렌더링한 픽셀 (ArrayBuffer, 행 여백 없는 불투명 RGBA, 복사 없이 네이티브 버퍼를 노출)
+  // 렌더링할 수 없으면 byteLength 가 0. 버퍼는 GC 될 때 엔진 풀로 반환되므로 반복 호출해도 매번 할당하지 않음
+  readonly renderFrameToBuffer: (timeSec: number, width: number, height: number) => Object;
+
+  // 메모리 사용량 조회 (byte 단위: encodedBytes, decodedBytes, renderTargetBytes, cacheBytes, totalBytes, budgetBytes)
+  readonly getMemoryStats: () => Object;
+  // 메모리 회수 (Android ComponentCallbacks2.TRIM_MEMORY_* 값)
+  readonly trimMemory: (level: number) => void;
+  // 공용 작업 스레드 풀 통계 { workerCount, previewCritical, export, background }
+  // (QoS 별: queued, running, completed, cancelled, avgLatencyMs, maxLatencyMs, avgRunMs)
+  readonly getTaskStats: () => Object;
+
+  // 엔진 이벤트 listener 등록 (polling 대체). 이벤트 배열로 호출됨:
+  // { type: 'exportProgress' | 'exportCompleted' | 'exportFailed' | 'exportCancelled' | 'previewTime' | 'importProgress',
+  //   jobId, progress, outputPaths (export) / timeSec (previewTime) / done, total (importProgress) }
+  readonly setEventListener: (listener: (events: Object[]) => void) => void;
+  // 진행률/재생 위치/import 진행 이벤트 최대 전달 빈도(Hz, 기본 10). 완료/실패/취소 이벤트는 항상 즉시 전달
+  readonly setEventRate: (hz: number) => void;
+
+  // trace event 기록 (stopTracing 시 outputPath 에 Chrome/Perfetto JSON 저장, 성공 여부 반환)
+  readonly startTracing: () => void;
+  readonly stopTracing: (outputPath: string) => boolean;
 }
 
 export default TurboModuleRegistry.getEnforcing<Spec>('NativeSampleModule');
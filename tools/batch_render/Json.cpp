@@ -0,0 +1,217 @@
+#include "Json.h"
+#include <cstdlib> // std::strtod
+#include <cstdint>
+
+// 재귀 하강 파서 (JsonValue 의 private 멤버를 직접 채움)
+class JsonParser
+{
+public:
+  explicit JsonParser(const std::string& text) : m_text(text) {};
+
+  bool parseDocument(JsonValue& out, std::string& error) {
+    skipWhitespace();
+    if (!parseValue(out, 0)) {
+      error = m_error + " (offset " + std::to_string(m_pos) + ")";
+      return false;
+    }
+    skipWhitespace();
+    if (m_pos != m_text.size()) {
+      error = "trailing characters (offset " + std::to_string(m_pos) + ")";
+      return false;
+    }
+    return true;
+  };
+
+private:
+  bool parseValue(JsonValue& out, int depth) {
+    if (depth > k_maxDepth) return fail("nesting too deep");
+    if (m_pos >= m_text.size()) return fail("unexpected end of input");
+
+    const char c = m_text[m_pos];
+    if (c == '{') return parseObject(out, depth);
+    if (c == '[') return parseArray(out, depth);
+    if (c == '"') {
+      out.m_type = JsonValue::Type::String;
+      return parseString(out.m_string);
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) return parseNumber(out);
+    if (consumeLiteral("true"))  { out.m_type = JsonValue::Type::Bool; out.m_bool = true;  return true; }
+    if (consumeLiteral("false")) { out.m_type = JsonValue::Type::Bool; out.m_bool = false; return true; }
+    if (consumeLiteral("null"))  { out.m_type = JsonValue::Type::Null; return true; }
+    return fail("unexpected character");
+  };
+
+  bool parseObject(JsonValue& out, int depth) {
+    out.m_type = JsonValue::Type::Object;
+    m_pos++; // '{'
+    skipWhitespace();
+    if (peek() == '}') { m_pos++; return true; }
+
+    for (;;) {
+      skipWhitespace();
+      std::string key;
+      if (peek() != '"' || !parseString(key)) return fail("expected object key");
+      skipWhitespace();
+      if (peek() != ':') return fail("expected ':'");
+      m_pos++;
+      skipWhitespace();
+      if (!parseValue(out.m_members[key], depth + 1)) return false;
+      skipWhitespace();
+      if (peek() == ',') { m_pos++; continue; }
+      if (peek() == '}') { m_pos++; return true; }
+      return fail("expected ',' or '}'");
+    }
+  };
+
+  bool parseArray(JsonValue& out, int depth) {
+    out.m_type = JsonValue::Type::Array;
+    m_pos++; // '['
+    skipWhitespace();
+    if (peek() == ']') { m_pos++; return true; }
+
+    for (;;) {
+      skipWhitespace();
+      out.m_items.emplace_back();
+      if (!parseValue(out.m_items.back(), depth + 1)) return false;
+      skipWhitespace();
+      if (peek() == ',') { m_pos++; continue; }
+      if (peek() == ']') { m_pos++; return true; }
+      return fail("expected ',' or ']'");
+    }
+  };
+
+  bool parseString(std::string& out) {
+    m_pos++; // '"'
+    while (m_pos < m_text.size()) {
+      const char c = m_text[m_pos++];
+      if (c == '"') return true;
+      if ((unsigned char)c < 0x20) return fail("control character in string");
+      if (c != '\\') { out.push_back(c); continue; }
+
+      if (m_pos >= m_text.size()) break;
+      const char e = m_text[m_pos++];
+      switch (e) {
+        case '"':  out.push_back('"');  break;
+        case '\\': out.push_back('\\'); break;
+        case '/':  out.push_back('/');  break;
+        case 'b':  out.push_back('\b'); break;
+        case 'f':  out.push_back('\f'); break;
+        case 'n':  out.push_back('\n'); break;
+        case 'r':  out.push_back('\r'); break;
+        case 't':  out.push_back('\t'); break;
+        case 'u': {
+          uint32_t cp = 0;
+          if (!parseHex4(cp)) return fail("invalid \\u escape");
+          // surrogate pair 결합
+          if (cp >= 0xD800 && cp <= 0xDBFF && m_text.compare(m_pos, 2, "\\u") == 0) {
+            m_pos += 2;
+            uint32_t low = 0;
+            if (!parseHex4(low) || low < 0xDC00 || low > 0xDFFF) return fail("invalid surrogate pair");
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+          }
+          appendUtf8(out, cp);
+          break;
+        }
+        default:
+          return fail("invalid escape");
+      }
+    }
+    return fail("unterminated string");
+  };
+
+  bool parseNumber(JsonValue& out) {
+    const char* begin = m_text.c_str() + m_pos;
+    char* end = nullptr;
+    const double v = std::strtod(begin, &end);
+    if (end == begin) return fail("invalid number");
+    m_pos += (size_t)(end - begin);
+    out.m_type = JsonValue::Type::Number;
+    out.m_number = v;
+    return true;
+  };
+
+  bool parseHex4(uint32_t& out) {
+    if (m_pos + 4 > m_text.size()) return false;
+    out = 0;
+    for (int i = 0; i < 4; i++) {
+      const char h = m_text[m_pos++];
+      out <<= 4;
+      if (h >= '0' && h <= '9') out |= (uint32_t)(h - '0');
+      else if (h >= 'a' && h <= 'f') out |= (uint32_t)(h - 'a' + 10);
+      else if (h >= 'A' && h <= 'F') out |= (uint32_t)(h - 'A' + 10);
+      else return false;
+    }
+    return true;
+  };
+
+  static void appendUtf8(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+      out.push_back((char)cp);
+    } else if (cp < 0x800) {
+      out.push_back((char)(0xC0 | (cp >> 6)));
+      out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      out.push_back((char)(0xE0 | (cp >> 12)));
+      out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else {
+      out.push_back((char)(0xF0 | (cp >> 18)));
+      out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+      out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+  };
+
+  bool consumeLiteral(const char* lit) {
+    const std::string s(lit);
+    if (m_text.compare(m_pos, s.size(), s) != 0) return false;
+    m_pos += s.size();
+    return true;
+  };
+
+  void skipWhitespace() {
+    while (m_pos < m_text.size() &&
+           (m_text[m_pos] == ' ' || m_text[m_pos] == '\t' || m_text[m_pos] == '\n' || m_text[m_pos] == '\r')) {
+      m_pos++;
+    }
+  };
+
+  char peek() const { return m_pos < m_text.size() ? m_text[m_pos] : '\0'; };
+
+  bool fail(const char* msg) {
+    if (m_error.empty()) m_error = msg;
+    return false;
+  };
+
+private:
+  const std::string& m_text;
+  size_t m_pos = 0;
+  std::string m_error;
+
+  static constexpr int k_maxDepth = 64;
+};
+
+bool JsonValue::parse(const std::string& text, JsonValue& out, std::string& error) {
+  out = JsonValue();
+  JsonParser parser(text);
+  return parser.parseDocument(out, error);
+};
+
+bool JsonValue::asBool(bool fallback) const {
+  return m_type == Type::Bool ? m_bool : fallback;
+};
+
+double JsonValue::asNumber(double fallback) const {
+  return m_type == Type::Number ? m_number : fallback;
+};
+
+std::string JsonValue::asString(const std::string& fallback) const {
+  return m_type == Type::String ? m_string : fallback;
+};
+
+const JsonValue& JsonValue::operator[](const std::string& key) const {
+  static const JsonValue s_null;
+  if (m_type != Type::Object) return s_null;
+  auto it = m_members.find(key);
+  return it != m_members.end() ? it->second : s_null;
+};
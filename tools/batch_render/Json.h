@@ -0,0 +1,46 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+/**
+ * 배치 렌더링 manifest 를 읽기 위한 최소한의 JSON 값/파서
+ * - RFC 8259 의 객체/배열/문자열/숫자/true/false/null 을 지원한다. (\u 이스케이프는 UTF-8 로 변환)
+ * - manifest 크기가 작으므로 성능보다 단순함을 우선한다.
+ */
+class JsonValue
+{
+public:
+  enum class Type { Null, Bool, Number, String, Array, Object };
+
+  JsonValue() = default;
+
+public:
+  // 문자열 전체를 파싱. 실패 시 false 와 함께 error 에 위치/원인 기록
+  static bool parse(const std::string& text, JsonValue& out, std::string& error);
+
+  Type type() const { return m_type; };
+  bool isNull() const { return m_type == Type::Null; };
+  bool isArray() const { return m_type == Type::Array; };
+  bool isObject() const { return m_type == Type::Object; };
+
+  // 타입이 맞지 않으면 fallback 반환
+  bool asBool(bool fallback = false) const;
+  double asNumber(double fallback = 0.0) const;
+  std::string asString(const std::string& fallback = std::string()) const;
+
+  // 배열 원소 / 객체 멤버 조회 (없으면 Null 값 참조)
+  const std::vector<JsonValue>& items() const { return m_items; };
+  const JsonValue& operator[](const std::string& key) const;
+
+private:
+  friend class JsonParser;
+
+  Type m_type = Type::Null;
+  bool m_bool = false;
+  double m_number = 0.0;
+  std::string m_string;
+  std::vector<JsonValue> m_items;                  // Array 원소
+  std::map<std::string, JsonValue> m_members;      // Object 멤버
+};
@@ -0,0 +1,111 @@
+#include "Manifest.h"
+#include "Json.h"
+#include <fstream>
+#include <sstream>
+#include <algorithm> // std::max
+
+// manifest 파일 위치 기준으로 상대 경로를 절대/작업 디렉터리 기준 경로로 변환
+static std::string resolvePath(const std::string& baseDir, const std::string& p) {
+  if (p.empty() || p[0] == '/' || baseDir.empty()) return p;
+  return baseDir + "/" + p;
+}
+
+bool loadManifest(const std::string& path, BatchManifest& out, std::string& error) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    error = "cannot open manifest: " + path;
+    return false;
+  }
+  std::stringstream ss;
+  ss << in.rdbuf();
+
+  JsonValue root;
+  if (!JsonValue::parse(ss.str(), root, error)) {
+    error = "manifest parse error: " + error;
+    return false;
+  }
+  if (!root.isObject() || !root["jobs"].isArray()) {
+    error = "manifest must be an object with a \"jobs\" array";
+    return false;
+  }
+
+  const size_t slash = path.find_last_of('/');
+  const std::string baseDir = (slash == std::string::npos) ? std::string() : path.substr(0, slash);
+
+  out = BatchManifest();
+  out.concurrency = std::max(0, (int)root["concurrency"].asNumber(0));
+  out.cacheBudgetMB = (size_t)std::max(1.0, root["cacheBudgetMB"].asNumber((double)out.cacheBudgetMB));
+
+  const auto& jobs = root["jobs"].items();
+  for (size_t i = 0; i < jobs.size(); i++) {
+    const JsonValue& j = jobs[i];
+    const JsonValue& o = j["output"];
+    if (!j.isObject() || !(j["images"].isArray() || !j["project"].asString().empty()) || !o.isObject() || o["path"].asString().empty()) {
+      error = "job " + std::to_string(i) + ": \"images\" array (or \"project\") and \"output.path\" are required";
+      return false;
+    }
+
+    BatchJob job;
+    if (!j["project"].asString().empty()) {
+      job.project = resolvePath(baseDir, j["project"].asString());
+    }
+    for (const auto& img : j["images"].items()) {
+      job.images.push_back(resolvePath(baseDir, img.asString()));
+    }
+    job.clipDurSec = j["clipDurSec"].asNumber(job.clipDurSec);
+    job.xfadeSec = j["xfadeSec"].asNumber(job.xfadeSec);
+    std::vector<std::string> transitionNames;
+    if (j["transitions"].isArray()) {
+      for (const auto& t : j["transitions"].items()) transitionNames.push_back(t.asString());
+    } else if (!j["transitions"].asString().empty()) {
+      transitionNames.push_back(j["transitions"].asString());
+    }
+    for (const auto& name : transitionNames) {
+      TransitionType type = TransitionType::Crossfade;
+      if (!Transition::fromName(name, type)) {
+        error = "job " + std::to_string(i) + ": unknown transition \"" + name + "\"";
+        return false;
+      }
+      job.transitions.push_back(type);
+    }
+    job.kenBurns = j["kenBurns"].asBool(false);
+    for (const auto& o : j["overlays"].items()) {
+      const JsonValue& r = o["rect"];
+      if (!o.isObject() || o["image"].asString().empty() || !r.isArray() || r.items().size() != 4) {
+        error = "job " + std::to_string(i) + ": overlay needs \"image\" and \"rect\": [x, y, width, height]";
+        return false;
+      }
+      OverlayClip overlay;
+      overlay.path = resolvePath(baseDir, o["image"].asString());
+      overlay.startSec = o["startSec"].asNumber(0.0);
+      overlay.durationSec = o["durationSec"].asNumber(job.clipDurSec);
+      overlay.rect = SkRect::MakeXYWH((float)r.items()[0].asNumber(0), (float)r.items()[1].asNumber(0),
+                                      (float)r.items()[2].asNumber(0), (float)r.items()[3].asNumber(0));
+      job.overlays.push_back(std::move(overlay));
+    }
+    const JsonValue& music = j["music"];
+    const std::string musicPath = music.isObject() ? music["path"].asString() : music.asString();
+    if (!musicPath.empty()) {
+      job.audio.musicPath = resolvePath(baseDir, musicPath);
+      job.audio.musicGain = (float)music["gain"].asNumber(1.0);
+      job.audio.musicFadeOutSec = music["fadeOutSec"].asNumber(job.audio.musicFadeOutSec);
+    }
+    for (const auto& a : j["clipAudio"].items()) {
+      job.audio.clipAudioPaths.push_back(a.asString().empty() ? std::string() : resolvePath(baseDir, a.asString()));
+    }
+    job.audio.clipAudioGain = (float)j["clipAudioGain"].asNumber(1.0);
+    job.priority = (int)j["priority"].asNumber(0);
+    job.output.outputPath = resolvePath(baseDir, o["path"].asString());
+    job.output.width = (int)o["width"].asNumber(job.output.width);
+    job.output.height = (int)o["height"].asNumber(job.output.height);
+    job.output.fps = (int)o["fps"].asNumber(job.output.fps);
+    job.name = j["name"].asString(job.output.outputPath);
+
+    if ((job.images.empty() && job.project.empty()) || job.output.width <= 0 || job.output.height <= 0 || job.output.fps <= 0) {
+      error = "job " + std::to_string(i) + " (" + job.name + "): invalid images/output settings";
+      return false;
+    }
+    out.jobs.push_back(std::move(job));
+  }
+  return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "../../shared/encoder/EncoderConfig.h"
+#include "../../shared/engine/EngineCore.h"
+#include "../../shared/video/TimelineAudio.h"
+#include "../../shared/video/Transition.h"
+
+/**
+ * 배치 렌더링 manifest (JSON)
+ *
+ * {
+ *   "concurrency": 4,                  // 동시에 렌더링할 작업 수 (생략/0 이면 CPU 코어 수 - 2, 최대도 같음)
+ *   "cacheBudgetMB": 256,              // 작업 간 공유 디코딩 캐시 크기
+ *   "jobs": [
+ *     {
+ *       "name": "trip",                // 리포트에 표시할 이름 (생략 시 출력 파일 경로)
+ *       "images": ["a.jpg", "b.jpg"],  // 이미지 경로 (상대 경로는 manifest 파일 위치 기준)
+ *       "project": "trip.skproj",      // images 대신 앱에서 저장한 프로젝트 파일 사용 (clipDurSec/xfadeSec/transitions/kenBurns 무시, 생략 가능)
+ *       "clipDurSec": 3.0,             // 이미지 한 장을 보여줄 시간
+ *       "xfadeSec": 0.5,               // 이미지 사이 전환 시간
+ *       "transitions": ["dissolve"],   // 전환 방식 (클립 수보다 적으면 반복, 생략 시 crossfade. 문자열 하나도 허용)
+ *       "kenBurns": true,              // 클립마다 Ken Burns(pan/zoom) 애니메이션 적용 (생략 시 false)
+ *       "overlays": [                  // 사진 위에 얹을 이미지 (sticker/title 등, 생략 가능)
+ *         { "image": "logo.png", "startSec": 0, "durationSec": 5, "rect": [20, 20, 200, 80] }  // rect: x, y, width, height (출력 px)
+ *       ],
+ *       "music": { "path": "bgm.wav", "gain": 0.8, "fadeOutSec": 1.0 },  // 배경 음악 (WAV, 짧으면 반복. 경로 문자열만 써도 됨, 생략 가능)
+ *       "clipAudio": ["a.wav", ""],    // 클립 순서대로 함께 재생할 WAV (빈 문자열이면 무음, 생략 가능)
+ *       "clipAudioGain": 1.0,          // 클립 오디오 음량 배율
+ *       "priority": 0,                 // 클수록 먼저 렌더링
+ *       "output": { "path": "out/trip.y4m", "width": 1280, "height": 720, "fps": 30 }  // 오디오가 있으면 out/trip.wav 도 기록
+ *     }
+ *   ]
+ * }
+ */
+struct BatchJob
+{
+  std::string name;                     // 리포트 표시 이름
+  std::vector<std::string> images;      // 이미지 경로 목록
+  std::string project;                  // 프로젝트 파일 경로 (있으면 images 대신 사용)
+  double clipDurSec = 3.0;              // 클립 길이(초)
+  double xfadeSec = 0.5;                // 전환 길이(초)
+  std::vector<TransitionType> transitions; // 전환 방식 (비어있으면 crossfade)
+  bool kenBurns = false;                // Ken Burns 애니메이션 적용 여부
+  std::vector<OverlayClip> overlays;    // overlay 트랙에 얹을 이미지 목록
+  TimelineAudio audio;                  // 배경 음악 / 클립별 오디오
+  int priority = 0;                     // 우선순위
+  EncoderConfig output;                 // 출력 설정 (해상도/fps/경로)
+};
+
+struct BatchManifest
+{
+  int concurrency = 0;                  // 동시 작업 수 (0 이면 TaskScheduler::exportCapacity())
+  size_t cacheBudgetMB = 256;           // 공유 디코딩 캐시 크기(MB)
+  std::vector<BatchJob> jobs;           // 작업 목록
+};
+
+// manifest 파일을 읽어 BatchManifest 로 변환 (실패 시 error 에 원인 기록)
+bool loadManifest(const std::string& path, BatchManifest& out, std::string& error);
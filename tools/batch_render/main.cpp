@@ -0,0 +1,195 @@
+/**
+ * batch_render : 서버(Linux)용 헤드리스 슬라이드쇼 배치 렌더링 도구
+ *
+ * 사용법:
+ *   batch_render <manifest.json> [--concurrency N] [--log-file PATH] [--trace PATH]
+ *
+ * - manifest 의 작업들을 EngineCore(싱글톤/JSI/Android surface 와 무관한 엔진 코어)로 렌더링한다.
+ * - 렌더링은 CPU(Skia raster) 백엔드의 CpuEncoder 를 사용하며 결과는 .y4m(YUV4MPEG2) 로 기록된다.
+ *   manifest 에 배경 음악/클립 오디오가 있으면 믹싱 결과를 같은 이름의 .wav 로 함께 기록한다.
+ * - 작업들은 작업 스레드 풀이 동시에 실행할 수 있는 export 수(CPU 코어 수 - 2)만큼 동시에 실행되며, 같은 이미지를 쓰는 작업들은 공유 디코딩 캐시로 디코딩 결과를 공유한다.
+ * - 엔진 로그는 기본적으로 stdout 으로 출력되며, --log-file 을 지정하면 해당 파일에 이어서 기록한다.
+ * - --trace 를 지정하면 import/render/인코딩 구간을 Chrome trace event JSON 으로 기록한다. (ui.perfetto.dev 에서 열람)
+ * - 모든 작업이 끝나면 작업별 소요 시간/처리량(fps)과 캐시/메모리 통계를 출력한다. 실패한 작업이 있으면 종료 코드 1.
+ *   (메모리 통계는 Critical 회수 전/후를 함께 출력하여 MemoryBudget 의 회수 동작을 확인할 수 있다)
+ */
+#include "Manifest.h"
+#include "../../shared/engine/EngineCore.h"
+#include "../../shared/encoder/cpu/CpuEncoder.h"
+#include "../../shared/logger/Logger.h"
+#include "../../shared/trace/Trace.h"
+#include "../../shared/task/TaskScheduler.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <algorithm>
+
+namespace {
+
+// 작업별 실행 결과 기록용
+struct JobRun
+{
+  int jobId = -1;           // EngineCore export 작업 ID (-1 이면 준비 단계에서 실패)
+  int frames = 0;           // 렌더링할 총 프레임 수
+  double prepareSec = 0.0;  // 이미지 로드/Timeline 생성에 걸린 시간
+};
+
+// CPU 백엔드 인코더 팩토리 (EngineCore 의 export 작업 스레드에서 호출됨)
+std::shared_ptr<IEncoder> createCpuEncoder(const std::vector<EncoderConfig>& configs, std::shared_ptr<Timeline> timeline) {
+  if (configs.size() != 1) {
+    std::fprintf(stderr, "CPU backend supports exactly one output per job\n");
+    return nullptr;
+  }
+  auto encoder = std::make_shared<CpuEncoder>();
+  encoder->setTimeline(std::move(timeline));
+  if (!encoder->prepare(configs.front())) {
+    encoder->release();
+    return nullptr;
+  }
+  return encoder;
+}
+
+void printMemoryStats(const char* label, const MemoryStats& stats) {
+  const double mb = 1024.0 * 1024.0;
+  std::printf("memory %-7s: total %.1f MB / budget %.1f MB (", label, stats.totalBytes / mb, stats.budgetBytes / mb);
+  for (size_t c = 0; c < (size_t)MemoryCategory::Count; c++) {
+    std::printf("%s%s %.1f MB", c ? ", " : "", MemoryBudget::categoryName((MemoryCategory)c), stats.bytes[c] / mb);
+  }
+  std::printf(")\n");
+}
+
+void printUsage(const char* argv0) {
+  std::fprintf(stderr, "usage: %s <manifest.json> [--concurrency N] [--log-file PATH] [--trace PATH]\n", argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string manifestPath;
+  std::string tracePath;
+  int concurrencyOverride = 0;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--concurrency") == 0 && i + 1 < argc) {
+      concurrencyOverride = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--log-file") == 0 && i + 1 < argc) {
+      if (!Logger::setLogFile(argv[++i])) {
+        std::fprintf(stderr, "cannot open log file: %s\n", argv[i]);
+        return 2;
+      }
+    } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (argv[i][0] == '-') {
+      printUsage(argv[0]);
+      return 2;
+    } else {
+      manifestPath = argv[i];
+    }
+  }
+  if (manifestPath.empty()) {
+    printUsage(argv[0]);
+    return 2;
+  }
+
+  BatchManifest manifest;
+  std::string error;
+  if (!loadManifest(manifestPath, manifest, error)) {
+    std::fprintf(stderr, "%s\n", error.c_str());
+    return 2;
+  }
+
+  // 동시 작업 수: 명령행 > manifest > 작업 스레드 풀의 export 용량
+  // (export 는 TaskScheduler 의 Export 슬롯에서 실행되므로 그보다 많이 지정해도 스레드를 기다리기만 함)
+  const int capacity = TaskScheduler::instance().exportCapacity();
+  int concurrency = concurrencyOverride > 0 ? concurrencyOverride : manifest.concurrency;
+  if (concurrency <= 0 || concurrency > capacity) {
+    concurrency = capacity;
+  }
+
+  if (!tracePath.empty()) {
+    TRACE_THREAD_NAME("Main");
+    Trace::start();
+  }
+
+  EngineCore core(&createCpuEncoder, concurrency, manifest.cacheBudgetMB * 1024 * 1024);
+  const auto wallStart = std::chrono::steady_clock::now();
+
+  /**
+   * 작업 준비(이미지 디코딩 + Timeline 생성)는 작업마다 TaskScheduler 의 Background 작업으로 등록해 풀에서 병렬로 수행하고,
+   * 준비가 끝난 작업부터 바로 export 대기열에 넣는다. -> 디코딩과 렌더링이 서로 겹쳐서 진행됨
+   * (Background 는 Export 와 실행 슬롯을 나눠 쓰므로 준비 작업이 export 스레드를 따로 늘리지 않음, 메인 스레드는 준비 완료만 기다림)
+   */
+  std::vector<JobRun> runs(manifest.jobs.size());
+  std::vector<std::future<void>> prepared;
+  prepared.reserve(manifest.jobs.size());
+  for (size_t i = 0; i < manifest.jobs.size(); i++) {
+    auto done = std::make_shared<std::promise<void>>();
+    prepared.push_back(done->get_future());
+    TaskScheduler::instance().submit(TaskQos::Background, "prepareJob", [&, i, done]() {
+      TRACE_SCOPE_ARG("import", "prepareJob", "job", i);
+      const BatchJob& job = manifest.jobs[i];
+      const auto prepStart = std::chrono::steady_clock::now();
+      std::shared_ptr<Timeline> timeline = !job.project.empty()
+        ? core.loadProject(job.project, job.output.width, job.output.height)
+        : core.buildTimeline(job.images, job.clipDurSec, job.xfadeSec, job.output.width, job.output.height, job.transitions, job.kenBurns);
+      runs[i].prepareSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - prepStart).count();
+      if (!timeline) {
+        std::fprintf(stderr, "[%s] no images could be loaded\n", job.name.c_str());
+        done->set_value();
+        return;
+      }
+      if (!job.overlays.empty()) {
+        core.addOverlayTrack(*timeline, job.overlays);
+      }
+      // 프로젝트 파일에 저장된 오디오는 manifest 에 오디오 설정이 있을 때만 교체
+      if (job.project.empty() || !job.audio.musicPath.empty() || !job.audio.clipAudioPaths.empty()) {
+        job.audio.applyTo(*timeline);
+      }
+      runs[i].frames = std::max(1, (int)std::ceil(timeline->totalDuration() * job.output.fps));
+      runs[i].jobId = core.submitExportJob(std::move(timeline), { job.output }, job.priority);
+      done->set_value();
+    });
+  }
+  for (auto& f : prepared) {
+    f.wait();
+  }
+
+  core.waitForExports();
+  if (!tracePath.empty()) {
+    Trace::stop();
+    Trace::dumpJson(tracePath);
+  }
+  const double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  // 작업별 처리량 리포트
+  int failed = 0;
+  long long totalFrames = 0;
+  std::printf("%-24s %-10s %8s %9s %9s %9s\n", "job", "status", "frames", "prep(s)", "render(s)", "fps");
+  for (size_t i = 0; i < manifest.jobs.size(); i++) {
+    const JobRun& run = runs[i];
+    const ExportJobStatus status = run.jobId >= 0 ? core.getExportJobStatus(run.jobId) : ExportJobStatus::Failed;
+    const double renderSec = run.jobId >= 0 ? core.getExportJobElapsedSec(run.jobId) : 0.0;
+    const double fps = renderSec > 0.0 ? run.frames / renderSec : 0.0;
+    if (status != ExportJobStatus::Completed) {
+      failed++;
+    } else {
+      totalFrames += run.frames;
+    }
+    std::printf("%-24.24s %-10s %8d %9.2f %9.2f %9.1f\n", manifest.jobs[i].name.c_str(), ExportJobManager::statusName(status),
+                run.frames, run.prepareSec, renderSec, fps);
+  }
+
+  const SharedImageCache& cache = core.imageCache();
+  std::printf("\n%zu jobs, %d failed, concurrency %d\n", manifest.jobs.size(), failed, concurrency);
+  std::printf("wall %.2fs, %lld frames, aggregate %.1f fps\n", wallSec, totalFrames, wallSec > 0.0 ? totalFrames / wallSec : 0.0);
+  std::printf("decode cache: %zu hits, %zu misses, %.1f MB resident\n", cache.hitCount(), cache.missCount(), cache.usedBytes() / (1024.0 * 1024.0));
+  printMemoryStats("before", core.getMemoryStats());
+  core.trimMemory(TrimLevel::Critical);
+  printMemoryStats("trimmed", core.getMemoryStats());
+
+  Logger::flush();
+  return failed == 0 ? 0 : 1;
+}
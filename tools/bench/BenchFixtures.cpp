@@ -0,0 +1,148 @@
+#include "BenchFixtures.h"
+#include "../../shared/video/ClipLoader.h"
+#include "../../shared/video/ColorManagedDecoder.h"
+#include <core/SkCanvas.h>
+#include <core/SkStream.h>
+#include <core/SkSurface.h>
+#include <effects/SkGradientShader.h>
+#include <encode/SkJpegEncoder.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+std::string s_fixtureDir;                 // 사용자가 지정한 이미지 폴더
+std::string s_generatedDir;               // 임시로 만든 폴더 (cleanup 에서 삭제)
+std::vector<std::string> s_files;         // import 벤치마크 입력 파일
+std::vector<std::string> s_tempFiles;     // 임시 폴더에 만든 파일 (cleanup 에서 삭제)
+bool s_filesReady = false;
+
+bool hasImageExtension(const std::string& name) {
+  const size_t dot = name.find_last_of('.');
+  if (dot == std::string::npos) return false;
+  std::string ext = name.substr(dot + 1);
+  std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+  return ext == "jpg" || ext == "jpeg" || ext == "png" || ext == "webp";
+}
+
+std::vector<std::string> listImages(const std::string& dir) {
+  std::vector<std::string> files;
+  DIR* d = opendir(dir.c_str());
+  if (!d) return files;
+  while (dirent* e = readdir(d)) {
+    const std::string name = e->d_name;
+    if (hasImageExtension(name)) files.push_back(dir + "/" + name);
+  }
+  closedir(d);
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+// 임시 폴더 생성 (처음 한 번)
+bool ensureTempDir() {
+  if (!s_generatedDir.empty()) return true;
+  char tmpl[] = "/tmp/engine_bench_XXXXXX";
+  if (!mkdtemp(tmpl)) return false;
+  s_generatedDir = tmpl;
+  return true;
+}
+
+// 휴대폰 사진 크기의 JPEG 를 임시 폴더에 생성
+std::vector<std::string> generateImages(int count, int width, int height) {
+  std::vector<std::string> files;
+  SkJpegEncoder::Options options;
+  options.fQuality = 90;
+  for (int i = 0; i < count; i++) {
+    sk_sp<SkImage> image = BenchFixtures::makeImage(width, height, i);
+    SkPixmap pixmap;
+    if (!image || !image->peekPixels(&pixmap)) break;
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "photo_%02d.jpg", i);
+    const std::string path = BenchFixtures::tempPath(name);
+    if (path.empty()) break;
+    SkFILEWStream stream(path.c_str());
+    if (!stream.isValid() || !SkJpegEncoder::Encode(&stream, pixmap, options)) break;
+    files.push_back(path);
+  }
+  return files;
+}
+
+} // namespace
+
+void BenchFixtures::setFixtureDir(const std::string& dir) {
+  s_fixtureDir = dir;
+};
+
+sk_sp<SkImage> BenchFixtures::makeImage(int width, int height, int index) {
+  sk_sp<SkSurface> surface = SkSurfaces::Raster(ColorManagedDecoder::outputInfo(width, height, true));
+  if (!surface) return nullptr;
+
+  // 색이 고르게 퍼진 대각선 그라디언트 + 사각형 몇 개 (단색 이미지보다 JPEG 크기/디코딩 비용이 실제 사진에 가까움)
+  const SkColor palette[] = { SK_ColorRED, SK_ColorGREEN, SK_ColorBLUE, SK_ColorYELLOW, SK_ColorCYAN, SK_ColorMAGENTA };
+  const int n = (int)(sizeof(palette) / sizeof(palette[0]));
+  const SkColor colors[2] = { palette[index % n], palette[(index + 2) % n] };
+  const SkPoint pts[2] = { SkPoint::Make(0, 0), SkPoint::Make((float)width, (float)height) };
+
+  SkCanvas* canvas = surface->getCanvas();
+  SkPaint paint;
+  paint.setShader(SkGradientShader::MakeLinear(pts, colors, nullptr, 2, SkTileMode::kClamp));
+  canvas->drawPaint(paint);
+
+  paint.setShader(nullptr);
+  paint.setAntiAlias(true);
+  for (int k = 0; k < 16; k++) {
+    paint.setColor(SkColorSetARGB(160, (uint8_t)(37 * k + index * 11), (uint8_t)(91 * k), (uint8_t)(53 * k + index * 29)));
+    const float x = (float)((k * 7919 + index * 104729) % width);
+    const float y = (float)((k * 6271 + index * 7907) % height);
+    canvas->drawCircle(x, y, (float)(height / 16 + (k % 5) * height / 40), paint);
+  }
+  return surface->makeImageSnapshot();
+};
+
+std::vector<Timeline::ClipRenderData> BenchFixtures::makeClips(int count) {
+  static std::vector<sk_sp<SkImage>> s_images;
+  if (s_images.empty()) {
+    for (int i = 0; i < k_distinctImages; i++) {
+      s_images.push_back(makeImage(k_sourceWidth, k_sourceHeight, i));
+    }
+  }
+
+  const SkRect dst = ClipLoader::fitWidthRect(k_sourceWidth, k_sourceHeight, k_canvasWidth, k_canvasHeight);
+  std::vector<Timeline::ClipRenderData> clips;
+  clips.reserve(count);
+  for (int i = 0; i < count; i++) {
+    clips.emplace_back(s_images[i % k_distinctImages], dst);
+  }
+  return clips;
+};
+
+const std::vector<std::string>& BenchFixtures::imageFiles() {
+  if (!s_filesReady) {
+    s_filesReady = true;
+    s_files = !s_fixtureDir.empty() ? listImages(s_fixtureDir) : generateImages(k_generatedFiles, k_generatedWidth, k_generatedHeight);
+  }
+  return s_files;
+};
+
+std::string BenchFixtures::tempPath(const std::string& name) {
+  if (!ensureTempDir()) return std::string();
+  const std::string path = s_generatedDir + "/" + name;
+  if (std::find(s_tempFiles.begin(), s_tempFiles.end(), path) == s_tempFiles.end()) {
+    s_tempFiles.push_back(path);
+  }
+  return path;
+};
+
+void BenchFixtures::cleanup() {
+  if (s_generatedDir.empty()) return;
+  for (const auto& path : s_tempFiles) {
+    std::remove(path.c_str());
+  }
+  s_tempFiles.clear();
+  rmdir(s_generatedDir.c_str());
+  s_generatedDir.clear();
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <core/SkImage.h>
+#include "../../shared/video/Timeline.h"
+
+/**
+ * 벤치마크 공용 입력 데이터
+ *
+ * - 렌더링 벤치마크는 디코딩 비용이 섞이지 않도록 미리 만든 raster 이미지(그라디언트)를 캔버스에 배치한 클립을 사용한다.
+ *   (서로 다른 이미지 k_distinctImages 장을 돌려 쓰므로 클립 수가 많아도 메모리는 일정)
+ * - import 벤치마크는 실제 파일을 읽는다. --fixture_dir 로 사진 폴더를 주지 않으면 임시 폴더에 휴대폰 사진 크기의 JPEG 를 만들어 사용한다.
+ */
+class BenchFixtures
+{
+public:
+  // import 벤치마크에 사용할 이미지 폴더 지정 (jpg/jpeg/png/webp 파일을 이름 순으로 사용)
+  static void setFixtureDir(const std::string& dir);
+
+  // (width x height) raster 이미지 (index 마다 다른 색의 그라디언트)
+  static sk_sp<SkImage> makeImage(int width, int height, int index);
+
+  // 캔버스(k_canvasWidth x k_canvasHeight)에 fitWidthRect 로 배치된 raster 클립 count 개
+  static std::vector<Timeline::ClipRenderData> makeClips(int count);
+
+  // import 벤치마크용 이미지 파일 경로 (처음 호출 시 준비, 실패하면 빈 목록)
+  static const std::vector<std::string>& imageFiles();
+
+  // 임시 폴더 안의 파일 경로 (export 결과 등, cleanup 에서 함께 삭제. 폴더를 만들 수 없으면 빈 문자열)
+  static std::string tempPath(const std::string& name);
+
+  // 임시로 만든 fixture 파일 삭제 (main 종료 시 호출)
+  static void cleanup();
+
+public:
+  static constexpr int k_canvasWidth = 1280;      // Preview/렌더링 캔버스 크기
+  static constexpr int k_canvasHeight = 720;
+  static constexpr int k_sourceWidth = 1920;      // 렌더링 벤치마크 클립 원본 크기
+  static constexpr int k_sourceHeight = 1080;
+  static constexpr int k_distinctImages = 8;
+
+private:
+  static constexpr int k_generatedFiles = 8;      // 임시 JPEG 수
+  static constexpr int k_generatedWidth = 4032;   // 임시 JPEG 크기 (12MP 휴대폰 사진)
+  static constexpr int k_generatedHeight = 3024;
+};
@@ -0,0 +1,56 @@
+#include "BenchFixtures.h"
+#include "../../shared/drawables/RotatingRect.h"
+#include "../../shared/video/ColorManagedDecoder.h"
+#include <benchmark/benchmark.h>
+#include <core/SkSurface.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/**
+ * Renderer 의 drawable 렌더링 루프 (Timeline 이 없을 때 Preview 에 그리는 경로)
+ * - Renderer 는 EGL/Android surface 에 묶여 있어 호스트에서 빌드할 수 없으므로, 렌더링 스레드가 프레임마다 하는 일을 같은 순서로 재현한다.
+ *   (mutex 안에서 목록 스냅샷 복사 -> 캔버스 초기화 -> drawable 마다 update + draw)
+ */
+void BM_RendererDrawables(benchmark::State& state) {
+  const int count = (int)state.range(0);
+  sk_sp<SkSurface> surface = SkSurfaces::Raster(ColorManagedDecoder::outputInfo(BenchFixtures::k_canvasWidth, BenchFixtures::k_canvasHeight, true));
+  if (!surface) {
+    state.SkipWithError("surface creation failed");
+    return;
+  }
+
+  std::mutex drawablesMtx;
+  std::vector<std::shared_ptr<IDrawable>> drawables;
+  for (int i = 0; i < count; i++) {
+    auto rect = std::make_shared<RotatingRect>();
+    rect->setSize(40.0f + (i % 8) * 20.0f, 30.0f + (i % 5) * 25.0f);
+    rect->setColor(SkColorSetARGB(200, (uint8_t)(i * 37), (uint8_t)(i * 91), (uint8_t)(i * 53)));
+    rect->setSpeed(30.0f + (i % 7) * 15.0f);
+    drawables.push_back(std::move(rect));
+  }
+
+  SkCanvas* canvas = surface->getCanvas();
+  const float dt = 1.0f / 60.0f;
+  for (auto _ : state) {
+    std::vector<std::shared_ptr<IDrawable>> snapshot;
+    {
+      std::lock_guard<std::mutex> lock(drawablesMtx);
+      snapshot = drawables;
+    }
+    canvas->clear(SK_ColorLTGRAY);
+    for (auto& drawable : snapshot) {
+      drawable->update(dt);
+      drawable->draw(canvas);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RendererDrawables)
+  ->RangeMultiplier(4)->Range(1, 1024)
+  ->ArgName("drawables")
+  ->Unit(benchmark::kMicrosecond);
+
+} // namespace
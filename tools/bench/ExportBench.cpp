@@ -0,0 +1,153 @@
+#include "BenchFixtures.h"
+#include "FakeCodecEncoder.h"
+#include "../../shared/encoder/ExportJobManager.h"
+#include "../../shared/video/ClipMotion.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// export 대상 타임라인 종류
+enum class ExportScenario
+{
+  Short,            // 사진 10장, 3초씩 + 0.5초 crossfade (일반적인 짧은 슬라이드쇼)
+  Clips1k,          // 사진 1000장, 0.1초씩 (클립 수가 많을 때 구간 탐색/키프레임 계획 비용)
+  HeavyTransitions, // 사진 40장, 2초씩 + 1초 전환(모든 종류 번갈아) + Ken Burns (항상 두 클립을 합성)
+  Count,
+};
+
+const char* scenarioName(ExportScenario scenario) {
+  switch (scenario) {
+    case ExportScenario::Short:            return "short";
+    case ExportScenario::Clips1k:          return "clips1k";
+    case ExportScenario::HeavyTransitions: return "heavyTransitions";
+    default:                               return "unknown";
+  }
+}
+
+std::shared_ptr<Timeline> makeTimeline(ExportScenario scenario) {
+  switch (scenario) {
+    case ExportScenario::Short:
+      return Timeline::FromClipRenderData(BenchFixtures::makeClips(10), 3.0, 0.5);
+    case ExportScenario::Clips1k:
+      return Timeline::FromClipRenderData(BenchFixtures::makeClips(1000), 0.1, 0.03);
+    case ExportScenario::HeavyTransitions: {
+      std::vector<TransitionType> transitions;
+      for (int i = 0; i < (int)TransitionType::Count; i++) {
+        transitions.push_back((TransitionType)i);
+      }
+      return Timeline::FromClipRenderData(BenchFixtures::makeClips(40), 2.0, 1.0, transitions, ClipMotion::kenBurnsPresets());
+    }
+    default:
+      return nullptr;
+  }
+}
+
+/**
+ * 최대 RSS(VmHWM) 측정
+ * - /proc/self/clear_refs 에 "5" 를 쓰면 최대값이 현재 RSS 로 초기화된다. (Linux 4.0+)
+ *   초기화할 수 없는 환경이면 프로세스 시작 이후 최대값이 그대로 보고되므로, 시나리오 하나씩 --benchmark_filter 로 실행해 비교한다.
+ */
+void resetPeakRss() {
+  if (std::FILE* f = std::fopen("/proc/self/clear_refs", "w")) {
+    std::fputs("5", f);
+    std::fclose(f);
+  }
+}
+
+double peakRssMb() {
+  std::FILE* f = std::fopen("/proc/self/status", "r");
+  if (!f) return 0.0;
+  char line[256];
+  long kb = 0;
+  while (std::fgets(line, sizeof(line), f)) {
+    if (std::strncmp(line, "VmHWM:", 6) == 0) {
+      std::sscanf(line + 6, "%ld", &kb);
+      break;
+    }
+  }
+  std::fclose(f);
+  return kb / 1024.0;
+}
+
+/**
+ * 가짜 Codec 으로 전체 export 흐름 실행 (ExportJobManager -> TaskScheduler Export 작업 -> IEncoder prepare/encodeBlocking/release)
+ * - AndroidEncoder 는 AMediaCodec/AMediaMuxer 를 직접 부르므로 기기 없이는 측정할 수 없다. FakeCodecEncoder 는 같은 프레임 루프를
+ *   raster 렌더링 + FakeCodecSink(압축 시간 흉내, 입력 버퍼 수 제한, 10ms drain 대기) 로 실행한다.
+ * - 카운터: fps, 프레임당 단계별 시간(ms), 키프레임 수, 출력 크기, 최대 RSS.
+ *   Codec 은 별도 스레드에서 렌더링과 겹쳐 돌기 때문에 단계별 시간의 합은 프레임당 전체 시간과 다르다.
+ */
+void BM_Export(benchmark::State& state) {
+  const ExportScenario scenario = (ExportScenario)state.range(0);
+  state.SetLabel(scenarioName(scenario));
+
+  std::shared_ptr<Timeline> timeline = makeTimeline(scenario);
+  EncoderConfig cfg;
+  cfg.width = BenchFixtures::k_canvasWidth;
+  cfg.height = BenchFixtures::k_canvasHeight;
+  cfg.outputPath = BenchFixtures::tempPath(std::string("export_") + scenarioName(scenario) + ".fake");
+  if (!timeline || cfg.outputPath.empty()) {
+    state.SkipWithError("fixture setup failed");
+    return;
+  }
+
+  // 팩토리에서 만든 인코더를 받아두고 작업이 끝난 뒤 통계를 읽음
+  std::shared_ptr<FakeCodecEncoder> encoder;
+  ExportJobManager jobs([&encoder](const std::vector<EncoderConfig>& configs, std::shared_ptr<Timeline> tl) -> std::shared_ptr<IEncoder> {
+    auto e = std::make_shared<FakeCodecEncoder>();
+    e->setTimeline(std::move(tl));
+    if (configs.empty() || !e->prepare(configs.front())) return nullptr;
+    encoder = e;
+    return e;
+  });
+
+  FakeExportStats total;
+  size_t keyframes = 0;
+  double peakMb = 0.0;
+  for (auto _ : state) {
+    resetPeakRss();
+    encoder.reset();
+    const int jobId = jobs.submit(timeline, { cfg });
+    jobs.waitUntilIdle();
+    peakMb = std::max(peakMb, peakRssMb());
+
+    if (jobs.status(jobId) != ExportJobStatus::Completed || !encoder) {
+      state.SkipWithError(encoder && !encoder->stats().keyframesMatch ? "keyframes differ from KeyframePlan" : "export failed");
+      return;
+    }
+    const FakeExportStats& s = encoder->stats();
+    total.codec.frames += s.codec.frames;
+    total.codec.bytes += s.codec.bytes;
+    keyframes += s.codec.syncFrames.size();
+    total.codec.inputWaitMs += s.codec.inputWaitMs;
+    total.codec.copyMs += s.codec.copyMs;
+    total.codec.codecMs += s.codec.codecMs;
+    total.codec.drainWaitMs += s.codec.drainWaitMs;
+    total.codec.muxMs += s.codec.muxMs;
+    total.renderMs += s.renderMs;
+    total.totalMs += s.totalMs;
+  }
+
+  const double frames = std::max(1, total.codec.frames);
+  state.counters["frames"] = frames / (double)state.iterations();
+  state.counters["fps"] = total.totalMs > 0.0 ? frames * 1000.0 / total.totalMs : 0.0;
+  state.counters["renderMs"] = total.renderMs / frames;
+  state.counters["inputWaitMs"] = total.codec.inputWaitMs / frames;
+  state.counters["copyMs"] = total.codec.copyMs / frames;
+  state.counters["codecMs"] = total.codec.codecMs / frames;
+  state.counters["drainWaitMs"] = total.codec.drainWaitMs / frames;
+  state.counters["muxMs"] = total.codec.muxMs / frames;
+  state.counters["keyframes"] = (double)keyframes / (double)state.iterations();
+  state.counters["outputMB"] = total.codec.bytes / (1024.0 * 1024.0) / (double)state.iterations();
+  state.counters["peakRssMB"] = peakMb;
+}
+BENCHMARK(BM_Export)
+  ->DenseRange(0, (int)ExportScenario::Count - 1)
+  ->ArgName("scenario")
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime()
+  ->Iterations(1);
+
+} // namespace
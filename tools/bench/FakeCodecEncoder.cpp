@@ -0,0 +1,149 @@
+#include "FakeCodecEncoder.h"
+#include "../../shared/logger/Logger.h"
+#include "../../shared/trace/Trace.h"
+#include "../../shared/video/ColorManagedDecoder.h"
+#include <core/SkCanvas.h>
+#include <core/SkPixmap.h>
+#include <algorithm>    // std::min, std::max, std::mismatch
+#include <chrono>
+#include <cmath>        // std::ceil, std::llround
+#include <utility>      // std::move
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point from, Clock::time_point to) {
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+FakeCodecEncoder::~FakeCodecEncoder() {
+  release(); // 소멸자에서 안전하게 자원 해제
+};
+
+void FakeCodecEncoder::setTimeline(std::shared_ptr<Timeline> tl) {
+  m_pTimeline = std::move(tl);
+  m_durationSec = (m_pTimeline ? m_pTimeline->totalDuration() : 0.0);
+};
+
+bool FakeCodecEncoder::prepare(const EncoderConfig& cfg) {
+  m_encoderConfig = cfg;
+  m_stats = FakeExportStats();
+
+  if (!m_pTimeline) {
+    Logger::error(k_logTag, "Timeline not set");
+    return false;
+  }
+
+  // 클립 경계/전환 종료 시점 기준 키프레임 계획 (AndroidEncoder 와 같음)
+  m_keyframes = KeyframePlan::fromConfig(*m_pTimeline, cfg);
+  m_stats.plannedKeyframes = (int)m_keyframes.frames().size();
+
+  // GPU surface 대신 raster surface (디코딩된 이미지와 같은 출력 색공간/형식)
+  m_surface = SkSurfaces::Raster(ColorManagedDecoder::outputInfo(cfg.width, cfg.height));
+  if (!m_surface) {
+    Logger::error(k_logTag, "SkSurfaces::Raster failed (%dx%d)", cfg.width, cfg.height);
+    return false;
+  }
+  return m_sink.prepare(cfg, m_profile);
+};
+
+bool FakeCodecEncoder::encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) {
+  if (!m_surface || !m_pTimeline) return false;
+  const auto start = Clock::now();
+
+  // FPS, 한 프레임 길이, 전체 길이, 총 프레임 수 계산 (AndroidEncoder 와 동일한 프레임 시간 규칙)
+  const int fps = std::max(1, m_encoderConfig.fps);
+  const double frameDur = 1.0 / (double)fps;
+  const double dur = std::max(0.0, m_durationSec);
+  const int totalFrames = std::max(1, (int)std::ceil(dur * fps));
+
+  for (int i = 0; i < totalFrames; i++)
+  {
+    TRACE_SCOPE_ARG("export", "frame", "index", i);
+
+    if (cancelFlag.load()) {
+      break;
+    }
+
+    const double t = std::min(dur, i * frameDur);
+    const int64_t ptsUs = (int64_t)std::llround(t * 1'000'000.0);
+
+    // 장면이 바뀌는 프레임이면 키프레임 요청 (0번은 항상 키프레임)
+    if (i > 0 && m_keyframes.isKeyframe(i)) {
+      m_sink.requestSyncFrame();
+    }
+
+    {
+      TRACE_SCOPE("export", "render");
+      const auto renderStart = Clock::now();
+      RenderContext ctx{ m_surface->getCanvas(), m_encoderConfig.width, m_encoderConfig.height, t };
+      ctx.quality = RenderQuality::Export;
+      m_pTimeline->render(ctx);
+      m_stats.renderMs += elapsedMs(renderStart, Clock::now());
+    }
+
+    SkPixmap pixels;
+    if (!m_surface->peekPixels(&pixels) || !m_sink.queueFrame(pixels, ptsUs)) {
+      Logger::error(k_logTag, "queueFrame failed at frame %d", i);
+      return false;
+    }
+
+    {
+      TRACE_SCOPE("export", "drain");
+      if (!m_sink.drain(false)) {
+        Logger::error(k_logTag, "drain running failed");
+        return false;
+      }
+    }
+
+    if (onProgress) {
+      onProgress(double(i + 1) / double(totalFrames));
+    }
+  }
+
+  if (!m_sink.signalEndOfStream()) {
+    return false;
+  }
+  {
+    TRACE_SCOPE("export", "drainFinal");
+    if (!m_sink.drain(true)) {
+      Logger::error(k_logTag, "drain final failed");
+      return false;
+    }
+  }
+
+  m_stats.codec = m_sink.stats();
+  m_stats.totalMs = elapsedMs(start, Clock::now());
+  return cancelFlag.load() || verifyKeyframes();
+};
+
+void FakeCodecEncoder::release() {
+  m_sink.release();
+  m_surface = nullptr;
+  m_durationSec = (m_pTimeline ? m_pTimeline->totalDuration() : 0.0);
+  m_keyframes = KeyframePlan();
+};
+
+std::string FakeCodecEncoder::outputPath() const {
+  return m_encoderConfig.outputPath;
+};
+
+bool FakeCodecEncoder::verifyKeyframes() {
+  if (m_keyframes.empty()) return true;
+
+  // Codec 의 주기적 키프레임은 최대 간격에서만 동작하므로, 계획대로 요청했다면 기록된 키프레임과 정확히 같아야 함
+  const std::vector<int>& planned = m_keyframes.frames();
+  const std::vector<int>& written = m_stats.codec.syncFrames;
+  m_stats.keyframesMatch = (planned == written);
+  if (!m_stats.keyframesMatch) {
+    auto diff = std::mismatch(planned.begin(), planned.end(), written.begin(), written.end());
+    Logger::error(k_logTag, "Keyframes differ from plan (planned %zu, written %zu, first difference: planned %d / written %d)",
+                  planned.size(), written.size(),
+                  diff.first != planned.end() ? *diff.first : -1,
+                  diff.second != written.end() ? *diff.second : -1);
+  }
+  return m_stats.keyframesMatch;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <core/SkSurface.h>
+#include "FakeCodecSink.h"
+#include "../../shared/encoder/IEncoder.h"
+#include "../../shared/encoder/EncoderConfig.h"
+#include "../../shared/encoder/KeyframePlan.h"
+#include "../../shared/video/Timeline.h"
+
+// export 한 번의 단계별 통계 (FakeCodecSink 통계 + 렌더링 시간 + 키프레임 검증 결과)
+struct FakeExportStats
+{
+  FakeCodecStats codec;             // 입력 대기/복사/압축/drain/mux 단계
+  double renderMs = 0.0;            // Timeline::render 누적 시간
+  double totalMs = 0.0;             // encodeBlocking 전체 시간
+  int plannedKeyframes = 0;         // KeyframePlan 이 요청한 키프레임 수 (contentAwareKeyframes 가 꺼져 있으면 0)
+  bool keyframesMatch = true;       // 기록된 키프레임이 KeyframePlan 과 일치하는지
+};
+
+/**
+ * AndroidEncoder 의 프레임 루프를 하드웨어 Codec 대신 FakeCodecSink 로 실행하는 IEncoder (export 벤치마크용)
+ *
+ * - 프레임 시간/PTS 계산, KeyframePlan 에 따른 sync frame 요청, 프레임마다 render -> 입력 -> drain, EOS 후 drain(true) 순서가 AndroidEncoder 와 같다.
+ *   렌더링은 GPU 대신 raster surface 에 하고, swapBuffers 대신 픽셀을 Codec 입력 버퍼로 복사한다.
+ * - encodeBlocking 이 끝나면 기록된 키프레임이 KeyframePlan 과 같은지 확인한다. (다르면 실패로 처리)
+ * - 통계는 release 뒤에도 남아 있으므로 ExportJobManager 로 실행한 뒤 팩토리에서 받아둔 인스턴스로 읽을 수 있다.
+ */
+class FakeCodecEncoder : public IEncoder {
+public:
+  explicit FakeCodecEncoder(const FakeCodecProfile& profile = FakeCodecProfile()) : m_profile(profile) {};
+  ~FakeCodecEncoder() override;
+
+public:
+  void setTimeline(std::shared_ptr<Timeline> tl) override;
+  // raster surface 생성 + 키프레임 계획 + 가짜 Codec/Muxer 준비
+  bool prepare(const EncoderConfig& cfg) override;
+  bool encodeBlocking(std::atomic<bool>& cancelFlag, std::function<void(double)> onProgress) override;
+  void release() override;
+  std::string outputPath() const override;
+
+  const FakeExportStats& stats() const { return m_stats; };
+
+private:
+  // 기록된 키프레임과 계획 비교 (계획이 비어있으면 항상 일치)
+  bool verifyKeyframes();
+
+private:
+  FakeCodecProfile m_profile;                   // 가짜 Codec 처리 시간/버퍼 모델
+  std::shared_ptr<Timeline> m_pTimeline;        // 인코딩에 사용할 타임라인
+  EncoderConfig m_encoderConfig;                // 인코딩 설정
+  sk_sp<SkSurface> m_surface;                   // raster 렌더링 대상
+  FakeCodecSink m_sink;                         // 가짜 Codec + Muxer
+  KeyframePlan m_keyframes;                     // 클립 경계 기반 키프레임 계획
+  double m_durationSec = 0.0;                   // 타임라인 총 길이(초) 캐시
+  FakeExportStats m_stats;
+
+private:
+  static constexpr const char* k_logTag = "FakeCodecEncoder";
+};
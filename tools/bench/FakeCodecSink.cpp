@@ -0,0 +1,279 @@
+#include "FakeCodecSink.h"
+#include "../../shared/logger/Logger.h"
+#include "../../shared/trace/Trace.h"
+#include <algorithm>    // std::min, std::max
+#include <chrono>
+#include <cstring>      // std::memcpy
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point from, Clock::time_point to) {
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+// 출력 파일 앞부분 식별자 (ffmpeg 등으로 재생할 수 없는 벤치마크 전용 형식)
+constexpr char k_fileMagic[8] = { 'F', 'A', 'K', 'E', 'M', 'U', 'X', '1' };
+
+} // namespace
+
+FakeCodecSink::~FakeCodecSink() {
+  release(); // 소멸자에서 안전하게 자원 해제
+};
+
+bool FakeCodecSink::prepare(const EncoderConfig& cfg, const FakeCodecProfile& profile) {
+  release();
+  m_encoderConfig = cfg;
+  m_profile = profile;
+  m_stats = FakeCodecStats();
+
+  if (cfg.width <= 0 || cfg.height <= 0 || cfg.outputPath.empty()) {
+    Logger::error(k_logTag, "Invalid config (%dx%d, path=%s)", cfg.width, cfg.height, cfg.outputPath.c_str());
+    return false;
+  }
+
+  // 1) 입력 버퍼 준비 (RGBA 한 프레임 크기)
+  const size_t frameBytes = (size_t)cfg.width * cfg.height * 4;
+  for (int i = 0; i < std::max(1, profile.inputBuffers); i++) {
+    m_freeBuffers.emplace_back(frameBytes);
+  }
+
+  // 2) 출력 파일 오픈 + 헤더(식별자, 해상도, FPS) 기록
+  m_file = std::fopen(cfg.outputPath.c_str(), "wb");
+  if (!m_file) {
+    Logger::error(k_logTag, "Cannot open output: %s", cfg.outputPath.c_str());
+    return false;
+  }
+  const int32_t header[3] = { cfg.width, cfg.height, std::max(1, cfg.fps) };
+  std::fwrite(k_fileMagic, 1, sizeof(k_fileMagic), m_file);
+  std::fwrite(header, 1, sizeof(header), m_file);
+  m_fileOffset = sizeof(k_fileMagic) + sizeof(header);
+
+  // 3) Codec 스레드 시작
+  m_codecThread = std::thread([this]() { codecLoop(); });
+  return true;
+};
+
+bool FakeCodecSink::requestSyncFrame() {
+  if (!m_codecThread.joinable()) return false;
+  m_syncRequested = true;
+  return true;
+};
+
+bool FakeCodecSink::queueFrame(const SkPixmap& pixels, int64_t ptsUs) {
+  if (!m_codecThread.joinable()) return false;
+  if (pixels.width() != m_encoderConfig.width || pixels.height() != m_encoderConfig.height || pixels.info().bytesPerPixel() != 4) {
+    Logger::error(k_logTag, "Unexpected frame %dx%d", pixels.width(), pixels.height());
+    return false;
+  }
+
+  // 빈 입력 버퍼가 생길 때까지 대기 (Codec 이 밀려 있으면 여기서 렌더링 스레드가 막힘)
+  Frame frame;
+  {
+    TRACE_SCOPE("export", "inputWait");
+    const auto waitStart = Clock::now();
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_freeCv.wait(lock, [this]() { return m_quit || !m_freeBuffers.empty(); });
+    m_stats.inputWaitMs += elapsedMs(waitStart, Clock::now());
+    if (m_quit) return false;
+    frame.pixels = std::move(m_freeBuffers.back());
+    m_freeBuffers.pop_back();
+  }
+
+  // 렌더링 결과를 입력 버퍼로 복사 (행 사이 여백(rowBytes)은 제외)
+  {
+    TRACE_SCOPE("export", "copyInput");
+    const auto copyStart = Clock::now();
+    const size_t rowBytes = (size_t)pixels.width() * 4;
+    for (int y = 0; y < pixels.height(); y++) {
+      std::memcpy(frame.pixels.data() + rowBytes * y, pixels.addr(0, y), rowBytes);
+    }
+    m_stats.copyMs += elapsedMs(copyStart, Clock::now());
+  }
+
+  frame.ptsUs = ptsUs;
+  frame.index = m_nextIndex++;
+  frame.sync = m_syncRequested;
+  m_syncRequested = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_input.push_back(std::move(frame));
+  }
+  m_inputCv.notify_one();
+  return true;
+};
+
+bool FakeCodecSink::drain(bool endOfStream) {
+  if (!m_file) return false;
+  if (m_outputEnded) return true;
+
+  for (;;) {
+    Packet packet;
+    {
+      // AMediaCodec_dequeueOutputBuffer 와 같이 출력 패킷을 최대 drainTimeoutUs 까지 기다림 (endOfStream 이면 EOS 패킷까지 계속)
+      const auto waitStart = Clock::now();
+      std::unique_lock<std::mutex> lock(m_mtx);
+      const auto ready = [this]() { return !m_output.empty(); };
+      bool found = true;
+      if (endOfStream) {
+        if (!m_inputEnded) {
+          Logger::error(k_logTag, "drain(EOS) before signalEndOfStream");
+          return false;
+        }
+        m_outputCv.wait(lock, ready);
+      } else {
+        found = m_outputCv.wait_for(lock, std::chrono::microseconds(m_profile.drainTimeoutUs), ready);
+      }
+      m_stats.drainWaitMs += elapsedMs(waitStart, Clock::now());
+      if (!found) break;
+
+      packet = std::move(m_output.front());
+      m_output.pop_front();
+      if (packet.endOfStream) {
+        m_stats.codecMs = m_codecUs / 1000.0;
+      }
+    }
+
+    if (packet.endOfStream) {
+      m_outputEnded = true;
+      return writeTrailer();
+    }
+    if (!writeSample(packet)) return false;
+  }
+  return true;
+};
+
+bool FakeCodecSink::signalEndOfStream() {
+  if (!m_codecThread.joinable()) return false;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_inputEnded = true;
+  }
+  m_inputCv.notify_one();
+  return true;
+};
+
+void FakeCodecSink::release() {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_quit = true;
+  }
+  m_inputCv.notify_all();
+  m_freeCv.notify_all();
+  if (m_codecThread.joinable()) m_codecThread.join();
+
+  if (m_file) {
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+
+  // 다음 prepare 를 위해 상태 초기화 (통계는 유지)
+  m_freeBuffers.clear();
+  m_input.clear();
+  m_output.clear();
+  m_samples.clear();
+  m_inputEnded = false;
+  m_quit = false;
+  m_codecUs = 0.0;
+  m_syncRequested = false;
+  m_nextIndex = 0;
+  m_outputEnded = false;
+  m_fileOffset = 0;
+};
+
+void FakeCodecSink::codecLoop() {
+  TRACE_THREAD_NAME("FakeCodec");
+
+  // 주기적 키프레임 간격 (AndroidCodecSink::keyframeIntervalSec 과 같은 규칙, 직전 키프레임부터 계산)
+  const int fps = std::max(1, m_encoderConfig.fps);
+  const int intervalSec = m_encoderConfig.contentAwareKeyframes ? m_encoderConfig.maxKeyframeIntervalSec : m_encoderConfig.iFrameIntervalSec;
+  const int intervalFrames = std::max(0, intervalSec) * fps;
+  const double megapixels = (double)m_encoderConfig.width * m_encoderConfig.height / 1'000'000.0;
+  const size_t packetBytes = (size_t)std::max(1, m_encoderConfig.bitrate / 8 / fps);
+  int lastKeyframe = -1;
+
+  for (;;) {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(m_mtx);
+      m_inputCv.wait(lock, [this]() { return m_quit || m_inputEnded || !m_input.empty(); });
+      if (m_quit) return;
+      if (m_input.empty()) {
+        // 남은 입력을 모두 처리한 뒤 EOS 패킷 전달
+        Packet eos;
+        eos.endOfStream = true;
+        m_output.push_back(std::move(eos));
+        m_outputCv.notify_one();
+        return;
+      }
+      frame = std::move(m_input.front());
+      m_input.pop_front();
+    }
+
+    TRACE_SCOPE_ARG("export", "fakeEncode", "index", frame.index);
+    const auto start = Clock::now();
+    const bool keyframe = frame.sync || lastKeyframe < 0 || (intervalFrames > 0 && frame.index - lastKeyframe >= intervalFrames);
+    if (keyframe) lastKeyframe = frame.index;
+    const double cost = keyframe ? m_profile.keyframeCost : 1.0;
+
+    // 압축 시간 흉내 + 비트레이트에 맞는 크기의 패킷 생성 (입력 버퍼 앞부분을 복사해 실제로 메모리를 읽고 씀)
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(m_profile.usPerMegapixel * megapixels * cost)));
+    Packet packet;
+    packet.data.resize((size_t)(packetBytes * cost));
+    std::memcpy(packet.data.data(), frame.pixels.data(), std::min(packet.data.size(), frame.pixels.size()));
+    packet.ptsUs = frame.ptsUs;
+    packet.index = frame.index;
+    packet.keyframe = keyframe;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_freeBuffers.push_back(std::move(frame.pixels));
+      m_output.push_back(std::move(packet));
+      m_codecUs += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+    m_freeCv.notify_one();
+    m_outputCv.notify_one();
+  }
+};
+
+bool FakeCodecSink::writeSample(const Packet& packet) {
+  TRACE_SCOPE("export", "mux");
+  const auto start = Clock::now();
+  if (std::fwrite(packet.data.data(), 1, packet.data.size(), m_file) != packet.data.size()) {
+    Logger::error(k_logTag, "Write failed at frame %d", packet.index);
+    return false;
+  }
+
+  Sample sample;
+  sample.offset = m_fileOffset;
+  sample.size = (uint32_t)packet.data.size();
+  sample.ptsUs = packet.ptsUs;
+  sample.keyframe = packet.keyframe;
+  m_samples.push_back(sample);
+  m_fileOffset += packet.data.size();
+
+  m_stats.frames++;
+  m_stats.bytes += packet.data.size();
+  if (packet.keyframe) m_stats.syncFrames.push_back(packet.index);
+  m_stats.muxMs += elapsedMs(start, Clock::now());
+  return true;
+};
+
+bool FakeCodecSink::writeTrailer() {
+  TRACE_SCOPE("export", "muxTrailer");
+  const auto start = Clock::now();
+
+  // sample table (offset, size, pts, keyframe) + sample 수
+  for (const auto& s : m_samples) {
+    const int64_t entry[4] = { (int64_t)s.offset, (int64_t)s.size, s.ptsUs, s.keyframe ? 1 : 0 };
+    std::fwrite(entry, 1, sizeof(entry), m_file);
+  }
+  const int64_t count = (int64_t)m_samples.size();
+  std::fwrite(&count, 1, sizeof(count), m_file);
+  const bool ok = std::fflush(m_file) == 0;
+
+  m_stats.muxMs += elapsedMs(start, Clock::now());
+  if (!ok) Logger::error(k_logTag, "Trailer write failed");
+  return ok;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <core/SkPixmap.h>
+#include "../../shared/encoder/EncoderConfig.h"
+
+// 가짜 Codec 의 처리 시간/버퍼 모델 (기본값은 휴대폰 하드웨어 H.264 인코더 720p~1080p 수준)
+struct FakeCodecProfile
+{
+  int inputBuffers = 4;             // Codec 입력 버퍼 수 (모두 사용 중이면 queueFrame 이 기다림, Surface BufferQueue 깊이에 해당)
+  int usPerMegapixel = 4000;        // 프레임 하나 압축 시간 (100만 화소당 us)
+  float keyframeCost = 2.5f;        // 키프레임 압축 시간 / 패킷 크기 배율
+  int drainTimeoutUs = 10'000;      // drain 에서 출력 패킷을 기다리는 최대 시간 (AndroidCodecSink 와 같은 10ms)
+};
+
+// 단계별 누적 시간/출력 통계
+struct FakeCodecStats
+{
+  int frames = 0;                   // Muxer 에 기록된 프레임 수
+  uint64_t bytes = 0;               // Muxer 에 기록된 패킷 총 바이트 수
+  std::vector<int> syncFrames;      // 키프레임으로 기록된 프레임 번호 (오름차순)
+  double inputWaitMs = 0.0;         // 빈 입력 버퍼를 기다린 시간 (Codec 이 밀려 렌더링 스레드가 막힌 시간)
+  double copyMs = 0.0;              // 렌더링 결과를 입력 버퍼로 복사한 시간
+  double codecMs = 0.0;             // Codec 스레드가 압축(흉내)에 쓴 시간
+  double drainWaitMs = 0.0;         // drain 에서 출력 패킷을 기다린 시간
+  double muxMs = 0.0;               // 패킷을 파일에 기록한 시간
+};
+
+/**
+ * AndroidCodecSink 의 호스트용 대역 (AMediaCodec + AMediaMuxer 없이 같은 호출 흐름을 재현)
+ *
+ * - queueFrame 은 렌더링 결과를 입력 버퍼에 복사해 Codec 스레드로 넘긴다. (입력 Surface 에 swapBuffers 하는 단계)
+ *   입력 버퍼가 모두 사용 중이면 하나가 빌 때까지 기다린다. (BufferQueue 가 가득 찬 상태)
+ * - Codec 스레드는 프레임마다 profile 의 압축 시간만큼 대기한 뒤 비트레이트에 맞는 크기의 패킷을 만든다.
+ *   키프레임은 요청받은 프레임, 0번 프레임, 직전 키프레임에서 Codec 의 주기적 간격이 지난 프레임이다. (AndroidCodecSink::keyframeIntervalSec 과 같은 규칙)
+ * - drain 은 AMediaCodec_dequeueOutputBuffer 처럼 출력 패킷을 drainTimeoutUs 까지 기다리며 꺼내 파일에 기록한다. (간단한 sample table 을 trailer 로 기록)
+ * - 오디오 트랙은 흉내내지 않는다.
+ */
+class FakeCodecSink
+{
+public:
+  FakeCodecSink() = default;
+  ~FakeCodecSink();
+
+  FakeCodecSink(const FakeCodecSink&) = delete;
+  FakeCodecSink& operator=(const FakeCodecSink&) = delete;
+
+public:
+  // 입력 버퍼 준비 -> 출력 파일 오픈 -> Codec 스레드 시작
+  bool prepare(const EncoderConfig& cfg, const FakeCodecProfile& profile);
+  // 다음에 입력되는 프레임을 키프레임으로 인코딩하도록 요청
+  bool requestSyncFrame();
+  // 렌더링된 프레임(RGBA)을 입력 버퍼에 복사해 Codec 에 넣기 (빈 입력 버퍼가 없으면 기다림)
+  bool queueFrame(const SkPixmap& pixels, int64_t ptsUs);
+  // 출력 패킷을 꺼내 파일에 기록 (endOfStream 이면 EOS 까지 모두 기록)
+  bool drain(bool endOfStream);
+  // 더 이상 입력할 프레임이 없음을 Codec 에 알림 (EOS)
+  bool signalEndOfStream();
+  // Codec 스레드 정지 + 출력 파일 닫기
+  void release();
+
+  const FakeCodecStats& stats() const { return m_stats; };
+
+private:
+  struct Frame
+  {
+    std::vector<uint8_t> pixels;    // 입력 버퍼 (RGBA)
+    int64_t ptsUs = 0;
+    int index = 0;                  // 입력 순서 (프레임 번호)
+    bool sync = false;              // 키프레임 요청 여부
+  };
+
+  struct Packet
+  {
+    std::vector<uint8_t> data;      // 압축 결과 (흉내)
+    int64_t ptsUs = 0;
+    int index = 0;
+    bool keyframe = false;
+    bool endOfStream = false;
+  };
+
+  struct Sample
+  {
+    uint64_t offset = 0;            // 파일 내 위치
+    uint32_t size = 0;
+    int64_t ptsUs = 0;
+    bool keyframe = false;
+  };
+
+  void codecLoop();
+  bool writeSample(const Packet& packet);
+  bool writeTrailer();
+
+private:
+  EncoderConfig m_encoderConfig;                // 인코딩 설정(해상도/FPS/비트레이트/출력 경로)
+  FakeCodecProfile m_profile;                   // 처리 시간/버퍼 모델
+
+  std::thread m_codecThread;                    // 압축을 흉내내는 Codec 스레드
+  std::mutex m_mtx;                             // 아래 큐 보호용 mutex
+  std::condition_variable m_inputCv;            // 입력 프레임 도착 / EOS 알림 (Codec 스레드가 기다림)
+  std::condition_variable m_freeCv;             // 입력 버퍼 반환 알림 (queueFrame 이 기다림)
+  std::condition_variable m_outputCv;           // 출력 패킷 도착 알림
+  std::vector<std::vector<uint8_t>> m_freeBuffers; // 비어있는 입력 버퍼
+  std::deque<Frame> m_input;                    // Codec 이 처리할 입력 프레임
+  std::deque<Packet> m_output;                  // drain 이 꺼내갈 출력 패킷
+  bool m_inputEnded = false;                    // EOS 입력 여부
+  bool m_quit = false;                          // Codec 스레드 종료 요청
+  double m_codecUs = 0.0;                       // Codec 스레드 누적 처리 시간 (m_mtx 로 보호)
+
+  bool m_syncRequested = false;                 // 다음 입력 프레임 키프레임 요청 (queueFrame 호출 스레드 전용)
+  int m_nextIndex = 0;                          // 다음 입력 프레임 번호
+  bool m_outputEnded = false;                   // EOS 패킷까지 기록 완료
+
+  std::FILE* m_file = nullptr;                  // 출력 파일
+  uint64_t m_fileOffset = 0;                    // 다음 sample 기록 위치
+  std::vector<Sample> m_samples;                // trailer 에 기록할 sample table
+  FakeCodecStats m_stats;
+
+private:
+  static constexpr const char* k_logTag = "FakeCodecSink";
+};
@@ -0,0 +1,45 @@
+#include "BenchFixtures.h"
+#include "../../shared/video/ClipLoader.h"
+#include "../../shared/video/ClipMotion.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * 이미지 시퀀스 import (PreviewController::setImageSequence 의 이미지 로드 + Timeline 생성 부분)
+ * - PreviewController 는 Android surface/EGL 을 쓰는 Renderer 에 묶여 있어 호스트에서 빌드할 수 없으므로,
+ *   같은 ClipLoadOptions(Preview 화면 크기, thumbnail + proxy 생성)로 ClipLoader::load -> Timeline::FromClipRenderData 를 그대로 수행한다.
+ * - 파일 읽기 + 축소 디코딩 + proxy/thumbnail 생성 비용이 대부분이며, 결과는 파일 하나당 처리량(items/s)으로 비교한다.
+ */
+void BM_ImportImageSequence(benchmark::State& state) {
+  const bool kenBurns = state.range(0) != 0;
+  const std::vector<std::string>& files = BenchFixtures::imageFiles();
+  if (files.empty()) {
+    state.SkipWithError("no fixture images");
+    return;
+  }
+
+  ClipLoadOptions opts;
+  opts.width = BenchFixtures::k_canvasWidth;
+  opts.height = BenchFixtures::k_canvasHeight;
+  opts.makeThumbnail = true;
+  opts.makeProxy = true;
+  opts.proxyScale = kenBurns ? ClipMotion::k_maxScale : 1.0f;
+  static const std::vector<std::shared_ptr<const ClipMotion>> s_noMotion;
+  const auto& motions = kenBurns ? ClipMotion::kenBurnsPresets() : s_noMotion;
+
+  for (auto _ : state) {
+    std::vector<Timeline::ClipRenderData> clips = ClipLoader::load(files, opts);
+    std::shared_ptr<Timeline> timeline = Timeline::FromClipRenderData(clips, 3.0, 0.5, {}, motions);
+    benchmark::DoNotOptimize(timeline.get());
+  }
+  state.SetItemsProcessed(state.iterations() * (int64_t)files.size());
+  state.counters["files"] = (double)files.size();
+}
+BENCHMARK(BM_ImportImageSequence)
+  ->Arg(0)->Arg(1)
+  ->ArgName("kenBurns")
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+} // namespace
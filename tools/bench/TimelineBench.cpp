@@ -0,0 +1,67 @@
+#include "BenchFixtures.h"
+#include "../../shared/video/ClipMotion.h"
+#include "../../shared/video/ColorManagedDecoder.h"
+#include <benchmark/benchmark.h>
+#include <core/SkSurface.h>
+#include <cmath>
+
+namespace {
+
+constexpr double k_clipDurSec = 3.0;
+constexpr double k_xfadeSec = 0.5;
+constexpr double k_frameSec = 1.0 / 30.0;
+
+const std::vector<std::shared_ptr<const ClipMotion>>& motionsFor(bool kenBurns) {
+  static const std::vector<std::shared_ptr<const ClipMotion>> s_noMotion;
+  return kenBurns ? ClipMotion::kenBurnsPresets() : s_noMotion;
+}
+
+// 클립 목록 -> Timeline 생성 (정렬, 트랙 구간 인덱스 생성 포함)
+void BM_TimelineFromClipRenderData(benchmark::State& state) {
+  const int clips = (int)state.range(0);
+  const bool kenBurns = state.range(1) != 0;
+  const std::vector<Timeline::ClipRenderData> data = BenchFixtures::makeClips(clips);
+  const auto& motions = motionsFor(kenBurns);
+
+  for (auto _ : state) {
+    std::shared_ptr<Timeline> timeline = Timeline::FromClipRenderData(data, k_clipDurSec, k_xfadeSec, {}, motions);
+    benchmark::DoNotOptimize(timeline.get());
+  }
+  state.SetItemsProcessed(state.iterations() * clips);
+}
+BENCHMARK(BM_TimelineFromClipRenderData)
+  ->ArgsProduct({ { 10, 100, 1000, 10000 }, { 0, 1 } })
+  ->ArgNames({ "clips", "kenBurns" })
+  ->Unit(benchmark::kMicrosecond);
+
+/**
+ * raster 캔버스에 Timeline::render (Preview 1프레임)
+ * - 프레임마다 1/30 초씩 진행하며 전체 길이를 반복하므로 fade 구간 비율이 실제 재생과 같다.
+ * - 클립 수가 늘어도 프레임 비용이 일정해야 함 (트랙 구간 인덱스 탐색은 O(log n))
+ */
+void BM_TimelineRender(benchmark::State& state) {
+  const int clips = (int)state.range(0);
+  const bool kenBurns = state.range(1) != 0;
+  std::shared_ptr<Timeline> timeline = Timeline::FromClipRenderData(BenchFixtures::makeClips(clips), k_clipDurSec, k_xfadeSec, {}, motionsFor(kenBurns));
+  sk_sp<SkSurface> surface = SkSurfaces::Raster(ColorManagedDecoder::outputInfo(BenchFixtures::k_canvasWidth, BenchFixtures::k_canvasHeight, true));
+  if (!timeline || !surface) {
+    state.SkipWithError("fixture setup failed");
+    return;
+  }
+
+  RenderContext ctx(surface->getCanvas(), BenchFixtures::k_canvasWidth, BenchFixtures::k_canvasHeight);
+  const double total = timeline->totalDuration();
+  double t = 0.0;
+  for (auto _ : state) {
+    ctx.timeSec = t;
+    timeline->render(ctx);
+    t = std::fmod(t + k_frameSec, total);
+  }
+  state.counters["fps"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TimelineRender)
+  ->ArgsProduct({ { 1, 10, 100, 1000 }, { 0, 1 } })
+  ->ArgNames({ "clips", "kenBurns" })
+  ->Unit(benchmark::kMillisecond);
+
+} // namespace
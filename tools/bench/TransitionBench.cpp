@@ -0,0 +1,44 @@
+#include "BenchFixtures.h"
+#include "../../shared/video/ClipLoader.h"
+#include "../../shared/video/ColorManagedDecoder.h"
+#include <benchmark/benchmark.h>
+#include <core/SkSurface.h>
+
+namespace {
+
+/**
+ * 전환 종류별 1프레임 그리기 (fade 구간 중간, raster 캔버스)
+ * - 진행률은 프레임마다 조금씩 바꿔 progress 에 따라 달라지는 경로(clip/변환/셰이더 uniform)를 골고루 거치도록 함
+ */
+void BM_TransitionDraw(benchmark::State& state) {
+  const TransitionType type = (TransitionType)state.range(0);
+  state.SetLabel(Transition::name(type));
+
+  const int w = BenchFixtures::k_canvasWidth;
+  const int h = BenchFixtures::k_canvasHeight;
+  sk_sp<SkSurface> surface = SkSurfaces::Raster(ColorManagedDecoder::outputInfo(w, h, true));
+  const SkRect dst = ClipLoader::fitWidthRect(BenchFixtures::k_sourceWidth, BenchFixtures::k_sourceHeight, w, h);
+  const Transition::Layer from{ BenchFixtures::makeImage(BenchFixtures::k_sourceWidth, BenchFixtures::k_sourceHeight, 0), dst };
+  const Transition::Layer to{ BenchFixtures::makeImage(BenchFixtures::k_sourceWidth, BenchFixtures::k_sourceHeight, 1), dst };
+  if (!surface || !from.image || !to.image) {
+    state.SkipWithError("fixture setup failed");
+    return;
+  }
+
+  SkCanvas* canvas = surface->getCanvas();
+  const SkRect bounds = SkRect::MakeWH((float)w, (float)h);
+  const SkSamplingOptions sampling(SkFilterMode::kLinear);
+  int frame = 0;
+  for (auto _ : state) {
+    const float progress = 0.25f + 0.5f * (float)(frame++ % 16) / 15.0f;
+    canvas->clear(SK_ColorBLACK);
+    Transition::draw(type, canvas, bounds, from, to, progress, sampling);
+  }
+  state.counters["fps"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TransitionDraw)
+  ->DenseRange(0, (int)TransitionType::Count - 1)
+  ->ArgName("type")
+  ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,47 @@
+#include "BenchFixtures.h"
+#include "../../shared/video/Transition.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef ENGINE_GIT_REVISION
+#define ENGINE_GIT_REVISION "unknown"
+#endif
+
+/**
+ * 엔진 마이크로벤치마크 (Google Benchmark)
+ *
+ * 사용법:
+ *   engine_bench [--fixture_dir=<사진 폴더>] [Google Benchmark 옵션...]
+ * 예:
+ *   engine_bench --benchmark_filter=BM_TimelineRender --benchmark_out=bench.json --benchmark_out_format=json
+ *
+ * - JSON 결과의 context 에 git revision 이 기록되므로, 커밋 간 결과를 비교할 수 있다.
+ *   (tools/compare.py 등 Google Benchmark 의 비교 도구를 그대로 사용)
+ */
+int main(int argc, char** argv) {
+  // --fixture_dir 는 이 도구의 옵션이므로 Google Benchmark 에 넘기기 전에 제거
+  const char* k_fixtureArg = "--fixture_dir=";
+  std::vector<char*> args;
+  for (int i = 0; i < argc; i++) {
+    if (std::strncmp(argv[i], k_fixtureArg, std::strlen(k_fixtureArg)) == 0) {
+      BenchFixtures::setFixtureDir(argv[i] + std::strlen(k_fixtureArg));
+      continue;
+    }
+    args.push_back(argv[i]);
+  }
+  int benchArgc = (int)args.size();
+
+  benchmark::Initialize(&benchArgc, args.data());
+  if (benchmark::ReportUnrecognizedArguments(benchArgc, args.data())) return 1;
+  benchmark::AddCustomContext("git_revision", ENGINE_GIT_REVISION);
+
+  // 전환 셰이더 컴파일 비용이 첫 측정에 섞이지 않도록 미리 컴파일
+  Transition::warmUp();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  BenchFixtures::cleanup();
+  return 0;
+}
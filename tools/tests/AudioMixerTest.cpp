@@ -0,0 +1,186 @@
+#include "TempDir.h"
+#include "../../shared/audio/AudioMixer.h"
+#include "../../shared/audio/AudioResampler.h"
+#include "../../shared/audio/WavSource.h"
+#include "../../shared/audio/WavWriter.h"
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace {
+
+constexpr int k_rate = 48000;
+
+// sample(frame, channel) 값으로 16bit WAV 파일 생성
+bool writeWav(const std::string& path, int sampleRate, int channels, int frames, const std::function<float(int, int)>& sample) {
+  WavWriter writer;
+  if (!writer.open(path, AudioFormat{ sampleRate, channels })) return false;
+  std::vector<int16_t> pcm((size_t)frames * channels);
+  for (int f = 0; f < frames; f++) {
+    for (int c = 0; c < channels; c++) {
+      pcm[(size_t)f * channels + c] = (int16_t)std::lround(sample(f, c) * 32768.0f);
+    }
+  }
+  return writer.write(pcm.data(), frames) && writer.close();
+}
+
+// 남은 블록을 모두 믹싱해 이어붙인 결과 (블록 수가 예상보다 많으면 중단)
+std::vector<int16_t> mixAll(AudioMixer& mixer, int maxBlocks = 10'000) {
+  std::vector<int16_t> out;
+  std::vector<int16_t> block((size_t)AudioMixer::k_blockFrames * mixer.format().channels);
+  for (int i = 0; i < maxBlocks && !mixer.finished(); i++) {
+    const int frames = mixer.mixNext(block.data());
+    if (frames <= 0) break;
+    out.insert(out.end(), block.begin(), block.begin() + (size_t)frames * mixer.format().channels);
+  }
+  return out;
+}
+
+AudioClip clipFor(const std::string& path, bool loop = false) {
+  AudioClip clip;
+  clip.path = path;
+  clip.loop = loop;
+  return clip;
+}
+
+} // namespace
+
+class AudioMixerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { ASSERT_TRUE(m_dir.valid()); };
+
+  TempDir m_dir;
+};
+
+TEST_F(AudioMixerTest, WavSourceRejectsEmptyDataChunk) {
+  const std::string path = m_dir.path("empty.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, 0, [](int, int) { return 0.0f; }));
+  EXPECT_EQ(WavSource::open(path), nullptr);
+}
+
+TEST_F(AudioMixerTest, LoopingEmptyFileProducesSilenceAndFinishes) {
+  const std::string path = m_dir.path("empty.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, 0, [](int, int) { return 0.0f; }));
+
+  AudioMixer mixer({ clipFor(path, true) }, 1.0);
+  const std::vector<int16_t> out = mixAll(mixer);
+  EXPECT_TRUE(mixer.finished());
+  EXPECT_EQ(out.size(), (size_t)k_rate * 2);
+  for (int16_t s : out) ASSERT_EQ(s, 0);
+}
+
+TEST_F(AudioMixerTest, LoopingTruncatedFileProducesSilenceAndFinishes) {
+  // 헤더는 1초 분량을 선언하지만 data 가 없는 파일 (열기는 성공, 읽기는 항상 0 프레임)
+  const std::string path = m_dir.path("truncated.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, k_rate, [](int, int) { return 0.5f; }));
+  ASSERT_EQ(truncate(path.c_str(), 44), 0);
+  ASSERT_NE(WavSource::open(path), nullptr);
+
+  AudioMixer mixer({ clipFor(path, true) }, 1.0);
+  const std::vector<int16_t> out = mixAll(mixer);
+  EXPECT_TRUE(mixer.finished());
+  for (int16_t s : out) ASSERT_EQ(s, 0);
+}
+
+TEST_F(AudioMixerTest, LoopingClipRepeatsShortSource) {
+  // 100 프레임짜리 원본을 1초 동안 반복 -> 끊김 없이 같은 값
+  const std::string path = m_dir.path("short.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, 100, [](int, int) { return 0.5f; }));
+
+  AudioMixer mixer({ clipFor(path, true) }, 1.0);
+  const std::vector<int16_t> out = mixAll(mixer);
+  ASSERT_EQ(out.size(), (size_t)k_rate * 2);
+  for (int16_t s : out) ASSERT_NEAR(s, 16384, 2);
+}
+
+TEST_F(AudioMixerTest, NonLoopingClipEndsWithSource) {
+  const std::string path = m_dir.path("short.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, 1000, [](int, int) { return 0.5f; }));
+
+  AudioMixer mixer({ clipFor(path) }, 0.1);
+  const std::vector<int16_t> out = mixAll(mixer);
+  ASSERT_EQ(out.size(), (size_t)4800 * 2);
+  EXPECT_NEAR(out[999 * 2], 16384, 2);
+  EXPECT_EQ(out[1000 * 2], 0);
+  EXPECT_EQ(out.back(), 0);
+}
+
+TEST_F(AudioMixerTest, ResamplesAndUpmixesMonoSource) {
+  // 24kHz mono 램프 -> 48kHz stereo: 출력 프레임 수 2배, 사이 프레임은 선형 보간, 두 채널 동일
+  const std::string path = m_dir.path("ramp.wav");
+  ASSERT_TRUE(writeWav(path, 24000, 1, 1000, [](int f, int) { return f / 2000.0f; }));
+  std::unique_ptr<WavSource> src = WavSource::open(path);
+  ASSERT_NE(src, nullptr);
+
+  AudioResampler resampler(std::move(src), AudioFormat{ k_rate, 2 });
+  std::vector<float> out(4000 * 2);
+  const int frames = resampler.read(out.data(), 4000);
+  EXPECT_NEAR(frames, 2000, 2);
+  for (int f = 0; f + 2 < frames; f++) {
+    ASSERT_NEAR(out[(size_t)f * 2], f / 4000.0f, 1e-3f) << "frame " << f;
+    ASSERT_EQ(out[(size_t)f * 2], out[(size_t)f * 2 + 1]);
+  }
+
+  // 되감으면 처음부터 같은 결과
+  ASSERT_TRUE(resampler.rewind());
+  std::vector<float> again(16);
+  ASSERT_EQ(resampler.read(again.data(), 8), 8);
+  for (int i = 0; i < 16; i++) EXPECT_EQ(again[i], out[i]);
+}
+
+TEST_F(AudioMixerTest, AppliesGainAndFades) {
+  const std::string path = m_dir.path("dc.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, k_rate, [](int, int) { return 0.5f; }));
+
+  AudioClip clip = clipFor(path);
+  clip.startSec = 0.25;
+  clip.durationSec = 0.5;
+  clip.gain = 0.5f;
+  clip.fadeInSec = 0.1;
+  clip.fadeOutSec = 0.1;
+  AudioMixer mixer({ clip }, 1.0);
+  const std::vector<int16_t> out = mixAll(mixer);
+  ASSERT_EQ(out.size(), (size_t)k_rate * 2);
+
+  auto at = [&](double sec) { return (int)out[(size_t)std::llround(sec * k_rate) * 2]; };
+  const int full = 8192; // 0.5 * 0.5
+  EXPECT_EQ(at(0.1), 0);                       // 시작 전
+  EXPECT_NEAR(at(0.25), 0, 200);               // fade-in 시작
+  EXPECT_NEAR(at(0.30), full / 2, 200);        // fade-in 중간
+  EXPECT_NEAR(at(0.5), full, 2);               // 최대 음량
+  EXPECT_NEAR(at(0.70), full / 2, 200);        // fade-out 중간
+  EXPECT_EQ(at(0.8), 0);                       // 종료 후
+}
+
+TEST_F(AudioMixerTest, BlockPtsFollowsSampleCount) {
+  const std::string path = m_dir.path("dc.wav");
+  ASSERT_TRUE(writeWav(path, k_rate, 2, 100, [](int, int) { return 0.25f; }));
+
+  // 1.01초 = 48480 프레임 = 1024 * 47 + 352
+  AudioMixer mixer({ clipFor(path, true) }, 1.01);
+  std::vector<int16_t> block((size_t)AudioMixer::k_blockFrames * 2);
+  int64_t frames = 0;
+  int blocks = 0;
+  while (!mixer.finished()) {
+    EXPECT_EQ(mixer.nextPtsUs(), frames * 1'000'000 / k_rate);
+    const int n = mixer.mixNext(block.data());
+    ASSERT_GT(n, 0);
+    if (!mixer.finished()) { EXPECT_EQ(n, AudioMixer::k_blockFrames); }
+    frames += n;
+    blocks++;
+  }
+  EXPECT_EQ(frames, 48480);
+  EXPECT_EQ(blocks, 48);
+  EXPECT_EQ(mixer.mixNext(block.data()), 0);
+}
+
+TEST_F(AudioMixerTest, MissingFileIsSkipped) {
+  AudioMixer mixer({ clipFor(m_dir.path("missing.wav"), true) }, 0.1);
+  EXPECT_TRUE(mixer.hasAudio());
+  const std::vector<int16_t> out = mixAll(mixer);
+  EXPECT_TRUE(mixer.finished());
+  for (int16_t s : out) ASSERT_EQ(s, 0);
+}
@@ -0,0 +1,205 @@
+#include "../../shared/video/ClipSequence.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+// 클립 구분용으로 dst.fLeft 에 번호를 넣은 클립
+Timeline::Segment makeClip(int id, double duration, double xfade) {
+  Timeline::Segment seg;
+  seg.clip.dst = SkRect::MakeXYWH((float)id, 0.0f, 1.0f, 1.0f);
+  seg.duration = duration;
+  seg.xfade = xfade;
+  return seg;
+}
+
+int idOf(const Timeline::Segment& seg) {
+  return (int)seg.clip.dst.fLeft;
+}
+
+// 같은 배치 규칙(앞 클립이 끝나기 xfade 초 전에 시작)으로 vector 에 시작 시간을 채움
+std::vector<Timeline::Segment> layout(std::vector<Timeline::Segment> segs) {
+  double t = 0.0;
+  for (auto& seg : segs) {
+    seg.start = t;
+    t += seg.duration - seg.xfade;
+  }
+  return segs;
+}
+
+// 시퀀스가 기대 목록(expected, 순서/길이)과 같은지 모든 조회 경로로 확인
+void expectSameAs(const ClipSequence& seq, const std::vector<Timeline::Segment>& expected) {
+  const std::vector<Timeline::Segment> laid = layout(expected);
+  ASSERT_EQ(seq.size(), laid.size());
+
+  const std::vector<Timeline::Segment> segs = seq.toSegments();
+  ASSERT_EQ(segs.size(), laid.size());
+  for (size_t i = 0; i < laid.size(); i++) {
+    EXPECT_EQ(idOf(segs[i]), idOf(laid[i])) << "index " << i;
+    EXPECT_DOUBLE_EQ(segs[i].duration, laid[i].duration) << "index " << i;
+    EXPECT_DOUBLE_EQ(segs[i].xfade, laid[i].xfade) << "index " << i;
+    EXPECT_NEAR(segs[i].start, laid[i].start, 1e-9) << "index " << i;
+    EXPECT_EQ(idOf(seq.at(i)), idOf(laid[i])) << "index " << i;
+    EXPECT_NEAR(seq.startOf(i), laid[i].start, 1e-9) << "index " << i;
+  }
+
+  size_t visited = 0;
+  seq.forEach([&](const Timeline::Segment& seg, double start) {
+    ASSERT_LT(visited, laid.size());
+    EXPECT_EQ(idOf(seg), idOf(laid[visited]));
+    EXPECT_NEAR(start, laid[visited].start, 1e-9);
+    visited++;
+  });
+  EXPECT_EQ(visited, laid.size());
+
+  double endTime = 0.0;
+  for (const auto& seg : laid) endTime = std::max(endTime, seg.start + seg.duration);
+  EXPECT_NEAR(seq.endTime(), endTime, 1e-9);
+}
+
+// playingAt 을 전체 탐색 결과와 비교
+void expectPlayingMatches(const ClipSequence& seq, const std::vector<Timeline::Segment>& expected, double tSec) {
+  const std::vector<Timeline::Segment> laid = layout(expected);
+  std::vector<size_t> brute;
+  for (size_t i = 0; i < laid.size(); i++) {
+    if (tSec >= laid[i].start && tSec < laid[i].start + laid[i].duration) brute.push_back(i);
+  }
+
+  size_t found[64];
+  const int count = seq.playingAt(tSec, found, 64);
+  ASSERT_EQ((size_t)count, brute.size()) << "t=" << tSec;
+  for (int k = 0; k < count; k++) {
+    EXPECT_EQ(found[k], brute[k]) << "t=" << tSec;
+  }
+
+  // 넘치면 나중 클립 우선
+  if (brute.size() > 1) {
+    size_t last[1];
+    ASSERT_EQ(seq.playingAt(tSec, last, 1), 1);
+    EXPECT_EQ(last[0], brute.back()) << "t=" << tSec;
+  }
+}
+
+} // namespace
+
+TEST(ClipSequenceTest, FromSegmentsKeepsOrderAndLaysOutStarts) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 50; i++) {
+    Timeline::Segment seg = makeClip(i, 1.0 + (i % 3), (i % 2) ? 0.5 : 0.0);
+    seg.start = 1000.0 - i; // 원래 시작 시간은 무시
+    clips.push_back(seg);
+  }
+  expectSameAs(ClipSequence::fromSegments(clips), clips);
+}
+
+TEST(ClipSequenceTest, EmptySequence) {
+  ClipSequence seq;
+  EXPECT_TRUE(seq.empty());
+  EXPECT_EQ(seq.size(), 0u);
+  EXPECT_TRUE(seq.toSegments().empty());
+  EXPECT_DOUBLE_EQ(seq.endTime(), 0.0);
+  size_t out[4];
+  EXPECT_EQ(seq.playingAt(0.0, out, 4), 0);
+}
+
+TEST(ClipSequenceTest, EditsMatchVectorModel) {
+  std::mt19937 rng(1234);
+  std::vector<Timeline::Segment> model;
+  ClipSequence seq;
+  int nextId = 0;
+
+  for (int step = 0; step < 400; step++) {
+    const int op = model.empty() ? 0 : (int)(rng() % 5);
+    if (op == 0) {
+      const size_t index = rng() % (model.size() + 1);
+      Timeline::Segment clip = makeClip(nextId++, 0.5 + (rng() % 4), (rng() % 3) * 0.25);
+      seq = seq.insert(index, clip);
+      model.insert(model.begin() + (std::ptrdiff_t)index, clip);
+    } else if (op == 1) {
+      const size_t index = rng() % model.size();
+      seq = seq.erase(index);
+      model.erase(model.begin() + (std::ptrdiff_t)index);
+    } else if (op == 2) {
+      const size_t from = rng() % model.size();
+      const size_t to = rng() % model.size();
+      seq = seq.move(from, to);
+      Timeline::Segment clip = model[from];
+      model.erase(model.begin() + (std::ptrdiff_t)from);
+      model.insert(model.begin() + (std::ptrdiff_t)to, clip);
+    } else if (op == 3) {
+      const size_t index = rng() % model.size();
+      Timeline::Segment clip = makeClip(nextId++, model[index].duration, model[index].xfade);
+      seq = seq.replace(index, clip);
+      model[index] = clip;
+    } else {
+      const size_t index = rng() % model.size();
+      const double duration = 0.5 + (rng() % 4);
+      const double xfade = (rng() % 3) * 0.25;
+      seq = seq.retime(index, duration, xfade);
+      model[index].duration = duration;
+      model[index].xfade = xfade;
+    }
+    expectSameAs(seq, model);
+  }
+}
+
+TEST(ClipSequenceTest, EditsDoNotChangePreviousVersion) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 10; i++) clips.push_back(makeClip(i, 2.0, 0.5));
+  const ClipSequence original = ClipSequence::fromSegments(clips);
+
+  original.insert(3, makeClip(100, 1.0, 0.0));
+  original.erase(0);
+  original.move(1, 8);
+  original.replace(5, makeClip(200, 2.0, 0.5));
+  original.retime(2, 10.0, 1.0);
+  expectSameAs(original, clips);
+}
+
+TEST(ClipSequenceTest, OutOfRangeIndexIsClampedToEnd) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 3; i++) clips.push_back(makeClip(i, 1.0, 0.0));
+  const ClipSequence seq = ClipSequence::fromSegments(clips);
+
+  std::vector<Timeline::Segment> expected = clips;
+  expected.push_back(makeClip(9, 1.0, 0.0));
+  expectSameAs(seq.insert(100, makeClip(9, 1.0, 0.0)), expected);
+
+  expected = { clips[1], clips[2], clips[0] };
+  expectSameAs(seq.move(0, 100), expected);
+}
+
+TEST(ClipSequenceTest, PlayingAtMatchesBruteForce) {
+  std::mt19937 rng(42);
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 200; i++) {
+    // xfade 가 길이보다 긴 클립(뒤 클립들과 오래 겹침)도 섞음
+    const double duration = 0.5 + (rng() % 6) * 0.5;
+    const double xfade = (rng() % 10 == 0) ? duration + 3.0 : (rng() % 3) * 0.25;
+    clips.push_back(makeClip(i, duration, xfade));
+  }
+  const ClipSequence seq = ClipSequence::fromSegments(clips);
+  for (double t = -1.0; t < seq.endTime() + 1.0; t += 0.125) {
+    expectPlayingMatches(seq, clips, t);
+  }
+}
+
+TEST(ClipSequenceTest, PlayingAtAfterEdits) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 30; i++) clips.push_back(makeClip(i, 2.0, 0.5));
+  // 맨 앞에 긴 클립을 끼워 넣어 뒤 클립 전체와 겹치게 함
+  ClipSequence seq = ClipSequence::fromSegments(clips).insert(0, makeClip(100, 60.0, 60.0));
+  clips.insert(clips.begin(), makeClip(100, 60.0, 60.0));
+  seq = seq.retime(10, 5.0, 1.0);
+  clips[10].duration = 5.0;
+  clips[10].xfade = 1.0;
+  seq = seq.move(5, 20);
+  Timeline::Segment moved = clips[5];
+  clips.erase(clips.begin() + 5);
+  clips.insert(clips.begin() + 20, moved);
+
+  for (double t = 0.0; t < seq.endTime() + 0.5; t += 0.25) {
+    expectPlayingMatches(seq, clips, t);
+  }
+}
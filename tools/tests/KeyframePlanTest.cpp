@@ -0,0 +1,97 @@
+#include "../../shared/encoder/KeyframePlan.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+// 이미지 없이 시간 정보만 있는 클립 (KeyframePlan 은 클립 배치만 봄)
+Timeline::Segment makeClip(double start, double duration, double xfade = 0.0) {
+  return Timeline::Segment(Timeline::ClipRenderData(), duration, start, xfade);
+}
+
+/**
+ * fps 10 기준 (프레임 i = i / 10 초), 전체 19초 = 190 프레임
+ * 기본 트랙
+ * - [0, 3)                  -> 3.0 에 hard cut (프레임 30)
+ * - [3, 7), 끝 1초 xfade     -> 다음 클립이 6.0 에 들어오고 전환이 끝나는 7.0 (프레임 70)
+ * - [6, 8)                  -> 8.0 에 hard cut (프레임 80)
+ * - [8, 8.3)                -> 8.3 에 hard cut (프레임 83, 80 과 최소 간격 5 프레임 이내라 건너뜀)
+ * - [8.3, 19)
+ * overlay 트랙
+ * - [1.25, 2.25)            -> 나타나는 프레임 13, 사라지는 프레임 23
+ */
+void buildSample(Timeline& timeline) {
+  std::vector<Timeline::Segment> base = {
+    makeClip(0.0, 3.0),
+    makeClip(3.0, 4.0, 1.0),
+    makeClip(6.0, 2.0),
+    makeClip(8.0, 0.3),
+    makeClip(8.3, 10.7),
+  };
+  std::vector<Timeline::Segment> overlay = { makeClip(1.25, 1.0) };
+  timeline.setSegments(base);
+  timeline.addTrack(overlay);
+}
+
+} // namespace
+
+TEST(KeyframePlanTest, BoundaryTimesCoverCutsFadeEndsAndOverlays) {
+  Timeline timeline;
+  buildSample(timeline);
+  const std::vector<double> times = KeyframePlan::boundaryTimes(timeline);
+  const std::vector<double> expected = { 1.25, 2.25, 3.0, 7.0, 8.0, 8.3 };
+  ASSERT_EQ(times.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_DOUBLE_EQ(times[i], expected[i]) << "index " << i;
+  }
+}
+
+TEST(KeyframePlanTest, KeyframesOnBoundariesWithoutMaxInterval) {
+  Timeline timeline;
+  buildSample(timeline);
+  // 최대 간격 제한 없음: 경계만 (83 은 80 과 너무 가까워 건너뜀)
+  const KeyframePlan plan = KeyframePlan::build(timeline, 10, 0.0, 0.5);
+  EXPECT_EQ(plan.frames(), std::vector<int>({ 0, 13, 23, 30, 70, 80 }));
+  EXPECT_TRUE(plan.isKeyframe(70));
+  EXPECT_FALSE(plan.isKeyframe(60));
+  EXPECT_FALSE(plan.isKeyframe(83));
+}
+
+TEST(KeyframePlanTest, MaxIntervalFillsLongRuns) {
+  Timeline timeline;
+  buildSample(timeline);
+  // 최대 4초(40 프레임): 30 -> 70 은 정확히 40 이므로 채우지 않고, 80 이후 끝(190)까지는 120, 160 을 채움
+  const KeyframePlan plan = KeyframePlan::build(timeline, 10, 4.0, 0.5);
+  EXPECT_EQ(plan.frames(), std::vector<int>({ 0, 13, 23, 30, 70, 80, 120, 160 }));
+}
+
+TEST(KeyframePlanTest, FilledKeyframeDoesNotSwallowNextBoundary) {
+  // 0 -> 42(hard cut) 사이를 최대 40 프레임으로 채울 때 40 이 아니라 42 - 최소 간격(5) = 37 에 넣어 42 도 유지
+  std::vector<Timeline::Segment> base = { makeClip(0.0, 4.2), makeClip(4.2, 1.0) };
+  Timeline timeline;
+  timeline.setSegments(base);
+  const KeyframePlan plan = KeyframePlan::build(timeline, 10, 4.0, 0.5);
+  EXPECT_EQ(plan.frames(), std::vector<int>({ 0, 37, 42 }));
+}
+
+TEST(KeyframePlanTest, LateFirstClipStartsWithKeyframe) {
+  // 첫 클립이 늦게 시작하면 그 시작도 경계
+  std::vector<Timeline::Segment> base = { makeClip(1.0, 2.0) };
+  Timeline timeline;
+  timeline.setSegments(base);
+  EXPECT_EQ(KeyframePlan::build(timeline, 10, 0.0, 0.5).frames(), std::vector<int>({ 0, 10 }));
+}
+
+TEST(KeyframePlanTest, FromConfigHonoursContentAwareFlag) {
+  Timeline timeline;
+  buildSample(timeline);
+  EncoderConfig cfg;
+  cfg.fps = 10;
+  cfg.maxKeyframeIntervalSec = 4;
+  cfg.contentAwareKeyframes = true;
+  EXPECT_EQ(KeyframePlan::fromConfig(timeline, cfg).frames(), std::vector<int>({ 0, 13, 23, 30, 70, 80, 120, 160 }));
+
+  // 꺼져 있으면 빈 계획 (Codec 의 고정 간격 사용)
+  cfg.contentAwareKeyframes = false;
+  EXPECT_TRUE(KeyframePlan::fromConfig(timeline, cfg).empty());
+}
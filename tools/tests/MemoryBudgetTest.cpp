@@ -0,0 +1,165 @@
+#include "../../shared/memory/MemoryBudget.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 회수 요청을 받으면 들고 있는 바이트를 전부 해제하는 가짜 source (호출 순서/강도 기록)
+struct FakeSource
+{
+  std::string name;
+  size_t bytes = 0;
+  std::vector<TrimLevel> trims;         // 받은 회수 요청
+};
+
+// 여러 FakeSource 의 회수 순서 기록
+using TrimLog = std::vector<std::string>;
+
+MemoryBudget::Registration addFake(MemoryBudget& budget, const std::shared_ptr<FakeSource>& source, const std::shared_ptr<TrimLog>& log,
+                                   int evictionOrder, MemoryCategory category = MemoryCategory::Decoded) {
+  return budget.addSource(source->name, category,
+    [source]() { return source->bytes; },
+    [source, log](TrimLevel level) {
+      source->trims.push_back(level);
+      source->bytes = 0;
+      log->push_back(source->name);
+    },
+    evictionOrder);
+}
+
+std::shared_ptr<FakeSource> makeFake(const std::string& name, size_t bytes) {
+  auto source = std::make_shared<FakeSource>();
+  source->name = name;
+  source->bytes = bytes;
+  return source;
+}
+
+// 예산 1000 byte 에 300 byte 씩 세 source (합계 900): 회수 순서는 a -> b -> c
+class MemoryBudgetTest : public ::testing::Test
+{
+protected:
+  void SetUp() override {
+    m_budget = MemoryBudget::create(1000);
+    m_log = std::make_shared<TrimLog>();
+    // 등록 순서와 회수 순서가 다르도록 일부러 섞어서 등록
+    m_c = makeFake("c", 300);
+    m_a = makeFake("a", 300);
+    m_b = makeFake("b", 300);
+    m_regs.push_back(addFake(*m_budget, m_c, m_log, 2));
+    m_regs.push_back(addFake(*m_budget, m_a, m_log, 0));
+    m_regs.push_back(addFake(*m_budget, m_b, m_log, 1));
+  }
+
+  std::shared_ptr<MemoryBudget> m_budget;
+  std::shared_ptr<TrimLog> m_log;
+  std::shared_ptr<FakeSource> m_a, m_b, m_c;
+  std::vector<MemoryBudget::Registration> m_regs;
+};
+
+} // namespace
+
+TEST_F(MemoryBudgetTest, LightTrimsDownToThreeQuartersOfBudget) {
+  // 목표 750: a 를 회수하면 600 이 되어 멈춤
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::Light), 300u);
+  EXPECT_EQ(*m_log, TrimLog({ "a" }));
+  EXPECT_EQ(m_a->trims, std::vector<TrimLevel>({ TrimLevel::Light }));
+  EXPECT_TRUE(m_b->trims.empty());
+  EXPECT_TRUE(m_c->trims.empty());
+  EXPECT_EQ(m_budget->stats().totalBytes, 600u);
+}
+
+TEST_F(MemoryBudgetTest, ModerateTrimsDownToHalfOfBudget) {
+  // 목표 500: a(-> 600), b(-> 300) 순으로 회수하고 c 는 유지
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::Moderate), 600u);
+  EXPECT_EQ(*m_log, TrimLog({ "a", "b" }));
+  EXPECT_EQ(m_b->trims, std::vector<TrimLevel>({ TrimLevel::Moderate }));
+  EXPECT_TRUE(m_c->trims.empty());
+  EXPECT_EQ(m_c->bytes, 300u);
+}
+
+TEST_F(MemoryBudgetTest, CriticalTrimsEverything) {
+  // 목표 0: 예산 안이어도 모든 source 회수
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::Critical), 900u);
+  EXPECT_EQ(*m_log, TrimLog({ "a", "b", "c" }));
+  EXPECT_EQ(m_budget->stats().totalBytes, 0u);
+}
+
+TEST_F(MemoryBudgetTest, NoneAndUnderTargetTrimNothing) {
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::None), 0u);
+  m_budget->setBudgetBytes(2000);
+  // 목표 1500 > 900 이므로 회수하지 않음
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::Light), 0u);
+  EXPECT_EQ(m_budget->enforceBudget(), 0u);
+  EXPECT_TRUE(m_log->empty());
+}
+
+TEST_F(MemoryBudgetTest, EnforceBudgetTrimsOnlyWhenOverBudget) {
+  m_budget->setBudgetBytes(800);
+  // 900 > 800 -> Light (목표 600): a 회수 후 600 이면 예산 안이므로 Moderate 는 생략
+  EXPECT_EQ(m_budget->enforceBudget(), 300u);
+  EXPECT_EQ(*m_log, TrimLog({ "a" }));
+  EXPECT_EQ(m_a->trims, std::vector<TrimLevel>({ TrimLevel::Light }));
+
+  // 예산을 더 줄이면 Light 목표(225)까지 남은 b, c 를 순서대로 회수
+  m_budget->setBudgetBytes(300);
+  EXPECT_EQ(m_budget->enforceBudget(), 600u);
+  EXPECT_EQ(*m_log, TrimLog({ "a", "b", "c" }));
+  EXPECT_EQ(m_b->trims, std::vector<TrimLevel>({ TrimLevel::Light }));
+  EXPECT_EQ(m_c->trims, std::vector<TrimLevel>({ TrimLevel::Light }));
+}
+
+TEST_F(MemoryBudgetTest, SkipsEmptyAndUntrimmableSources) {
+  // 회수 함수가 없는 source 는 집계만, 비어있는 source 는 회수 요청하지 않음
+  size_t fixedBytes = 400;
+  auto reg = m_budget->addSource("fixed", MemoryCategory::RenderTargets, [&fixedBytes]() { return fixedBytes; }, nullptr, -1);
+  m_a->bytes = 0;
+
+  const MemoryStats stats = m_budget->stats();
+  EXPECT_EQ(stats.totalBytes, 1000u);
+  EXPECT_EQ(stats.of(MemoryCategory::RenderTargets), 400u);
+  EXPECT_EQ(stats.of(MemoryCategory::Decoded), 600u);
+
+  EXPECT_EQ(m_budget->trimMemory(TrimLevel::Critical), 600u);
+  EXPECT_EQ(*m_log, TrimLog({ "b", "c" }));
+  EXPECT_TRUE(m_a->trims.empty());
+}
+
+TEST_F(MemoryBudgetTest, RegistrationUnregistersOnDestruction) {
+  {
+    auto extra = makeFake("extra", 500);
+    MemoryBudget::Registration reg = addFake(*m_budget, extra, m_log, -1);
+    EXPECT_EQ(m_budget->stats().totalBytes, 1400u);
+  }
+  EXPECT_EQ(m_budget->stats().totalBytes, 900u);
+
+  // 이동한 핸들은 한 번만 해제
+  MemoryBudget::Registration moved = std::move(m_regs[1]);
+  EXPECT_EQ(m_budget->stats().totalBytes, 900u);
+  moved.reset();
+  m_regs[1].reset();
+  EXPECT_EQ(m_budget->stats().totalBytes, 600u);
+
+  m_budget->trimMemory(TrimLevel::Critical);
+  EXPECT_EQ(*m_log, TrimLog({ "b", "c" }));
+  EXPECT_EQ(m_a->bytes, 300u);
+}
+
+TEST_F(MemoryBudgetTest, RegistrationOutlivingBudgetIsSafe) {
+  m_budget.reset();
+  // MemoryBudget 이 먼저 사라져도 핸들 소멸은 아무것도 하지 않음
+  m_regs.clear();
+  SUCCEED();
+}
+
+TEST(MemoryBudgetLevelTest, MapsAndroidTrimLevels) {
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(0), TrimLevel::None);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(5), TrimLevel::Light);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(10), TrimLevel::Light);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(15), TrimLevel::Moderate);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(20), TrimLevel::Moderate);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(40), TrimLevel::Moderate);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(60), TrimLevel::Critical);
+  EXPECT_EQ(MemoryBudget::levelFromAndroid(80), TrimLevel::Critical);
+}
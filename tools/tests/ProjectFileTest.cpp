@@ -0,0 +1,253 @@
+#include "../../shared/project/ProjectFile.h"
+#include "../../shared/video/ClipMotion.h"
+#include "../../shared/video/ClipSequence.h"
+#include "TempDir.h"
+#include <core/SkBitmap.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace {
+
+// 내용만 다른 가짜 asset 파일 (저장은 quickHash 만 하므로 이미지일 필요 없음)
+void writeFile(const std::string& path, const std::string& content) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out << content;
+}
+
+std::vector<uint8_t> readBytes(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<uint8_t>& bytes) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+}
+
+Timeline::Segment makeClip(const std::string& path, double start, double duration, double xfade, const SkRect& dst) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(4, 3);
+  Timeline::Segment seg(Timeline::ClipRenderData(bitmap.asImage(), dst), duration, start, xfade);
+  seg.clip.path = path;
+  return seg;
+}
+
+class ProjectFileTest : public ::testing::Test
+{
+protected:
+  void SetUp() override {
+    ASSERT_TRUE(m_dir.valid());
+    writeFile(m_dir.path("a.jpg"), "first image");
+    writeFile(m_dir.path("b.jpg"), "second image");
+  }
+
+  // 기본 트랙 3개(두 클립이 같은 asset) + overlay 1개 + 애니메이션 + 오디오 2개로 저장
+  std::string saveSample() {
+    std::vector<Timeline::Segment> base;
+    base.push_back(makeClip(m_dir.path("a.jpg"), 0.0, 2.0, 0.5, SkRect::MakeLTRB(0, 100, 1080, 900)));
+    base.push_back(makeClip(m_dir.path("b.jpg"), 1.5, 3.0, 0.25, SkRect::MakeLTRB(0, 50, 1080, 950)));
+    base.push_back(makeClip(m_dir.path("a.jpg"), 4.25, 2.0, 0.0, SkRect::MakeLTRB(0, 100, 1080, 900)));
+    base[1].transition = TransitionType::WipeLeft;
+    base[1].motion = ClipMotion::bake({ MotionKeyframe{ 0.0f, 1.0f, 0.0f, 0.0f, 0.0f }, MotionKeyframe{ 1.0f, 1.3f, 0.1f, -0.05f, 5.0f } });
+    std::vector<Timeline::Segment> overlay;
+    overlay.push_back(makeClip(m_dir.path("b.jpg"), 1.0, 1.0, 0.0, SkRect::MakeLTRB(10, 10, 110, 110)));
+
+    Timeline timeline;
+    timeline.setSegments(base);
+    timeline.addTrack(overlay);
+
+    AudioClip music;
+    music.path = m_dir.path("music.wav");
+    music.gain = 0.5f;
+    music.fadeOutSec = 1.0;
+    music.loop = true;
+    AudioClip voice;
+    voice.path = m_dir.path("voice.wav");
+    voice.startSec = 1.5;
+    voice.durationSec = 3.0;
+    voice.fadeInSec = 0.5;
+    voice.fadeOutSec = 0.25;
+    timeline.setAudioClips({ music, voice });
+
+    const std::string path = m_dir.path("sample.skproj");
+    EXPECT_TRUE(ProjectFile::save(path, timeline, 1080, 1920));
+    return path;
+  }
+
+  // 저장한 파일을 patch 로 고친 복사본이 열리지 않는지 확인
+  template <typename Patch>
+  void expectRejected(const std::string& source, Patch patch) {
+    std::vector<uint8_t> bytes = readBytes(source);
+    ASSERT_GE(bytes.size(), sizeof(ProjectFile::Header));
+    patch(bytes);
+    const std::string path = m_dir.path("corrupt.skproj");
+    writeBytes(path, bytes);
+    ProjectFile file;
+    EXPECT_FALSE(file.open(path));
+    EXPECT_FALSE(file.isOpen());
+  }
+
+  static ProjectFile::Header headerOf(const std::vector<uint8_t>& bytes) {
+    ProjectFile::Header h;
+    std::memcpy(&h, bytes.data(), sizeof(h));
+    return h;
+  }
+
+  // clips section 의 i 번째 레코드 필드를 value 로 덮어씀
+  template <typename T>
+  static void patchClip(std::vector<uint8_t>& bytes, size_t i, size_t fieldOffset, T value) {
+    const ProjectFile::Header h = headerOf(bytes);
+    std::memcpy(bytes.data() + h.clips.offset + i * h.clips.stride + fieldOffset, &value, sizeof(T));
+  }
+
+  TempDir m_dir;
+};
+
+} // namespace
+
+TEST_F(ProjectFileTest, RoundTripKeepsRecords) {
+  const std::string path = saveSample();
+  ProjectFile file;
+  ASSERT_TRUE(file.open(path));
+
+  EXPECT_EQ(file.canvasWidth(), 1080);
+  EXPECT_EQ(file.canvasHeight(), 1920);
+  EXPECT_DOUBLE_EQ(file.totalDuration(), 6.25);
+
+  // 같은 경로를 쓰는 클립은 asset 하나를 공유
+  ASSERT_EQ(file.assetCount(), 2u);
+  EXPECT_EQ(file.assetPath(file.clip(0, 0).asset), m_dir.path("a.jpg"));
+  EXPECT_EQ(file.assetPath(file.clip(0, 1).asset), m_dir.path("b.jpg"));
+  EXPECT_EQ(file.clip(0, 0).asset, file.clip(0, 2).asset);
+  EXPECT_EQ(file.asset(file.clip(0, 0).asset).width, 4);
+  EXPECT_EQ(file.asset(file.clip(0, 0).asset).height, 3);
+
+  ASSERT_EQ(file.trackCount(), 2);
+  ASSERT_EQ(file.clipCount(0), 3u);
+  ASSERT_EQ(file.clipCount(1), 1u);
+
+  const ProjectFile::ClipRecord& second = file.clip(0, 1);
+  EXPECT_DOUBLE_EQ(second.start, 1.5);
+  EXPECT_DOUBLE_EQ(second.duration, 3.0);
+  EXPECT_DOUBLE_EQ(second.xfade, 0.25);
+  EXPECT_FLOAT_EQ(second.dst[1], 50.0f);
+  EXPECT_FLOAT_EQ(second.dst[3], 950.0f);
+  EXPECT_EQ(second.transition, (uint32_t)TransitionType::WipeLeft);
+  EXPECT_EQ(second.motion, 0);
+  EXPECT_EQ(file.clip(0, 0).motion, -1);
+
+  const ProjectFile::ClipRecord& overlay = file.clip(1, 0);
+  EXPECT_DOUBLE_EQ(overlay.start, 1.0);
+  EXPECT_FLOAT_EQ(overlay.dst[2], 110.0f);
+
+  // 저장 이후 바뀐 asset 감지
+  EXPECT_EQ(file.verifyAssets(), 0u);
+  writeFile(m_dir.path("b.jpg"), "edited image");
+  std::vector<size_t> changed;
+  EXPECT_EQ(file.verifyAssets(&changed), 1u);
+  ASSERT_EQ(changed.size(), 1u);
+  EXPECT_EQ(changed[0], (size_t)file.clip(0, 1).asset);
+}
+
+TEST_F(ProjectFileTest, SequenceTrackSavesLaidOutStarts) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 5; i++) {
+    clips.push_back(makeClip(m_dir.path(i % 2 ? "b.jpg" : "a.jpg"), 0.0, 2.0, 0.5, SkRect::MakeWH(1080, 1920)));
+  }
+  // 편집된 시퀀스로 만든 트랙도 시작 시간을 채워 저장
+  const ClipSequence seq = ClipSequence::fromSegments(clips).retime(1, 4.0, 1.0).move(0, 4);
+  std::shared_ptr<Timeline> timeline = Timeline().withSequence(0, seq);
+  const std::string path = m_dir.path("sequence.skproj");
+  ASSERT_TRUE(ProjectFile::save(path, *timeline, 1080, 1920));
+
+  ProjectFile file;
+  ASSERT_TRUE(file.open(path));
+  ASSERT_EQ(file.clipCount(0), seq.size());
+  for (size_t i = 0; i < seq.size(); i++) {
+    EXPECT_DOUBLE_EQ(file.clip(0, i).start, seq.startOf(i)) << "index " << i;
+    EXPECT_DOUBLE_EQ(file.clip(0, i).duration, seq.at(i).duration) << "index " << i;
+  }
+  EXPECT_DOUBLE_EQ(file.totalDuration(), seq.totalDuration());
+}
+
+TEST_F(ProjectFileTest, RejectsTruncatedFile) {
+  const std::string path = saveSample();
+  expectRejected(path, [](std::vector<uint8_t>& bytes) { bytes.resize(bytes.size() - 8); });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) { bytes.resize(sizeof(ProjectFile::Header) / 2); });
+  // fileSize 까지 함께 줄이면 section 범위 검사에서 거부
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    ProjectFile::Header h = headerOf(bytes);
+    bytes.resize(h.clips.offset + h.clips.stride);
+    h.fileSize = bytes.size();
+    std::memcpy(bytes.data(), &h, sizeof(h));
+  });
+}
+
+TEST_F(ProjectFileTest, RejectsCorruptHeaderAndReferences) {
+  const std::string path = saveSample();
+  expectRejected(path, [](std::vector<uint8_t>& bytes) { bytes[0] = 'X'; });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    ProjectFile::Header h = headerOf(bytes);
+    h.version = ProjectFile::k_version + 1;
+    std::memcpy(bytes.data(), &h, sizeof(h));
+  });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    ProjectFile::Header h = headerOf(bytes);
+    h.totalDuration = std::numeric_limits<double>::quiet_NaN();
+    std::memcpy(bytes.data(), &h, sizeof(h));
+  });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    ProjectFile::Header h = headerOf(bytes);
+    h.clips.offset += 4; // 8 byte 정렬 깨짐
+    std::memcpy(bytes.data(), &h, sizeof(h));
+  });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    patchClip(bytes, 0, offsetof(ProjectFile::ClipRecord, asset), (uint32_t)99);
+  });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    patchClip(bytes, 1, offsetof(ProjectFile::ClipRecord, motion), (int32_t)5);
+  });
+}
+
+TEST_F(ProjectFileTest, RejectsNonFiniteOrNegativeTimes) {
+  const std::string path = saveSample();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  expectRejected(path, [nan](std::vector<uint8_t>& bytes) { patchClip(bytes, 1, offsetof(ProjectFile::ClipRecord, start), nan); });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) { patchClip(bytes, 1, offsetof(ProjectFile::ClipRecord, start), -1.0); });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) { patchClip(bytes, 2, offsetof(ProjectFile::ClipRecord, duration), -2.0); });
+  expectRejected(path, [inf](std::vector<uint8_t>& bytes) { patchClip(bytes, 0, offsetof(ProjectFile::ClipRecord, duration), inf); });
+  expectRejected(path, [inf](std::vector<uint8_t>& bytes) { patchClip(bytes, 0, offsetof(ProjectFile::ClipRecord, xfade), inf); });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    patchClip(bytes, 3, offsetof(ProjectFile::ClipRecord, dst) + sizeof(float), std::numeric_limits<float>::quiet_NaN());
+  });
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    const ProjectFile::Header h = headerOf(bytes);
+    const float nanScale = std::numeric_limits<float>::quiet_NaN();
+    std::memcpy(bytes.data() + h.keyframes.offset + h.keyframes.stride + offsetof(ProjectFile::KeyframeRecord, scale), &nanScale, sizeof(float));
+  });
+  // 0 이하/비정상적으로 큰 확대 배율 (proxy 크기 계산이 int 범위를 넘음)
+  for (const float badScale : { 1e30f, 0.0f, -1.0f }) {
+    expectRejected(path, [badScale](std::vector<uint8_t>& bytes) {
+      const ProjectFile::Header h = headerOf(bytes);
+      std::memcpy(bytes.data() + h.keyframes.offset + h.keyframes.stride + offsetof(ProjectFile::KeyframeRecord, scale), &badScale, sizeof(float));
+    });
+  }
+  expectRejected(path, [](std::vector<uint8_t>& bytes) {
+    const ProjectFile::Header h = headerOf(bytes);
+    const float gain = -1.0f;
+    std::memcpy(bytes.data() + h.audioClips.offset + offsetof(ProjectFile::AudioRecord, gain), &gain, sizeof(float));
+  });
+  expectRejected(path, [nan](std::vector<uint8_t>& bytes) {
+    const ProjectFile::Header h = headerOf(bytes);
+    std::memcpy(bytes.data() + h.audioClips.offset + h.audioClips.stride + offsetof(ProjectFile::AudioRecord, fadeIn), &nan, sizeof(double));
+  });
+
+  // 고치지 않은 원본은 그대로 열림
+  ProjectFile file;
+  EXPECT_TRUE(file.open(path));
+}
@@ -0,0 +1,89 @@
+#include "../../shared/task/TaskScheduler.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <condition_variable>
+#include <mutex>
+
+namespace {
+
+// 작업이 테스트 함수보다 늦게 끝날 수 있으므로 Gate/Counter 는 shared_ptr 로 작업에 넘김
+class Gate
+{
+public:
+  void open() {
+    { std::lock_guard<std::mutex> lock(m_mtx); m_open = true; }
+    m_cv.notify_all();
+  }
+  void wait() {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_cv.wait(lock, [this]() { return m_open; });
+  }
+  bool waitFor(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    return m_cv.wait_for(lock, timeout, [this]() { return m_open; });
+  }
+
+private:
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  bool m_open = false;
+};
+
+// count 개의 작업이 시작될 때까지 대기
+class Counter
+{
+public:
+  void add() {
+    { std::lock_guard<std::mutex> lock(m_mtx); m_value++; }
+    m_cv.notify_all();
+  }
+  bool waitFor(int count, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    return m_cv.wait_for(lock, timeout, [this, count]() { return m_value >= count; });
+  }
+  int value() {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_value;
+  }
+
+private:
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  int m_value = 0;
+};
+
+constexpr auto k_timeout = std::chrono::seconds(5);
+
+} // namespace
+
+TEST(TaskScheduler, KeepsSlotsForPreviewAndBackground) {
+  TaskScheduler& scheduler = TaskScheduler::instance();
+  ASSERT_GE(scheduler.workerCount(), 3);
+  EXPECT_EQ(scheduler.exportCapacity(), scheduler.workerCount() - 2);
+}
+
+TEST(TaskScheduler, BackgroundRunsWhileExportsFillTheirSlots) {
+  TaskScheduler& scheduler = TaskScheduler::instance();
+  const int capacity = scheduler.exportCapacity();
+
+  // Export 슬롯보다 하나 더 등록 -> capacity 개만 시작되고 나머지는 대기
+  auto release = std::make_shared<Gate>();
+  auto exportsStarted = std::make_shared<Counter>();
+  for (int i = 0; i < capacity + 1; i++) {
+    scheduler.submit(TaskQos::Export, "test.export", [release, exportsStarted]() { exportsStarted->add(); release->wait(); });
+  }
+  ASSERT_TRUE(exportsStarted->waitFor(capacity, k_timeout));
+
+  // export 가 슬롯을 모두 차지해도 Background / PreviewCritical 은 바로 실행됨
+  auto background = std::make_shared<Gate>();
+  auto critical = std::make_shared<Gate>();
+  scheduler.submit(TaskQos::Background, "test.background", [background]() { background->open(); });
+  scheduler.submit(TaskQos::PreviewCritical, "test.critical", [critical]() { critical->open(); });
+  EXPECT_TRUE(background->waitFor(k_timeout));
+  EXPECT_TRUE(critical->waitFor(k_timeout));
+  EXPECT_EQ(exportsStarted->value(), capacity);
+
+  release->open();
+  EXPECT_TRUE(exportsStarted->waitFor(capacity + 1, k_timeout));
+}
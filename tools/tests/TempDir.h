@@ -0,0 +1,39 @@
+#pragma once
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+/**
+ * 테스트용 임시 폴더 (소멸 시 안의 파일과 함께 삭제)
+ */
+class TempDir
+{
+public:
+  TempDir() {
+    char tmpl[] = "/tmp/engine_tests_XXXXXX";
+    if (mkdtemp(tmpl)) m_path = tmpl;
+  };
+  ~TempDir() {
+    if (m_path.empty()) return;
+    if (DIR* d = opendir(m_path.c_str())) {
+      while (dirent* e = readdir(d)) {
+        const std::string name = e->d_name;
+        if (name != "." && name != "..") std::remove((m_path + "/" + name).c_str());
+      }
+      closedir(d);
+    }
+    rmdir(m_path.c_str());
+  };
+
+  TempDir(const TempDir&) = delete;
+  TempDir& operator=(const TempDir&) = delete;
+
+  bool valid() const { return !m_path.empty(); };
+  // 폴더 안의 파일 경로
+  std::string path(const std::string& name) const { return m_path + "/" + name; };
+
+private:
+  std::string m_path;
+};
@@ -0,0 +1,148 @@
+#include "../../shared/video/Timeline.h"
+#include "../../shared/video/ClipSequence.h"
+#include "../../shared/video/Compositor.h"
+#include <core/SkBitmap.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+// 클립마다 서로 다른 1x1 raster 이미지 (imagesAt 결과로 어떤 클립이 보이는지 구분)
+Timeline::Segment makeClip(double duration, double xfade) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(1, 1);
+  Timeline::Segment seg;
+  seg.clip = Timeline::ClipRenderData(bitmap.asImage(), SkRect::MakeWH(100.0f, 100.0f));
+  seg.duration = duration;
+  seg.xfade = xfade;
+  return seg;
+}
+
+// 원본 이미지만 고르도록 Export 품질, 캔버스 없이 시간 t 의 조회 조건
+RenderContext exportAt(double tSec) {
+  RenderContext ctx(nullptr, 100, 100, tSec);
+  ctx.quality = RenderQuality::Export;
+  return ctx;
+}
+
+// 같은 클립 배치의 두 Timeline 이 모든 시간에 같은 클립을 같은 순서로 그리는지 확인
+void expectSameImages(const Timeline& a, const Timeline& b, double step) {
+  ASSERT_DOUBLE_EQ(a.totalDuration(), b.totalDuration());
+  for (double t = 0.0; t < a.totalDuration() + 1.0; t += step) {
+    const std::vector<sk_sp<SkImage>> ia = a.imagesAt(exportAt(t));
+    const std::vector<sk_sp<SkImage>> ib = b.imagesAt(exportAt(t));
+    ASSERT_EQ(ia.size(), ib.size()) << "t=" << t;
+    for (size_t k = 0; k < ia.size(); k++) {
+      EXPECT_EQ(ia[k].get(), ib[k].get()) << "t=" << t << " layer " << k;
+    }
+  }
+}
+
+// 정렬된 클립 목록(segs)을 전부 훑어 시간 t 에 보이는 클립 이미지 (Timeline::Track::activeAt 의 정의 그대로, 기본 트랙)
+std::vector<SkImage*> visibleByBruteForce(const std::vector<Timeline::Segment>& segs, double tSec) {
+  auto inFade = [&](size_t i) {
+    const double end = segs[i].start + segs[i].duration;
+    const double fadeStart = std::max(segs[i].start, end - segs[i].xfade);
+    return segs[i].xfade > 0.0 && i + 1 < segs.size() && tSec >= fadeStart && tSec < end;
+  };
+  std::vector<SkImage*> images;
+  for (size_t i = 0; i < segs.size(); i++) {
+    const bool playing = tSec >= segs[i].start && tSec < segs[i].start + segs[i].duration;
+    const bool entering = i > 0 && inFade(i - 1);
+    if (playing || entering) images.push_back(segs[i].clip.image.get());
+  }
+  if (images.size() > (size_t)Compositor::k_maxLayers) {
+    images.erase(images.begin(), images.end() - Compositor::k_maxLayers);
+  }
+  if (images.empty() && !segs.empty()) images.push_back(segs.back().clip.image.get());
+  return images;
+}
+
+} // namespace
+
+TEST(TimelineTest, LongEarlyClipDoesNotHideLaterClips) {
+  // 맨 앞 클립이 끝까지 재생되고, 그 사이 짧은 클립들이 겹치거나 빈 구간을 두고 이어짐
+  std::mt19937 rng(11);
+  std::vector<Timeline::Segment> segs;
+  segs.push_back(makeClip(500.0, 2.0));
+  double t = 0.5;
+  for (int i = 0; i < 300; i++) {
+    Timeline::Segment seg = makeClip(0.25 + (rng() % 8) * 0.25, (rng() % 4) * 0.25);
+    seg.start = t;
+    // 가끔 여러 클립을 겹치게(길게) 만듦
+    if (rng() % 20 == 0) seg.duration += 10.0;
+    segs.push_back(seg);
+    t += 0.3 + (rng() % 5) * 0.4;
+  }
+
+  std::vector<Timeline::Segment> copy = segs;
+  Timeline tl;
+  tl.setSegments(copy);
+  for (double q = 0.0; q < 520.0; q += 0.1) {
+    const std::vector<sk_sp<SkImage>> images = tl.imagesAt(exportAt(q));
+    const std::vector<SkImage*> expected = visibleByBruteForce(segs, q);
+    ASSERT_EQ(images.size(), expected.size()) << "t=" << q;
+    for (size_t k = 0; k < images.size(); k++) {
+      EXPECT_EQ(images[k].get(), expected[k]) << "t=" << q << " layer " << k;
+    }
+  }
+}
+
+TEST(TimelineTest, SequenceTrackDrawsSameClipsAsSortedTrack) {
+  std::mt19937 rng(7);
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 120; i++) {
+    const double duration = 1.0 + (rng() % 4) * 0.5;
+    // xfade 가 길이보다 긴 클립(뒤 클립 여러 개와 겹침)도 섞음
+    const double xfade = (rng() % 15 == 0) ? duration + 4.0 : (rng() % 3) * 0.25;
+    clips.push_back(makeClip(duration, xfade));
+  }
+  const ClipSequence seq = ClipSequence::fromSegments(clips);
+
+  std::vector<Timeline::Segment> laid = seq.toSegments();
+  Timeline sorted;
+  sorted.setSegments(laid);
+  std::shared_ptr<Timeline> fromSequence = Timeline().withSequence(0, seq);
+
+  expectSameImages(sorted, *fromSequence, 0.125);
+}
+
+TEST(TimelineTest, SequenceTrackAfterEdits) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 40; i++) clips.push_back(makeClip(2.0, 0.5));
+  ClipSequence seq = ClipSequence::fromSegments(clips);
+  seq = seq.insert(0, makeClip(30.0, 30.0)).erase(7).move(3, 25).retime(10, 4.0, 1.5).replace(12, makeClip(2.0, 0.5));
+
+  std::shared_ptr<Timeline> base = Timeline::FromClipRenderData({ clips[0].clip }, 2.0, 0.5);
+  std::shared_ptr<Timeline> edited = base->withSequence(0, seq);
+
+  std::vector<Timeline::Segment> laid = seq.toSegments();
+  Timeline sorted;
+  sorted.setSegments(laid);
+  expectSameImages(sorted, *edited, 0.1);
+
+  // 펼치지 않는 조회와 펼친 목록이 같은 클립/시작 시간
+  ASSERT_EQ(edited->segmentCount(0), laid.size());
+  const std::vector<Timeline::Segment>& flattened = edited->segments(0);
+  ASSERT_EQ(flattened.size(), laid.size());
+  for (size_t i = 0; i < laid.size(); i++) {
+    double start = -1.0;
+    const Timeline::Segment& seg = edited->segmentAt(0, i, start);
+    EXPECT_EQ(seg.clip.image.get(), laid[i].clip.image.get());
+    EXPECT_DOUBLE_EQ(start, laid[i].start);
+    EXPECT_EQ(flattened[i].clip.image.get(), laid[i].clip.image.get());
+    EXPECT_DOUBLE_EQ(flattened[i].start, laid[i].start);
+  }
+}
+
+TEST(TimelineTest, SequenceTrackHoldsLastClip) {
+  std::vector<Timeline::Segment> clips;
+  for (int i = 0; i < 3; i++) clips.push_back(makeClip(1.0, 0.0));
+  std::shared_ptr<Timeline> tl = Timeline().withSequence(0, ClipSequence::fromSegments(clips));
+
+  // 기본 트랙은 끝난 뒤에도 마지막 클립을 유지
+  const std::vector<sk_sp<SkImage>> images = tl->imagesAt(exportAt(10.0));
+  ASSERT_EQ(images.size(), 1u);
+  EXPECT_EQ(images[0].get(), clips.back().clip.image.get());
+}